@@ -28,6 +28,9 @@ workspace "ProjectDG"
     defines { "DG_LINUX" }
   filter {}
 
+  -- Dear ImGui Configuration
+  defines { 'IMGUI_USER_CONFIG="DG_ImGuiConfig.hpp"' }
+
 -- Engine Library
 project "dg-engine"
 
@@ -60,11 +63,13 @@ project "dg-engine"
     "./projects/dg-engine/include/DG/Graphics/*.hpp",
     "./projects/dg-engine/include/DG/Math/*.hpp",
     "./projects/dg-engine/include/DG/Core/*.hpp",
+    "./projects/dg-engine/include/DG/Scene/*.hpp",
     
     "./projects/dg-engine/src/DG/Events/*.cpp",
     "./projects/dg-engine/src/DG/Graphics/*.cpp",
     "./projects/dg-engine/src/DG/Math/*.cpp",
     "./projects/dg-engine/src/DG/Core/*.cpp",
+    "./projects/dg-engine/src/DG/Scene/*.cpp",
 
     "./vendor/imgui/*.cpp"
   }
@@ -114,6 +119,101 @@ project "dg-studio"
 
   -- Platform Specific Link Libraries
   filter { "system:linux" }
-    links { "X11", "pthread", "Xrandr", "Xi", "dl", "GLEW" }
+    links { "X11", "pthread", "Xrandr", "Xi", "dl", "GLEW", "EGL" }
+  filter {}
+  
+-- Benchmark Application
+project "dg-bench"
+
+  -- Console Application
+  kind "ConsoleApp"
+
+  -- Build Files and Output
+  location "./generated/dg-bench"
+  targetdir "./build/bin/dg-bench/%{cfg.buildcfg}"
+  objdir "./build/obj/dg-bench/%{cfg.buildcfg}"
+
+  -- Precompiled Header
+  pchheader "DGBench_Pch.hpp"
+  pchsource "./projects/dg-bench/src/DGBench_Pch.cpp"
+
+  -- Include Directories
+  includedirs {
+    "./vendor/entt/include",
+    "./vendor/stb/include",
+    "./vendor/glfw/include",
+    "./vendor/glew/include",
+    "./vendor/glm/include",
+    "./vendor/imgui",
+    "./projects/dg-engine/include",
+    "./projects/dg-bench/include"
+  }
+
+  -- Project Sources
+  files {
+    "./projects/dg-bench/include/**.hpp",
+    "./projects/dg-bench/src/**.cpp"
+  }
+
+  -- Link Libraries
+  libdirs {
+    "./vendor/glew/lib",
+    "./vendor/glfw/lib",
+    "./build/bin/dg-engine/%{cfg.buildcfg}"
+  }
+  links {
+    "dg-engine", "glfw3", "GL"
+  }
+
+  -- Platform Specific Link Libraries
+  filter { "system:linux" }
+    links { "X11", "pthread", "Xrandr", "Xi", "dl", "GLEW", "EGL" }
+  filter {}
+
+-- Asset Cooking Tool
+project "dg-cook"
+
+  -- Console Application
+  kind "ConsoleApp"
+
+  -- Build Files and Output
+  location "./generated/dg-cook"
+  targetdir "./build/bin/dg-cook/%{cfg.buildcfg}"
+  objdir "./build/obj/dg-cook/%{cfg.buildcfg}"
+
+  -- Precompiled Header
+  pchheader "DGCook_Pch.hpp"
+  pchsource "./projects/dg-cook/src/DGCook_Pch.cpp"
+
+  -- Include Directories
+  includedirs {
+    "./vendor/entt/include",
+    "./vendor/stb/include",
+    "./vendor/glfw/include",
+    "./vendor/glew/include",
+    "./vendor/glm/include",
+    "./vendor/imgui",
+    "./projects/dg-engine/include",
+    "./projects/dg-cook/include"
+  }
+
+  -- Project Sources
+  files {
+    "./projects/dg-cook/include/**.hpp",
+    "./projects/dg-cook/src/**.cpp"
+  }
+
+  -- Link Libraries
+  libdirs {
+    "./vendor/glew/lib",
+    "./vendor/glfw/lib",
+    "./build/bin/dg-engine/%{cfg.buildcfg}"
+  }
+  links {
+    "dg-engine", "glfw3", "GL"
+  }
+
+  -- Platform Specific Link Libraries
+  filter { "system:linux" }
+    links { "X11", "pthread", "Xrandr", "Xi", "dl", "GLEW", "EGL" }
   filter {}
-  
\ No newline at end of file
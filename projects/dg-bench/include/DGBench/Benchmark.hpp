@@ -0,0 +1,169 @@
+/** @file DGBench/Benchmark.hpp */
+
+#pragma once
+
+#include <DGBench_Pch.hpp>
+
+namespace dgbench
+{
+
+  /**
+   * @brief The @a `BenchmarkSpecification` struct describes how each benchmark is run.
+   */
+  struct BenchmarkSpecification
+  {
+
+    /**
+     * @brief The number of untimed iterations run before measuring, to warm up caches.
+     */
+    dg::Count warmupIterations = 5;
+
+    /**
+     * @brief The number of timed iterations.
+     */
+    dg::Count iterations = 50;
+
+    /**
+     * @brief If not empty, only benchmarks whose names contain this string are run.
+     */
+    dg::String filter = "";
+
+  };
+
+  /**
+   * @brief The @a `BenchmarkResult` struct holds the timing statistics of a single benchmark. All
+   *        times are in microseconds, per iteration.
+   */
+  struct BenchmarkResult
+  {
+    dg::String  name;
+    dg::Count   iterations = 0;
+    dg::Count   operations = 0;
+    dg::Float64 minimum = 0.0;
+    dg::Float64 mean = 0.0;
+    dg::Float64 median = 0.0;
+    dg::Float64 p90 = 0.0;
+    dg::Float64 p99 = 0.0;
+    dg::Float64 maximum = 0.0;
+
+    /**
+     * @brief The number of operations performed per second, based on the median iteration time.
+     */
+    dg::Float64 operationsPerSecond = 0.0;
+  };
+
+  /**
+   * @brief The @a `BenchmarkRunner` class registers, runs and reports on a set of benchmarks.
+   */
+  class BenchmarkRunner
+  {
+  public:
+    BenchmarkRunner (const BenchmarkSpecification& spec = {});
+
+    /**
+     * @brief Registers a benchmark.
+     *
+     * @param name        The benchmark's name.
+     * @param operations  The number of operations performed by one call to @a `function`.
+     * @param function    The function to be timed.
+     * @param setup       If not null, called once before the benchmark is warmed up, but only if
+     *                    it matches the filter, to build the fixtures which it needs.
+     */
+    void add (const dg::String& name, const dg::Count operations,
+      const dg::LFunction<void>& function, const dg::LFunction<void>& setup = nullptr);
+
+    /**
+     * @brief   Runs every registered benchmark which matches the specification's filter, logging
+     *          each result as it completes.
+     *
+     * @return  The results of the benchmarks which were run.
+     */
+    const dg::Collection<BenchmarkResult>& run ();
+
+    /**
+     * @brief   Writes the results of the last run to a JSON file.
+     *
+     * @param   path  The path to the JSON file to write.
+     *
+     * @return  @a `true` if the file was written; @a `false` otherwise.
+     */
+    dg::Bool writeJson (const dg::Path& path) const;
+
+    /**
+     * @brief   Compares the results of the last run against a JSON file written by an earlier
+     *          run, logging each benchmark whose median time has grown by more than the given
+     *          fraction.
+     *
+     * @param   path      The path to the baseline JSON file.
+     * @param   threshold The allowed growth of the median time, as a fraction (eg. @a `0.1` for
+     *                    ten percent).
+     *
+     * @return  The number of regressions found, or @a `-1` if the baseline could not be loaded.
+     */
+    dg::Int32 compareToBaseline (const dg::Path& path, const dg::Float64 threshold) const;
+
+  private:
+    struct Benchmark
+    {
+      dg::String              name;
+      dg::Count               operations;
+      dg::LFunction<void>     function;
+      dg::LFunction<void>     setup;
+    };
+
+    BenchmarkResult measure (const Benchmark& benchmark) const;
+
+  private:
+    BenchmarkSpecification            m_spec;
+    dg::Collection<Benchmark>         m_benchmarks;
+    dg::Collection<BenchmarkResult>   m_results;
+
+  };
+
+  /**
+   * @brief Registers the core module's benchmarks - formatting and file lexing - with the given
+   *        runner.
+   */
+  void registerCoreBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the event bus benchmarks with the given runner.
+   */
+  void registerEventBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the math module's benchmarks - transforms and shape queries - with the given
+   *        runner.
+   */
+  void registerMathBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the 2D renderer's quad submission benchmarks with the given runner.
+   */
+  void registerRendererBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the graphics module's benchmarks - textures, frame buffers, render graphs and
+   *        the render thread - with the given runner.
+   */
+  void registerGraphicsBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the scene benchmarks - rendering, scheduling and serializing a scene of a
+   *        million sprites - with the given runner.
+   */
+  void registerSceneBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Registers the benchmarks of every engine module with the given runner. Their fixtures
+   *        are built when the first benchmark which needs them is run.
+   */
+  void registerEngineBenchmarks (BenchmarkRunner& runner);
+
+  /**
+   * @brief Releases whichever fixtures the engine benchmarks have built, and shuts down the render
+   *        interface.
+   */
+  void releaseEngineBenchmarks ();
+
+}
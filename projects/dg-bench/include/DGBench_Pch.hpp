@@ -0,0 +1,11 @@
+/** @file DGBench_Pch.hpp */
+
+#ifndef DGBENCH_PCH_HPP
+#define DGBENCH_PCH_HPP
+
+#include <DG.hpp>
+#include <DG/Events/WindowEvent.hpp>
+#include <DG/Graphics/NullRenderBackend.hpp>
+#include <DG/Graphics/Renderer.hpp>
+
+#endif
@@ -0,0 +1,198 @@
+/** @file DGBench/Benchmark.cpp */
+
+#include <DGBench/Benchmark.hpp>
+
+namespace dgbench
+{
+
+  namespace Private
+  {
+
+    static dg::Float64 percentile (const dg::Collection<dg::Float64>& sorted,
+      const dg::Float64 fraction)
+    {
+      if (sorted.empty()) { return 0.0; }
+
+      // Nearest-rank percentile.
+      auto rank = static_cast<dg::Index>(std::ceil(fraction * sorted.size()));
+      return sorted[rank == 0 ? 0 : std::min(rank, sorted.size()) - 1];
+    }
+
+    static dg::Bool loadBaselineMedians (const dg::Path& path,
+      dg::Dictionary<dg::Float64>& medians)
+    {
+      dg::FileLexer lexer;
+      if (lexer.loadFromFile(path) == false) {
+        return false;
+      }
+
+      // The baseline is a file written by `writeJson`, so only the "name" and "median_us" keys
+      // of each benchmark object need to be picked out.
+      dg::String name = "";
+      while (lexer.hasMoreTokens()) {
+        const auto& token = lexer.getNextToken();
+        if (token.type == dg::FileTokenType::EndOfFile) { break; }
+        if (token.type != dg::FileTokenType::String) { continue; }
+        if (lexer.getNextToken(false).type != dg::FileTokenType::Colon) { continue; }
+
+        lexer.getNextToken();
+        const auto& value = lexer.getNextToken();
+        if (token.contents == "name" && value.type == dg::FileTokenType::String) {
+          name = value.contents;
+        } else if (
+          token.contents == "median_us" && name.empty() == false &&
+          (value.type == dg::FileTokenType::FloatingPoint ||
+           value.type == dg::FileTokenType::Integer)
+        ) {
+          medians[name] = std::stod(value.contents);
+        }
+      }
+
+      return true;
+    }
+
+  }
+
+  BenchmarkRunner::BenchmarkRunner (const BenchmarkSpecification& spec) :
+    m_spec { spec }
+  {
+
+  }
+
+  void BenchmarkRunner::add (const dg::String& name, const dg::Count operations,
+    const dg::LFunction<void>& function, const dg::LFunction<void>& setup)
+  {
+    if (name.empty() || function == nullptr) {
+      throw std::invalid_argument { "Attempted 'add' of unnamed or null benchmark!" };
+    }
+
+    m_benchmarks.push_back({ name, operations == 0 ? 1 : operations, function, setup });
+  }
+
+  const dg::Collection<BenchmarkResult>& BenchmarkRunner::run ()
+  {
+    m_results.clear();
+
+    for (const auto& benchmark : m_benchmarks) {
+      if (
+        m_spec.filter.empty() == false &&
+        benchmark.name.find(m_spec.filter) == dg::String::npos
+      ) {
+        continue;
+      }
+
+      if (benchmark.setup != nullptr) {
+        benchmark.setup();
+      }
+
+      const auto& result = m_results.emplace_back(measure(benchmark));
+      DG_INFO("{}: median {} us, p90 {} us, p99 {} us, {} ops/s", result.name, result.median,
+        result.p90, result.p99, static_cast<dg::Uint64>(result.operationsPerSecond));
+    }
+
+    return m_results;
+  }
+
+  dg::Bool BenchmarkRunner::writeJson (const dg::Path& path) const
+  {
+    std::fstream file { path, std::ios::out | std::ios::trunc };
+    if (file.is_open() == false) {
+      DG_ERROR("Could not open '{}' for writing benchmark results.", path.string());
+      return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\n";
+    file << "  \"warmup_iterations\": " << m_spec.warmupIterations << ",\n";
+    file << "  \"iterations\": " << m_spec.iterations << ",\n";
+    file << "  \"benchmarks\": [\n";
+    for (dg::Index i = 0; i < m_results.size(); ++i) {
+      const auto& result = m_results[i];
+      file << "    {\n";
+      file << "      \"name\": \"" << result.name << "\",\n";
+      file << "      \"iterations\": " << result.iterations << ",\n";
+      file << "      \"operations\": " << result.operations << ",\n";
+      file << "      \"min_us\": " << result.minimum << ",\n";
+      file << "      \"mean_us\": " << result.mean << ",\n";
+      file << "      \"median_us\": " << result.median << ",\n";
+      file << "      \"p90_us\": " << result.p90 << ",\n";
+      file << "      \"p99_us\": " << result.p99 << ",\n";
+      file << "      \"max_us\": " << result.maximum << ",\n";
+      file << "      \"ops_per_second\": " << result.operationsPerSecond << "\n";
+      file << "    }" << (i + 1 < m_results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n";
+    file << "}\n";
+
+    return true;
+  }
+
+  dg::Int32 BenchmarkRunner::compareToBaseline (const dg::Path& path,
+    const dg::Float64 threshold) const
+  {
+    dg::Dictionary<dg::Float64> medians;
+    if (Private::loadBaselineMedians(path, medians) == false) {
+      DG_ERROR("Could not load benchmark baseline '{}'.", path.string());
+      return -1;
+    }
+
+    dg::Int32 regressions = 0;
+    for (const auto& result : m_results) {
+      auto iter = medians.find(result.name);
+      if (iter == medians.end() || iter->second <= 0.0) {
+        DG_WARN("{}: no baseline.", result.name);
+        continue;
+      }
+
+      dg::Float64 change = (result.median - iter->second) / iter->second;
+      if (change > threshold) {
+        DG_ERROR("{}: REGRESSION - median {} us vs. baseline {} us ({}%).", result.name,
+          result.median, iter->second, change * 100.0);
+        regressions++;
+      } else {
+        DG_INFO("{}: median {} us vs. baseline {} us ({}%).", result.name, result.median,
+          iter->second, change * 100.0);
+      }
+    }
+
+    return regressions;
+  }
+
+  BenchmarkResult BenchmarkRunner::measure (const Benchmark& benchmark) const
+  {
+    for (dg::Index i = 0; i < m_spec.warmupIterations; ++i) {
+      benchmark.function();
+    }
+
+    dg::Collection<dg::Float64> samples;
+    samples.reserve(m_spec.iterations);
+
+    dg::Clock clock;
+    for (dg::Index i = 0; i < m_spec.iterations; ++i) {
+      clock.restart();
+      benchmark.function();
+      samples.push_back(static_cast<dg::Float64>(clock.getElapsed()) * 1000000.0);
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = samples.size();
+    result.operations = benchmark.operations;
+    if (samples.empty()) { return result; }
+
+    result.minimum = samples.front();
+    result.maximum = samples.back();
+    result.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    result.median = Private::percentile(samples, 0.5);
+    result.p90 = Private::percentile(samples, 0.9);
+    result.p99 = Private::percentile(samples, 0.99);
+    if (result.median > 0.0) {
+      result.operationsPerSecond = benchmark.operations * 1000000.0 / result.median;
+    }
+
+    return result;
+  }
+
+}
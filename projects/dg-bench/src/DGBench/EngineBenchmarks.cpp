@@ -0,0 +1,890 @@
+/** @file DGBench/EngineBenchmarks.cpp */
+
+#include <DGBench/Benchmark.hpp>
+
+namespace dgbench
+{
+
+  namespace Private
+  {
+
+    static constexpr const char* SHADER_PATH      = "assets/basic.glsl";
+    static constexpr const char* PALETTE_PATH     = "assets/background.pal";
+    static constexpr const char* TEXTURE_PATH     = "assets/wall.jpg";
+    static constexpr const char* COOKED_PATH      = "dg-bench-wall.jpg.dgtex";
+    static constexpr const char* COMPRESSED_PATH  = "dg-bench-wall-bc1.jpg.dgtex";
+    static constexpr const char* SCENE_PATH       = "dg-bench-scene.dgscene";
+
+    static constexpr dg::Count QUAD_COUNT       = 10000;
+    static constexpr dg::Count EVENT_COUNT      = 1000;
+    static constexpr dg::Count FORMAT_COUNT     = 1000;
+    static constexpr dg::Count LOOKUP_COUNT     = 1000;
+    static constexpr dg::Count COMMAND_COUNT    = 10000;
+    static constexpr dg::Count RESIZE_COUNT     = 100;
+    static constexpr dg::Count SHAPE_COUNT      = 100000;
+    static constexpr dg::Count ENTITY_COUNT     = 1000000;
+
+    /**
+     * @brief Keeps results alive, so the compiler cannot discard the work being measured.
+     */
+    static volatile dg::Size s_sink = 0;
+
+    class CountingListener : public dg::EventListener
+    {
+    public:
+      void processEvent (dg::Event& ev) override
+      {
+        handleEvent<dg::WindowResizeEvent>(ev, [&] (dg::WindowResizeEvent& resize)
+        {
+          m_count += resize.getWidth();
+          return true;
+        });
+      }
+
+      dg::Size m_count = 0;
+    };
+
+    static CountingListener s_listener;
+    static dg::Scope<dg::Renderer> s_renderer = nullptr;
+    static dg::Ref<dg::FrameBuffer> s_target = nullptr;
+    static dg::Ref<dg::Texture> s_texture = nullptr;
+    static dg::Collection<dg::Ref<dg::SubTexture>> s_frames;
+    static dg::Scope<dg::ThreadedRenderBackend> s_threadedBackend = nullptr;
+    static dg::Collection<dg::AABB2D> s_boxList;
+    static dg::AABB2DArray s_boxes;
+    static dg::Collection<dg::Index> s_hits;
+    static dg::Ref<dg::Scene> s_scene = nullptr;
+    static dg::Scope<dg::SystemScheduler> s_scheduler = nullptr;
+    static std::atomic<dg::Size> s_farCount = 0;
+
+    static dg::Bool s_assetLoaderStarted = false;
+    static dg::Bool s_eventBusStarted = false;
+    static dg::Path s_scenePath = "";
+    static dg::Path s_cookedPath = "";
+    static dg::Path s_compressedPath = "";
+
+    // The fixtures below are built the first time a benchmark asks for them, so that a filtered
+    // run only pays for the ones its benchmarks use. Each benchmark which needs one passes its
+    // getter to the runner as a setup function, which keeps the build out of the timings.
+
+    // The renderer records its commands with the null backend, so only the CPU side is measured.
+    static dg::Renderer& getRenderer ()
+    {
+      if (s_renderer == nullptr) {
+        dg::RendererSpecification rendererSpec;
+        rendererSpec.backend = dg::RenderBackendType::Null;
+        s_renderer = dg::Renderer::make(rendererSpec);
+
+        dg::FrameBufferSpecification targetSpec;
+        targetSpec.attachmentSpec = {
+          dg::FrameBufferTextureFormat::ColorRGBA8,
+          dg::FrameBufferTextureFormat::ColorR32,
+          dg::FrameBufferTextureFormat::Depth
+        };
+        s_target = dg::FrameBuffer::make(targetSpec);
+        s_renderer->useFrameBuffer2D(s_target);
+        s_renderer->useQuadShader2D(dg::ShaderManager::getOrEmplace(SHADER_PATH));
+      }
+
+      return *s_renderer;
+    }
+
+    static const dg::Ref<dg::FrameBuffer>& getTarget ()
+    {
+      getRenderer();
+      return s_target;
+    }
+
+    static const dg::Ref<dg::Texture>& getTexture ()
+    {
+      if (s_texture == nullptr) {
+        getRenderer();
+        s_texture = dg::Texture::make(dg::Path { TEXTURE_PATH });
+        dg::TextureUploadQueue::flush();
+      }
+
+      return s_texture;
+    }
+
+    // Every frame of the sheet shares its texture, so quads drawn with them share one batch.
+    static const dg::Collection<dg::Ref<dg::SubTexture>>& getFrames ()
+    {
+      if (s_frames.empty() == true) {
+        s_frames = dg::SubTexture::slice(getTexture(), { 64, 64 });
+      }
+
+      return s_frames;
+    }
+
+    // A render thread carrying out commands with its own null backend, apart from the renderer's.
+    static dg::ThreadedRenderBackend& getThreadedBackend ()
+    {
+      if (s_threadedBackend == nullptr) {
+        dg::RenderThreadSpecification threadSpec;
+        threadSpec.enabled = true;
+        s_threadedBackend = dg::makeScope<dg::ThreadedRenderBackend>(
+          dg::makeScope<dg::NullRenderBackend>(), threadSpec);
+        s_threadedBackend->initialize();
+      }
+
+      return *s_threadedBackend;
+    }
+
+    static void startAssetLoader ()
+    {
+      getRenderer();
+      if (s_assetLoaderStarted == false) {
+        dg::AssetLoader::initialize();
+        s_assetLoaderStarted = true;
+      }
+    }
+
+    static void startEventBus ()
+    {
+      if (s_eventBusStarted == false) {
+        dg::EventBus::initialize(s_listener);
+        s_eventBusStarted = true;
+      }
+    }
+
+    // A field of boxes, kept both as a list of shapes and as one array per coordinate.
+    static void buildBoxes ()
+    {
+      if (s_boxList.empty() == false) {
+        return;
+      }
+
+      for (dg::Index i = 0; i < SHAPE_COUNT; ++i) {
+        const dg::Float32 x = static_cast<dg::Float32>(i % 1000);
+        const dg::Float32 y = static_cast<dg::Float32>(i / 1000);
+        s_boxList.push_back(dg::AABB2D::fromCenterSize({ x, y }, { 0.75f, 0.75f }));
+        s_boxes.push(s_boxList.back());
+      }
+    }
+
+    // A scene of a million sprites on a 1000x1000 grid, half of them textured, all in view.
+    static dg::Scene& getScene ()
+    {
+      if (s_scene == nullptr) {
+        const auto& texture = getTexture();
+        s_scene = dg::Scene::make();
+        for (dg::Index i = 0; i < ENTITY_COUNT; ++i) {
+          const dg::Float32 x = static_cast<dg::Float32>(i % 1000);
+          const dg::Float32 y = static_cast<dg::Float32>(i / 1000);
+          dg::Entity entity = s_scene->createEntity();
+          entity.addComponent<dg::TransformComponent>(
+            dg::Transform2D::fromPositionRotationScale({ x, y }, x));
+          auto& sprite = entity.addComponent<dg::SpriteRendererComponent>();
+          sprite.texture = ((i / 64) % 2 == 0) ? texture : nullptr;
+        }
+
+        dg::Entity cameraEntity = s_scene->createEntity();
+        cameraEntity.addComponent<dg::TransformComponent>(
+          dg::Transform2D::fromPositionRotationScale({ 500.0f, 500.0f }, 0.0f));
+        cameraEntity.addComponent<dg::CameraComponent>(
+          dg::CameraComponent { dg::OrthographicCamera2D { { 1002.0f, 1002.0f } } });
+      }
+
+      return *s_scene;
+    }
+
+    // Three systems over the scene's sprites: moving them and tinting them touch separate
+    // components, so they may run at once; counting the far ones waits for the move.
+    static dg::SystemScheduler& getScheduler ()
+    {
+      if (s_scheduler != nullptr) {
+        return *s_scheduler;
+      }
+
+      s_scheduler = dg::makeScope<dg::SystemScheduler>();
+      s_scheduler->addSystem({ "move", dg::SystemAccess {}.write<dg::TransformComponent>(),
+        false, [] (dg::SystemContext& context)
+      {
+        const dg::Float32 step = context.getDeltaTime();
+        context.forEach<dg::TransformComponent>([step] (entt::entity, dg::TransformComponent& tc)
+        {
+          tc.transform.origin.x += step;
+        });
+      } });
+      s_scheduler->addSystem({ "tint",
+        dg::SystemAccess {}.write<dg::SpriteRendererComponent>(), false,
+        [] (dg::SystemContext& context)
+      {
+        context.forEach<dg::SpriteRendererComponent>([] (entt::entity,
+          dg::SpriteRendererComponent& sprite)
+        {
+          sprite.color.alpha = 1.0f - sprite.color.alpha * 0.5f;
+        });
+      } });
+      s_scheduler->addSystem({ "countFar",
+        dg::SystemAccess {}.read<dg::TransformComponent>(), false, [] (dg::SystemContext& context)
+      {
+        s_farCount = 0;
+        context.forEach<dg::TransformComponent>([] (entt::entity,
+          const dg::TransformComponent& tc)
+        {
+          if (tc.transform.origin.x > 500.0f) {
+            s_farCount.fetch_add(1, std::memory_order_relaxed);
+          }
+        });
+      } });
+
+      return *s_scheduler;
+    }
+
+    // Loads the scene file back and compares it with the scene it was saved from, logging an
+    // error if any entity or component differs.
+    static void checkSceneRoundTrip (const dg::Path& path)
+    {
+      auto loaded = dg::SceneSerializer::load(path);
+      if (loaded == nullptr) {
+        DG_ERROR("Scene file '{}' could not be loaded back.", path.string());
+        return;
+      }
+
+      entt::registry& original = getScene().getRegistry();
+      entt::registry& registry = loaded->getRegistry();
+      dg::Count mismatches = 0;
+
+      const auto& entities = original.storage<entt::entity>();
+      const auto& loadedEntities = registry.storage<entt::entity>();
+      if (entities.size() != loadedEntities.size() ||
+        entities.in_use() != loadedEntities.in_use()) {
+        mismatches++;
+      } else {
+        for (dg::Index i = 0; i < entities.size(); ++i) {
+          if (entities.data()[i] != loadedEntities.data()[i]) {
+            mismatches++;
+          }
+        }
+      }
+
+      for (auto [entity, transform] : original.view<dg::TransformComponent>().each()) {
+        const auto* other = registry.try_get<dg::TransformComponent>(entity);
+        if (other == nullptr || std::memcmp(other, &transform, sizeof(transform)) != 0) {
+          mismatches++;
+        }
+      }
+
+      // The loaded scene's textures come from the texture manager, so they need not be the
+      // saved scene's own, but each must always stand in for the same one, loaded from the same
+      // file.
+      std::unordered_map<const dg::Texture*, const dg::Texture*> loadedTextures;
+      const auto isSameTexture = [&] (const dg::Texture* texture, const dg::Texture* other)
+      {
+        if (texture == nullptr || other == nullptr) {
+          return texture == other;
+        }
+
+        auto [iter, added] = loadedTextures.try_emplace(texture, other);
+        if (added == true) {
+          return dg::FileIo::getRelative(texture->getFilepath()) ==
+            dg::FileIo::getRelative(other->getFilepath());
+        }
+
+        return iter->second == other;
+      };
+
+      for (auto [entity, sprite] : original.view<dg::SpriteRendererComponent>().each()) {
+        const auto* other = registry.try_get<dg::SpriteRendererComponent>(entity);
+        if (
+          other == nullptr ||
+          std::memcmp(&other->color, &sprite.color, sizeof(sprite.color)) != 0 ||
+          isSameTexture(sprite.texture.get(), other->texture.get()) == false ||
+          (other->subTexture == nullptr) != (sprite.subTexture == nullptr)
+        ) {
+          mismatches++;
+        }
+      }
+
+      for (auto [entity, camera] : original.view<dg::CameraComponent>().each()) {
+        const auto* other = registry.try_get<dg::CameraComponent>(entity);
+        if (
+          other == nullptr ||
+          other->primary != camera.primary ||
+          other->camera.getPosition() != camera.camera.getPosition() ||
+          other->camera.getRotation() != camera.camera.getRotation() ||
+          other->camera.getZoom() != camera.camera.getZoom() ||
+          other->camera.getViewportSize() != camera.camera.getViewportSize() ||
+          other->camera.getNearPlane() != camera.camera.getNearPlane() ||
+          other->camera.getFarPlane() != camera.camera.getFarPlane()
+        ) {
+          mismatches++;
+        }
+      }
+
+      if (registry.storage<dg::TransformComponent>().size() !=
+          original.storage<dg::TransformComponent>().size() ||
+        registry.storage<dg::SpriteRendererComponent>().size() !=
+          original.storage<dg::SpriteRendererComponent>().size() ||
+        registry.storage<dg::CameraComponent>().size() !=
+          original.storage<dg::CameraComponent>().size()) {
+        mismatches++;
+      }
+
+      if (mismatches > 0) {
+        DG_ERROR("Scene file '{}' loads back with {} entities or components which differ from "
+          "those saved.", path.string(), mismatches);
+      }
+    }
+
+    // The million-sprite scene, written to the temporary directory.
+    static const dg::Path& getScenePath ()
+    {
+      if (s_scenePath.empty() == true) {
+        s_scenePath = std::filesystem::temp_directory_path() / SCENE_PATH;
+        dg::SceneSerializer::save(getScene(), s_scenePath);
+        checkSceneRoundTrip(s_scenePath);
+      }
+
+      return s_scenePath;
+    }
+
+    // Checks the cooked texture's second mip level against the two-by-two average of its first,
+    // logging an error if any value differs.
+    static void checkCookedMips (const dg::Path& path)
+    {
+      dg::CookedTexture cooked;
+      if (dg::TextureCooker::load(path, cooked) == false || cooked.header.mipCount < 2) {
+        DG_ERROR("Cooked texture '{}' has no mip chain to check.", path.string());
+        return;
+      }
+
+      const dg::Size channels = cooked.header.colorChannels;
+      const dg::Size width = cooked.header.width, height = cooked.header.height;
+      const dg::Size halfWidth = std::max<dg::Size>(width / 2, 1);
+      const dg::Size halfHeight = std::max<dg::Size>(height / 2, 1);
+      const dg::Uint8* level0 = cooked.payload;
+      const dg::Uint8* level1 = level0 + width * height * channels;
+
+      dg::Count mismatches = 0;
+      for (dg::Size y = 0; y < halfHeight; ++y) {
+        const dg::Size y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+        for (dg::Size x = 0; x < halfWidth; ++x) {
+          const dg::Size x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+          for (dg::Size c = 0; c < channels; ++c) {
+            const dg::Uint32 sum = level0[(y0 * width + x0) * channels + c] +
+              level0[(y0 * width + x1) * channels + c] + level0[(y1 * width + x0) * channels + c] +
+              level0[(y1 * width + x1) * channels + c];
+            if (level1[(y * halfWidth + x) * channels + c] != (sum + 2) / 4) {
+              mismatches++;
+            }
+          }
+        }
+      }
+
+      if (mismatches > 0) {
+        DG_ERROR("Cooked texture '{}' has {} values in its second mip level which are not the "
+          "average of the first.", path.string(), mismatches);
+      }
+    }
+
+    // Cook into the temporary directory, so that the other texture benchmarks keep decoding the
+    // image file.
+    static const dg::Path& getCookedPath ()
+    {
+      if (s_cookedPath.empty() == true) {
+        getRenderer();
+        s_cookedPath = std::filesystem::temp_directory_path() / COOKED_PATH;
+        dg::TextureCooker::cook(TEXTURE_PATH, s_cookedPath);
+        checkCookedMips(s_cookedPath);
+      }
+
+      return s_cookedPath;
+    }
+
+    static const dg::Path& getCompressedPath ()
+    {
+      if (s_compressedPath.empty() == true) {
+        getRenderer();
+        s_compressedPath = std::filesystem::temp_directory_path() / COMPRESSED_PATH;
+        dg::TextureCookSpecification compressedSpec;
+        compressedSpec.compress = true;
+        dg::TextureCooker::cook(TEXTURE_PATH, s_compressedPath, compressedSpec);
+      }
+
+      return s_compressedPath;
+    }
+
+    static void submitQuads (const dg::RenderDrawSpecification2D& spec)
+    {
+      auto& renderer = getRenderer();
+      renderer.beginScene2D(dg::Matrix4f { 1.0f });
+      for (dg::Index i = 0; i < QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        renderer.submitQuad2D({ x, y, 0.0f }, { 1.0f, 1.0f }, x, spec);
+      }
+      renderer.endScene2D();
+    }
+
+    static dg::Matrix4f makeQuadMatrix (dg::Float32 x, dg::Float32 y)
+    {
+      return
+        glm::translate(dg::Matrix4f { 1.0f }, { x, y, 0.0f }) *
+        glm::rotate(dg::Matrix4f { 1.0f }, glm::radians(x), { 0.0f, 0.0f, 1.0f }) *
+        glm::scale(dg::Matrix4f { 1.0f }, { 1.0f, 1.0f, 1.0f });
+    }
+
+  }
+
+  void registerCoreBenchmarks (BenchmarkRunner& runner)
+  {
+    runner.add("core/FileLexer_loadFromFile", 1, [] ()
+    {
+      dg::FileLexer lexer { Private::SHADER_PATH };
+      Private::s_sink = lexer.hasMoreTokens();
+    });
+
+    runner.add("core/formatString", Private::FORMAT_COUNT, [] ()
+    {
+      dg::Size length = 0;
+      for (dg::Index i = 0; i < Private::FORMAT_COUNT; ++i) {
+        length += dg::formatString("Quad {} at ({}, {}) - {}", i, 1.5f, -2.5f, "visible").size();
+      }
+      Private::s_sink = length;
+    });
+
+    runner.add("core/streamFormatted", Private::FORMAT_COUNT, [] ()
+    {
+      std::stringstream stream;
+      for (dg::Index i = 0; i < Private::FORMAT_COUNT; ++i) {
+        dg::streamFormatted(stream, "Quad {} at ({}, {}) - {}\n", i, 1.5f, -2.5f, "visible");
+      }
+      Private::s_sink = stream.tellp();
+    });
+  }
+
+  void registerEventBenchmarks (BenchmarkRunner& runner)
+  {
+    runner.add("events/pushEvent_poll", Private::EVENT_COUNT, [] ()
+    {
+      for (dg::Index i = 0; i < Private::EVENT_COUNT; ++i) {
+        dg::EventBus::pushEvent<dg::WindowResizeEvent>(static_cast<dg::Uint32>(i), 1u);
+      }
+      dg::EventBus::poll();
+      Private::s_sink = Private::s_listener.m_count;
+    }, Private::startEventBus);
+  }
+
+  void registerMathBenchmarks (BenchmarkRunner& runner)
+  {
+    // The corner math alone, without the vertex submission around it.
+    runner.add("math/Matrix4f_quadCorners", Private::QUAD_COUNT, [] ()
+    {
+      const dg::Vector4f corner { 0.5f, 0.5f, 0.0f, 1.0f };
+      dg::Float32 sum = 0.0f;
+      for (dg::Index i = 0; i < Private::QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        const dg::Matrix4f transform = Private::makeQuadMatrix(x, y);
+        sum += (transform * corner).x + (transform * -corner).y;
+      }
+      Private::s_sink = static_cast<dg::Size>(sum);
+    });
+
+    runner.add("math/Transform2D_quadCorners", Private::QUAD_COUNT, [] ()
+    {
+      const dg::Vector2f corner { 0.5f, 0.5f };
+      dg::Float32 sum = 0.0f;
+      for (dg::Index i = 0; i < Private::QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        const dg::Transform2D transform =
+          dg::Transform2D::fromPositionRotationScale({ x, y }, x);
+        sum += transform.transformPoint(corner).x + transform.transformPoint(-corner).y;
+      }
+      Private::s_sink = static_cast<dg::Size>(sum);
+    });
+
+    // The field of boxes, queried one at a time with the shapes' own functions, and then in
+    // batches over the same boxes stored one array per coordinate.
+    runner.add("math/AABB2D_overlapLoop", Private::SHAPE_COUNT, [] ()
+    {
+      const dg::AABB2D query { { 100.0f, 20.0f }, { 140.0f, 60.0f } };
+      Private::s_hits.clear();
+      for (dg::Index i = 0; i < Private::s_boxList.size(); ++i) {
+        if (query.overlaps(Private::s_boxList[i]) == true) {
+          Private::s_hits.push_back(i);
+        }
+      }
+      Private::s_sink = Private::s_hits.size();
+    }, Private::buildBoxes);
+
+    runner.add("math/ShapeQueries2D_overlapAABB", Private::SHAPE_COUNT, [] ()
+    {
+      const dg::AABB2D query { { 100.0f, 20.0f }, { 140.0f, 60.0f } };
+      Private::s_sink = dg::ShapeQueries2D::overlapping(query, Private::s_boxes, Private::s_hits);
+    }, Private::buildBoxes);
+
+    runner.add("math/ShapeQueries2D_overlapOBB", Private::SHAPE_COUNT, [] ()
+    {
+      const dg::OBB2D query = dg::OBB2D::fromTransform(
+        dg::Transform2D::fromPositionRotationScale({ 120.0f, 40.0f }, 30.0f, { 40.0f, 20.0f }));
+      Private::s_sink = dg::ShapeQueries2D::overlapping(query, Private::s_boxes, Private::s_hits);
+    }, Private::buildBoxes);
+
+    runner.add("math/ShapeQueries2D_containing", Private::SHAPE_COUNT, [] ()
+    {
+      Private::s_sink = dg::ShapeQueries2D::containing({ 120.1f, 40.2f }, Private::s_boxes,
+        Private::s_hits);
+    }, Private::buildBoxes);
+
+    runner.add("math/Ray2D_castLoop", Private::SHAPE_COUNT, [] ()
+    {
+      const dg::Ray2D ray { { -1.0f, 0.5f }, glm::normalize(dg::Vector2f { 10.0f, 1.0f }) };
+      dg::Float32 nearest = 1000.0f;
+      for (const auto& box : Private::s_boxList) {
+        dg::Float32 distance = 0.0f;
+        if (ray.cast(box, nearest, distance) == true) {
+          nearest = distance;
+        }
+      }
+      Private::s_sink = static_cast<dg::Size>(nearest);
+    }, Private::buildBoxes);
+
+    runner.add("math/ShapeQueries2D_castRayNearest", Private::SHAPE_COUNT, [] ()
+    {
+      const dg::Ray2D ray { { -1.0f, 0.5f }, glm::normalize(dg::Vector2f { 10.0f, 1.0f }) };
+      dg::RayHit2D nearest;
+      dg::ShapeQueries2D::castRayNearest(ray, 1000.0f, Private::s_boxes, nearest);
+      Private::s_sink = nearest.index;
+    }, Private::buildBoxes);
+  }
+
+  void registerRendererBenchmarks (BenchmarkRunner& runner)
+  {
+    runner.add("renderer/submitQuad2D", Private::QUAD_COUNT, [] ()
+    {
+      Private::submitQuads({});
+    }, Private::getRenderer);
+
+    runner.add("renderer/submitQuad2D_textured", Private::QUAD_COUNT, [] ()
+    {
+      dg::RenderDrawSpecification2D spec;
+      spec.texture = Private::getTexture();
+      Private::submitQuads(spec);
+    }, Private::getTexture);
+
+    // The same quads as above, placed with a model matrix built and applied the old way, to
+    // compare against the affine transformation which the position overload now goes through.
+    runner.add("renderer/submitQuad2D_matrix", Private::QUAD_COUNT, [] ()
+    {
+      auto& renderer = Private::getRenderer();
+      renderer.beginScene2D(dg::Matrix4f { 1.0f });
+      for (dg::Index i = 0; i < Private::QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        renderer.submitQuad2D(Private::makeQuadMatrix(x, y), {});
+      }
+      renderer.endScene2D();
+    }, Private::getRenderer);
+
+    // The same quads again, seen by a camera which covers a quarter of them, so that the rest are
+    // culled before their vertices are written.
+    runner.add("renderer/submitQuad2D_camera", Private::QUAD_COUNT, [] ()
+    {
+      auto& renderer = Private::getRenderer();
+      dg::OrthographicCamera2D camera { { 50.0f, 50.0f } };
+      camera.setPosition({ 25.0f, 25.0f });
+      renderer.beginScene2D(camera);
+      for (dg::Index i = 0; i < Private::QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        renderer.submitQuad2D({ x, y, 0.0f }, { 1.0f, 1.0f }, x);
+      }
+      renderer.endScene2D();
+      Private::s_sink = renderer.getCulledCount2D();
+    }, Private::getRenderer);
+
+    // Every frame of the sheet shares its texture, so the quads should all land in one batch.
+    runner.add("renderer/submitQuad2D_spriteSheet", Private::QUAD_COUNT, [] ()
+    {
+      auto& renderer = Private::getRenderer();
+      const auto& frames = Private::getFrames();
+      dg::RenderDrawSpecification2D spec;
+      renderer.beginScene2D(dg::Matrix4f { 1.0f });
+      for (dg::Index i = 0; i < Private::QUAD_COUNT; ++i) {
+        dg::Float32 x = static_cast<dg::Float32>(i % 100);
+        dg::Float32 y = static_cast<dg::Float32>(i / 100);
+        spec.subTexture = frames[i % frames.size()];
+        renderer.submitQuad2D({ x, y, 0.0f }, { 1.0f, 1.0f }, x, spec);
+      }
+      renderer.endScene2D();
+      Private::s_sink = renderer.getBatchCount2D();
+    }, Private::getFrames);
+  }
+
+  void registerGraphicsBenchmarks (BenchmarkRunner& runner)
+  {
+    // A marquee selection over the entity ID attachment, read in one transfer and polled until its
+    // IDs arrive.
+    runner.add("graphics/FrameBuffer_readPixelsAsync", 1, [] ()
+    {
+      auto readback = Private::getTarget()->readPixelsAsync(1, { 32, 32 }, { 256, 256 });
+      while (readback->poll() == false) {}
+      Private::s_sink = readback->getDistinctValues().size();
+    }, Private::getTarget);
+
+    // A viewport panel being dragged larger, one pixel a frame. With headroom, most frames re-use
+    // the pooled target rather than rebuilding it.
+    runner.add("graphics/RenderTargetPool_resize", Private::RESIZE_COUNT, [] ()
+    {
+      dg::FrameBufferSpecification spec = Private::getTarget()->getSpecification();
+      for (dg::Index i = 0; i < Private::RESIZE_COUNT; ++i) {
+        spec.size = { 640 + i, 360 + i };
+        auto target = dg::RenderTargetPool::acquire(spec);
+        dg::RenderTargetPool::release(target);
+      }
+      Private::s_sink = dg::RenderTargetPool::getStats().missCount;
+    }, Private::getTarget);
+
+    // A bloom chain built into the viewport's target every frame, with a debug view which nothing
+    // reads. The debug pass is culled, and the blur targets share pooled frame buffers.
+    runner.add("graphics/RenderGraph_postChain", 1, [] ()
+    {
+      dg::FrameBufferSpecification sceneSpec;
+      sceneSpec.size = { 640, 360 };
+      sceneSpec.attachmentSpec = {
+        dg::FrameBufferTextureFormat::ColorRGBA8,
+        dg::FrameBufferTextureFormat::Depth
+      };
+
+      dg::FrameBufferSpecification effectSpec;
+      effectSpec.size = { 320, 180 };
+      effectSpec.attachmentSpec = { dg::FrameBufferTextureFormat::ColorRGBA8 };
+
+      dg::RenderGraph graph;
+      dg::RenderGraphResource viewport = graph.importTarget("viewport", Private::getTarget());
+      dg::RenderGraphResource scene = 0, bright = 0, blurX = 0, blurY = 0;
+      graph.addPass("scene", [&] (dg::RenderGraphBuilder& builder)
+      {
+        scene = builder.create("scene", sceneSpec);
+        builder.write(scene);
+      }, nullptr);
+      graph.addPass("debug", [&] (dg::RenderGraphBuilder& builder)
+      {
+        builder.read(scene);
+        builder.write(builder.create("debug", sceneSpec));
+      }, nullptr);
+      graph.addPass("bright", [&] (dg::RenderGraphBuilder& builder)
+      {
+        builder.read(scene);
+        bright = builder.create("bright", effectSpec);
+        builder.write(bright);
+      }, nullptr);
+      graph.addPass("blurX", [&] (dg::RenderGraphBuilder& builder)
+      {
+        builder.read(bright);
+        blurX = builder.create("blurX", effectSpec);
+        builder.write(blurX);
+      }, nullptr);
+      graph.addPass("blurY", [&] (dg::RenderGraphBuilder& builder)
+      {
+        builder.read(blurX);
+        blurY = builder.create("blurY", effectSpec);
+        builder.write(blurY);
+      }, nullptr);
+      graph.addPass("composite", [&] (dg::RenderGraphBuilder& builder)
+      {
+        builder.read(scene);
+        builder.read(blurY);
+        builder.write(viewport);
+      }, nullptr);
+
+      graph.execute();
+      Private::s_sink = graph.getStats().peakTransientByteCount;
+    }, Private::getTarget);
+
+    runner.add("graphics/ThreadedRenderBackend_frame", Private::COMMAND_COUNT, [] ()
+    {
+      auto& backend = Private::getThreadedBackend();
+      dg::Float32 vertices[16] = {};
+      for (dg::Index i = 0; i < Private::COMMAND_COUNT; i += 2) {
+        backend.uploadBuffer(GL_ARRAY_BUFFER, 1, vertices, sizeof(vertices));
+        backend.drawIndexed(GL_TRIANGLES, 6, GL_UNSIGNED_INT);
+      }
+      backend.endFrame();
+    }, Private::getThreadedBackend);
+
+    runner.add("graphics/TextureManager_loadAsync", 1, [] ()
+    {
+      if (dg::TextureManager::contains(Private::TEXTURE_PATH)) {
+        dg::TextureManager::remove(Private::TEXTURE_PATH);
+      }
+      auto texture = dg::TextureManager::loadAsync(Private::TEXTURE_PATH);
+      dg::AssetLoader::waitAll();
+      dg::TextureUploadQueue::flush();
+      Private::s_sink = texture->isValid();
+    }, Private::startAssetLoader);
+
+    runner.add("graphics/Texture_loadCooked", 1, [] ()
+    {
+      auto texture = dg::Texture::make(Private::getCookedPath());
+      dg::TextureUploadQueue::flush();
+      Private::s_sink = texture->isValid();
+    }, Private::getCookedPath);
+
+    runner.add("graphics/Texture_loadCompressed", 1, [] ()
+    {
+      auto texture = dg::Texture::make(Private::getCompressedPath());
+      Private::s_sink = texture->isValid();
+    }, Private::getCompressedPath);
+
+    runner.add("graphics/Texture_loadDecoded", 1, [] ()
+    {
+      auto texture = dg::Texture::make(dg::Path { Private::TEXTURE_PATH });
+      dg::TextureUploadQueue::flush();
+      Private::s_sink = texture->isValid();
+    }, Private::getRenderer);
+
+    runner.add("graphics/Texture_loadMipmapped", 1, [] ()
+    {
+      dg::TextureSpecification spec;
+      spec.minify = dg::TextureFilterMode::LinearMipmapLinear;
+      spec.mipmaps = true;
+      auto texture = dg::Texture::make(dg::Path { Private::TEXTURE_PATH }, spec);
+      dg::TextureUploadQueue::flush();
+      Private::s_sink = texture->getLevelCount();
+    }, Private::getRenderer);
+
+    runner.add("graphics/ColorPalette_loadFromFile", 1, [] ()
+    {
+      dg::ColorPalette palette;
+      palette.loadFromFile(Private::PALETTE_PATH);
+      Private::s_sink = palette.getColorCount();
+    });
+
+    runner.add("graphics/TextureManager_hit", Private::LOOKUP_COUNT, [] ()
+    {
+      for (dg::Index i = 0; i < Private::LOOKUP_COUNT; ++i) {
+        Private::s_sink = dg::TextureManager::getOrEmplace(Private::TEXTURE_PATH)->isValid();
+      }
+    }, Private::getRenderer);
+
+    runner.add("graphics/TextureManager_miss", 1, [] ()
+    {
+      if (dg::TextureManager::contains(Private::TEXTURE_PATH)) {
+        dg::TextureManager::remove(Private::TEXTURE_PATH);
+      }
+      auto texture = dg::TextureManager::getOrEmplace(Private::TEXTURE_PATH);
+      dg::TextureUploadQueue::flush();
+      Private::s_sink = texture->isValid();
+    }, Private::getRenderer);
+  }
+
+  void registerSceneBenchmarks (BenchmarkRunner& runner)
+  {
+    // The million-sprite scene is only built if one of these benchmarks is run.
+    const auto prepareScene = [] ()
+    {
+      Private::getRenderer();
+      Private::getScene();
+    };
+
+    runner.add("scene/Scene_render", Private::ENTITY_COUNT, [] ()
+    {
+      auto& renderer = Private::getRenderer();
+      Private::getScene().render(renderer);
+      Private::s_sink = renderer.getVertexCount2D();
+    }, prepareScene);
+
+    // The same sprites submitted one at a time from a view, as a layer would by hand.
+    runner.add("scene/Scene_renderPerEntity", Private::ENTITY_COUNT, [] ()
+    {
+      auto& renderer = Private::getRenderer();
+      auto& scene = Private::getScene();
+      auto& registry = scene.getRegistry();
+      auto camera = scene.getPrimaryCamera();
+      renderer.beginScene2D(camera.getComponent<dg::CameraComponent>().camera);
+      auto view = registry.view<dg::TransformComponent, dg::SpriteRendererComponent>();
+      for (auto [handle, transform, sprite] : view.each()) {
+        dg::RenderDrawSpecification2D spec;
+        spec.color = sprite.color;
+        spec.texture = sprite.texture;
+        spec.entityId = static_cast<dg::Int32>(entt::to_entity(handle));
+        renderer.submitQuad2D(transform.transform, transform.depth, spec);
+      }
+      renderer.endScene2D();
+      Private::s_sink = renderer.getVertexCount2D();
+    }, prepareScene);
+
+    runner.add("scene/SystemScheduler_frame", Private::ENTITY_COUNT, [] ()
+    {
+      Private::getScheduler().run(Private::getScene(), 0.0f);
+      Private::s_sink = Private::s_farCount;
+    }, [] ()
+    {
+      Private::getScene();
+      Private::getScheduler();
+    });
+
+    // The same three systems as plain loops, one after the other on this thread.
+    runner.add("scene/SystemScheduler_serialBaseline", Private::ENTITY_COUNT, [] ()
+    {
+      auto& registry = Private::getScene().getRegistry();
+      for (auto [handle, tc] : registry.view<dg::TransformComponent>().each()) {
+        tc.transform.origin.x += 0.0f;
+      }
+      for (auto [handle, sprite] : registry.view<dg::SpriteRendererComponent>().each()) {
+        sprite.color.alpha = 1.0f - sprite.color.alpha * 0.5f;
+      }
+      Private::s_farCount = 0;
+      for (auto [handle, tc] : registry.view<dg::TransformComponent>().each()) {
+        if (tc.transform.origin.x > 500.0f) {
+          Private::s_farCount.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      Private::s_sink = Private::s_farCount;
+    }, Private::getScene);
+
+    // The million-sprite scene written to, and read back from, a scene file.
+    runner.add("scene/SceneSerializer_save", Private::ENTITY_COUNT, [] ()
+    {
+      Private::s_sink = dg::SceneSerializer::save(Private::getScene(), Private::getScenePath());
+    }, Private::getScenePath);
+
+    runner.add("scene/SceneSerializer_load", Private::ENTITY_COUNT, [] ()
+    {
+      auto scene = dg::SceneSerializer::load(Private::getScenePath());
+      Private::s_sink = (scene != nullptr) ? scene->getEntityCount() : 0;
+    }, Private::getScenePath);
+  }
+
+  void registerEngineBenchmarks (BenchmarkRunner& runner)
+  {
+    registerCoreBenchmarks(runner);
+    registerEventBenchmarks(runner);
+    registerMathBenchmarks(runner);
+    registerRendererBenchmarks(runner);
+    registerGraphicsBenchmarks(runner);
+    registerSceneBenchmarks(runner);
+  }
+
+  void releaseEngineBenchmarks ()
+  {
+    // Graphics objects release their handles through the render backend, so they must be gone
+    // before the backend is.
+    dg::AssetLoader::shutdown();
+    dg::TextureManager::clear();
+
+    std::error_code error;
+    for (const auto& path : { Private::s_cookedPath, Private::s_compressedPath,
+      Private::s_scenePath }) {
+      if (path.empty() == false) {
+        std::filesystem::remove(path, error);
+      }
+    }
+
+    dg::ShaderManager::clear();
+    Private::s_scheduler.reset();
+    Private::s_scene.reset();
+    Private::s_frames.clear();
+    Private::s_texture.reset();
+    Private::s_target.reset();
+    Private::s_renderer.reset();
+    Private::s_threadedBackend.reset();
+    dg::RenderInterface::shutdown();
+  }
+
+}
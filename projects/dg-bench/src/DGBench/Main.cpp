@@ -0,0 +1,60 @@
+/** @file DGBench/Main.cpp */
+
+#include <DGBench/Benchmark.hpp>
+
+/**
+ * Usage: dg-bench [--warmup N] [--iterations N] [--filter TEXT] [--output FILE.json]
+ *                 [--baseline FILE.json] [--threshold FRACTION]
+ *
+ * Run from the repository root, so that the `assets` directory can be found. If a baseline is
+ * given, the program exits with a non-zero status when any benchmark's median time has grown by
+ * more than the threshold (ten percent by default).
+ */
+int main (int argc, char** argv)
+{
+  dg::Logging::initialize();
+
+  dgbench::BenchmarkSpecification spec;
+  dg::Path outputPath = "";
+  dg::Path baselinePath = "";
+  dg::Float64 threshold = 0.1;
+
+  for (int i = 1; i < argc; ++i) {
+    dg::StringView arg = argv[i];
+    if (i + 1 >= argc) {
+      DG_CRIT("Missing value for argument '{}'.", arg);
+      return 1;
+    }
+
+    if (arg == "--warmup") { spec.warmupIterations = std::stoul(argv[++i]); }
+    else if (arg == "--iterations") { spec.iterations = std::stoul(argv[++i]); }
+    else if (arg == "--filter") { spec.filter = argv[++i]; }
+    else if (arg == "--output") { outputPath = argv[++i]; }
+    else if (arg == "--baseline") { baselinePath = argv[++i]; }
+    else if (arg == "--threshold") { threshold = std::stod(argv[++i]); }
+    else {
+      DG_CRIT("Unknown argument '{}'.", arg);
+      return 1;
+    }
+  }
+
+  dgbench::BenchmarkRunner runner { spec };
+  dgbench::registerEngineBenchmarks(runner);
+  runner.run();
+  dgbench::releaseEngineBenchmarks();
+
+  if (outputPath.empty() == false && runner.writeJson(outputPath) == false) {
+    return 1;
+  }
+
+  if (baselinePath.empty() == false) {
+    dg::Int32 regressions = runner.compareToBaseline(baselinePath, threshold);
+    if (regressions != 0) {
+      DG_CRIT("{} benchmark regression(s) found against baseline '{}'.",
+        regressions < 0 ? 0 : regressions, baselinePath.string());
+      return 1;
+    }
+  }
+
+  return 0;
+}
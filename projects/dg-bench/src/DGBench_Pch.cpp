@@ -0,0 +1,3 @@
+/** @file DGBench_Pch.cpp */
+
+#include <DGBench_Pch.hpp>
@@ -0,0 +1,8 @@
+/** @file DGCook_Pch.hpp */
+
+#ifndef DGCOOK_PCH_HPP
+#define DGCOOK_PCH_HPP
+
+#include <DG.hpp>
+
+#endif
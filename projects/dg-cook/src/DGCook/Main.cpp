@@ -0,0 +1,42 @@
+/** @file DGCook/Main.cpp */
+
+#include <DGCook_Pch.hpp>
+
+/**
+ * Usage: dg-cook [--compressed] DIRECTORY
+ *
+ * Cooks every out-of-date image file in the given directory, and its sub-directories, into a
+ * `.dgtex` file, with its full mip chain. With `--compressed`, RGB and RGBA images are also
+ * compressed into BC1 and BC3 blocks.
+ */
+int main (int argc, char** argv)
+{
+  dg::Logging::initialize();
+
+  dg::TextureCookSpecification spec;
+  dg::Path directory = "";
+
+  for (int i = 1; i < argc; ++i) {
+    dg::StringView arg = argv[i];
+    if (arg == "--compressed") { spec.compress = true; }
+    else if (arg.starts_with("--") == false && directory.empty() == true) { directory = arg; }
+    else {
+      DG_CRIT("Unknown argument '{}'.", arg);
+      return 1;
+    }
+  }
+
+  if (directory.empty() == true) {
+    DG_CRIT("Usage: dg-cook [--compressed] DIRECTORY");
+    return 1;
+  }
+
+  if (std::filesystem::is_directory(directory) == false) {
+    DG_CRIT("Could not find directory '{}'.", directory.string());
+    return 1;
+  }
+
+  dg::Count count = dg::TextureCooker::cookDirectory(directory, spec);
+  DG_INFO("Cooked {} texture(s).", count);
+  return 0;
+}
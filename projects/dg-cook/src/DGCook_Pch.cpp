@@ -0,0 +1,3 @@
+/** @file DGCook_Pch.cpp */
+
+#include <DGCook_Pch.hpp>
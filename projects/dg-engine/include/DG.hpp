@@ -4,13 +4,16 @@
 
 // Core
 #include <DG/Core/Application.hpp>
+#include <DG/Core/AssetLoader.hpp>
 #include <DG/Core/Clock.hpp>
 #include <DG/Core/FileIo.hpp>
 #include <DG/Core/FileLexer.hpp>
 #include <DG/Core/Input.hpp>
 #include <DG/Core/LayerStack.hpp>
+#include <DG/Core/MappedFile.hpp>
 #include <DG/Core/Logging.hpp>
 #include <DG/Core/String.hpp>
+#include <DG/Core/ThreadPool.hpp>
 
 // Events
 #include <DG/Events/EventEmitter.hpp>
@@ -20,6 +23,35 @@
 // Graphics
 #include <DG/Graphics/Color.hpp>
 #include <DG/Graphics/ColorPalette.hpp>
+#include <DG/Graphics/DynamicResolution.hpp>
+#include <DG/Graphics/FrameCapture.hpp>
+#include <DG/Graphics/OrthographicCamera2D.hpp>
+#include <DG/Graphics/PixelReadback.hpp>
+#include <DG/Graphics/RenderGraph.hpp>
+#include <DG/Graphics/RenderPass.hpp>
+#include <DG/Graphics/RenderTargetPool.hpp>
 #include <DG/Graphics/Shader.hpp>
+#include <DG/Graphics/ShaderCache.hpp>
+#include <DG/Graphics/ShaderVariantSet.hpp>
+#include <DG/Graphics/SubTexture.hpp>
 #include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureContainer.hpp>
+#include <DG/Graphics/TextureCooker.hpp>
+#include <DG/Graphics/TextureResidency.hpp>
 #include <DG/Graphics/VertexArray.hpp>
+
+// Math
+#include <DG/Math/AABB2D.hpp>
+#include <DG/Math/Circle2D.hpp>
+#include <DG/Math/OBB2D.hpp>
+#include <DG/Math/Ray2D.hpp>
+#include <DG/Math/ShapeArrays2D.hpp>
+#include <DG/Math/ShapeQueries2D.hpp>
+#include <DG/Math/Transform2D.hpp>
+
+// Scene
+#include <DG/Scene/Components.hpp>
+#include <DG/Scene/Entity.hpp>
+#include <DG/Scene/Scene.hpp>
+#include <DG/Scene/SceneSerializer.hpp>
+#include <DG/Scene/SystemScheduler.hpp>
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <deque>
 #include <unordered_map>
 #include <algorithm>
 #include <utility>
@@ -15,6 +16,11 @@
 #include <chrono>
 #include <filesystem>
 #include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <future>
 
 // C Includes
 #include <cstdlib>
@@ -22,6 +28,7 @@
 #include <ctime>
 #include <cstdint>
 #include <cctype>
+#include <cstring>
 
 // Filesystem Namespace
 namespace fs = std::filesystem;
@@ -24,6 +24,12 @@ namespace dg
      */
     Float32 framerate = 60.0f;
 
+    /**
+     * @brief The number of worker threads used to load assets in the background. If zero, the
+     *        number is chosen from the number of hardware threads.
+     */
+    Count assetWorkerCount = 0;
+
     /**
      * @brief The application window's specification.
      */
@@ -87,6 +93,16 @@ namespace dg
      */
     static Renderer& getRenderer ();
 
+    /**
+     * @brief Retrieves the off-screen @a `FrameBuffer` into which a headless application renders.
+     * 
+     * @return  A pointer to the headless frame buffer if the application window is headless;
+     *          @a `nullptr` otherwise.
+     * 
+     * @throw   @a `std::runtime_error` if the application instance was not yet created.
+     */
+    static const Ref<FrameBuffer>& getHeadlessTarget ();
+
     /**
      * @brief Starts the client application's loop.
      * 
@@ -156,6 +172,19 @@ namespace dg
      */
     Scope<Renderer> m_renderer = nullptr;
 
+    /**
+     * @brief Points to the off-screen @a `FrameBuffer` used in place of the window's back buffer
+     *        when the application window is headless.
+     */
+    Ref<FrameBuffer> m_headlessTarget = nullptr;
+
+    /**
+     * @brief Points to the @a `FrameBuffer` which the 2D scene is drawn into, at the resolution
+     *        picked by the @a `DynamicResolution` helper, when it is enabled and the application
+     *        window is not headless.
+     */
+    Ref<FrameBuffer> m_sceneTarget = nullptr;
+
     /**
      * @brief Indicates whether or not the application should continue running.
      */
@@ -0,0 +1,150 @@
+/** @file DG/Core/AssetLoader.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+#include <DG/Core/ThreadPool.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `AssetLoadProgress` struct reports how far along the asset loads requested since
+   *        the asset loader was last idle have come.
+   */
+  struct AssetLoadProgress
+  {
+    Count requested = 0;
+    Count completed = 0;
+    Count failed = 0;
+
+    /**
+     * @brief   Retrieves the fraction of requested loads which have finished, whether or not they
+     *          succeeded.
+     *
+     * @return  A value between @a `0.0` and @a `1.0`.
+     */
+    inline Float32 getFraction () const
+    {
+      if (requested == 0) { return 1.0f; }
+      return static_cast<Float32>(completed + failed) / static_cast<Float32>(requested);
+    }
+
+    /**
+     * @brief   Retrieves whether or not every requested load has finished.
+     *
+     * @return  @a `true` if nothing is left to load; @a `false` otherwise.
+     */
+    inline Bool isDone () const
+    {
+      return completed + failed >= requested;
+    }
+  };
+
+  /**
+   * @brief The @a `AssetLoader` class is a static helper class which reads and decodes asset files
+   *        on a pool of worker threads.
+   *
+   *        Each load is split in two: a load function, which is run on a worker thread and must
+   *        not touch the graphics card or any asset already in use; and a finalize function, which
+   *        is run on the main thread by @a `update` once the load function has finished, and
+   *        creates the asset's graphics objects.
+   */
+  class AssetLoader
+  {
+  public:
+
+    /**
+     * @brief Initializes the asset loader, starting its worker threads.
+     *
+     * @param workerCount The number of worker threads to start. If zero, the number is chosen from
+     *                    the number of hardware threads.
+     */
+    static void initialize (Count workerCount = 0);
+
+    /**
+     * @brief Stops the asset loader's worker threads, discarding any loads which have not been
+     *        finalized.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief Submits an asset load. If the asset loader is not initialized, the load is carried out
+     *        and finalized right away, on the calling thread.
+     *
+     * @param key       A name identifying the load, such as the asset's filename.
+     * @param load      The function to run on a worker thread. Returns @a `false` on failure.
+     * @param finalize  The function to run on the main thread once @a `load` succeeds. Returns
+     *                  @a `false` on failure.
+     */
+    static void submit (const String& key, LFunction<Bool> load, LFunction<Bool> finalize);
+
+    /**
+     * @brief Finalizes every load whose load function has finished. Call this once per frame, on
+     *        the main thread.
+     */
+    static void update ();
+
+    /**
+     * @brief Waits for the load with the given key to finish, then finalizes it. Does nothing if
+     *        no such load is in progress.
+     *
+     * @param key The name identifying the load.
+     */
+    static void wait (const String& key);
+
+    /**
+     * @brief Waits for every load to finish, then finalizes them.
+     */
+    static void waitAll ();
+
+    /**
+     * @brief   Retrieves whether or not a load with the given key is in progress.
+     *
+     * @param   key The name identifying the load.
+     *
+     * @return  @a `true` if the load has not been finalized yet; @a `false` otherwise.
+     */
+    static Bool isLoading (const String& key);
+
+    /**
+     * @brief   Retrieves the progress of the loads requested since the asset loader was last idle.
+     *
+     * @return  The current @a `AssetLoadProgress`.
+     */
+    static const AssetLoadProgress& getProgress ();
+
+    /**
+     * @brief   Submits loads for every asset listed in the given manifest file.
+     *
+     *          Each line of a manifest names an asset type - @a `texture`, @a `shader` or
+     *          @a `palette` - followed by the asset's relative filename. Blank lines, and lines
+     *          starting with @a `#`, are skipped.
+     *
+     * @param   path  The path to the manifest file.
+     *
+     * @return  @a `true` if the manifest was read and every line was valid; @a `false` otherwise.
+     */
+    static Bool loadManifest (const Path& path);
+
+  private:
+    struct Job
+    {
+      String              key;
+      std::future<Bool>   loaded;
+      LFunction<Bool>     finalize;
+    };
+
+    /**
+     * @brief Finalizes the given job, whose load function has finished.
+     */
+    static void finish (Job& job);
+
+  private:
+    static Scope<ThreadPool>  s_pool;
+    static Collection<Job>    s_jobs;
+    static AssetLoadProgress  s_progress;
+
+  };
+
+}
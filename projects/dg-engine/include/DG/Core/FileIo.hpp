@@ -24,6 +24,17 @@ namespace dg
      */
     static Path getAbsolute (const Path& path);
 
+    /**
+     * @brief Retrieves the lexically normal form of the given file path, relative to the working
+     *        directory - the inverse of @a `getAbsolute`.
+     * 
+     * @param path  The filepath to be made relative.
+     *  
+     * @return  The relative, lexically-normal file path; or the absolute path, if the file path
+     *          cannot be reached from the working directory (eg. it is on another drive).
+     */
+    static Path getRelative (const Path& path);
+
     /**
      * @brief Attempts to load a text file with the given filename.
      * 
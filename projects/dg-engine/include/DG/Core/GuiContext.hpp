@@ -4,6 +4,8 @@
 
 #include <DG_Pch.hpp>
 
+struct ImGuiContext;
+
 namespace dg
 {
 
@@ -62,6 +64,8 @@ namespace dg
     void end () const;
 
   private:
+    ImGuiContext* m_context = nullptr;
+    ImGuiContext* m_renderContext = nullptr;
     Bool m_docking = false;
     Bool m_viewport = false;
 
@@ -89,6 +89,7 @@ namespace dg
     template <typename... Ts>
     inline void info (const char* format, Ts... args)
     {
+      std::lock_guard lock { m_mutex };
       streamFormatted(m_cout, "[{} | Info]     ", m_name);
       streamFormatted(m_cout, format, args...);
       m_cout << "\n";
@@ -105,6 +106,7 @@ namespace dg
     template <typename... Ts>
     inline void warning (const char* format, Ts... args)
     {
+      std::lock_guard lock { m_mutex };
       streamFormatted(m_cerr, "[{} | Warning]  ", m_name);
       streamFormatted(m_cerr, format, args...);
       m_cerr << "\n";
@@ -121,6 +123,7 @@ namespace dg
     template <typename... Ts>
     inline void error (const char* format, Ts... args)
     {
+      std::lock_guard lock { m_mutex };
       streamFormatted(m_cerr, "[{} | Error]    ", m_name);
       streamFormatted(m_cerr, format, args...);
       m_cerr << std::endl;
@@ -137,6 +140,7 @@ namespace dg
     template <typename... Ts>
     inline void critical (const char* format, Ts... args)
     {
+      std::lock_guard lock { m_mutex };
       streamFormatted(m_cerr, "[{} | Critical] ", m_name);
       streamFormatted(m_cerr, format, args...);
       m_cerr << std::endl;
@@ -165,6 +169,11 @@ namespace dg
      *        object.
      */
     bool m_oneStream = false;
+
+    /**
+     * @brief Keeps messages logged from different threads from being interleaved.
+     */
+    std::mutex m_mutex;
     
   };
 
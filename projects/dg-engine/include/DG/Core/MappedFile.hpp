@@ -0,0 +1,78 @@
+/** @file DG/Core/MappedFile.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `MappedFile` class maps a file's contents into memory for reading. Pages of the
+   *        file are read in by the operating system as they are first touched, so nothing is
+   *        copied up front.
+   *
+   *        On systems where memory mapping is not supported, the file is read into memory instead.
+   */
+  class MappedFile
+  {
+  public:
+    MappedFile () = default;
+    MappedFile (const MappedFile&) = delete;
+    MappedFile& operator= (const MappedFile&) = delete;
+    ~MappedFile ();
+
+    /**
+     * @brief   Creates a new @a `MappedFile` mapping the file at the given path.
+     *
+     * @param   path  The path to the file to map.
+     *
+     * @return  A shared pointer to the new @a `MappedFile`, or @a `nullptr` if the file could not
+     *          be mapped.
+     */
+    static Ref<MappedFile> make (const Path& path);
+
+    /**
+     * @brief   Attempts to map the file at the given path, un-mapping any file already mapped.
+     *
+     * @param   path  The path to the file to map.
+     *
+     * @return  @a `true` if the file is mapped successfully; @a `false` otherwise.
+     */
+    Bool open (const Path& path);
+
+    /**
+     * @brief Un-maps the mapped file, if there is one.
+     */
+    void close ();
+
+    /**
+     * @brief   Retrieves the mapped file's contents.
+     *
+     * @return  A pointer to the first byte of the file, or @a `nullptr` if no file is mapped.
+     */
+    const Uint8* getData () const;
+
+    /**
+     * @brief   Retrieves the size of the mapped file.
+     *
+     * @return  The size of the file, in bytes.
+     */
+    Size getSize () const;
+
+    /**
+     * @brief   Retrieves whether or not a file is mapped.
+     *
+     * @return  @a `true` if a file is mapped; @a `false` otherwise.
+     */
+    Bool isOpen () const;
+
+  private:
+    const Uint8*      m_data = nullptr;
+    Size              m_size = 0;
+    Collection<Uint8> m_buffer;
+    Bool              m_open = false;
+
+  };
+
+}
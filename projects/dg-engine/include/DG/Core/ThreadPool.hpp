@@ -0,0 +1,83 @@
+/** @file DG/Core/ThreadPool.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `ThreadPool` class runs submitted tasks on a fixed number of worker threads, in
+   *        the order they were submitted.
+   */
+  class ThreadPool
+  {
+  public:
+
+    /**
+     * @brief Constructs the @a `ThreadPool`, starting its worker threads.
+     *
+     * @param workerCount The number of worker threads to start. If zero, one fewer than the number
+     *                    of hardware threads is used, with a minimum of one.
+     */
+    ThreadPool (Count workerCount = 0);
+    ThreadPool (const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    /**
+     * @brief Destroys the @a `ThreadPool`. Tasks which are already running are finished; tasks
+     *        which have not started are discarded, and their futures report a broken promise.
+     */
+    ~ThreadPool ();
+
+    /**
+     * @brief   Submits a task to be run on one of the worker threads.
+     *
+     * @tparam  F The type of the task.
+     *
+     * @param   function  The task to run.
+     *
+     * @return  A future which receives the task's result, or the exception it throws.
+     */
+    template <typename F>
+    inline std::future<std::invoke_result_t<std::decay_t<F>>> submit (F&& function)
+    {
+      using Result = std::invoke_result_t<std::decay_t<F>>;
+
+      // The queue holds copyable functions, so the move-only task is shared.
+      auto task = makeRef<std::packaged_task<Result ()>>(std::forward<F>(function));
+      auto future = task->get_future();
+      enqueue([task] () { (*task)(); });
+
+      return future;
+    }
+
+    /**
+     * @brief   Retrieves the number of worker threads.
+     *
+     * @return  The number of worker threads.
+     */
+    Count getWorkerCount () const;
+
+    /**
+     * @brief   Retrieves the number of tasks waiting for a worker thread.
+     *
+     * @return  The number of queued tasks.
+     */
+    Count getQueuedCount () const;
+
+  private:
+    void enqueue (LFunction<void> task);
+    void run ();
+
+  private:
+    Collection<std::thread>       m_workers;
+    std::deque<LFunction<void>>   m_tasks;
+    mutable std::mutex            m_mutex;
+    std::condition_variable       m_condition;
+    Bool                          m_stopping = false;
+
+  };
+
+}
@@ -8,6 +8,17 @@
 namespace dg
 {
 
+  /**
+   * @brief The @a `WindowContextApi` enum enumerates the APIs which can be used to create the
+   *        @a `Window`'s OpenGL context.
+   */
+  enum class WindowContextApi
+  {
+    Native,
+    Egl,
+    OsMesa
+  };
+
   /**
    * @brief The @a `WindowSpecification` structure describes attributes which define the client
    *        application's @a `Window`.
@@ -31,6 +42,29 @@ namespace dg
      */
     Bool vertical_sync = true;
 
+    /**
+     * @brief Indicates whether or not the @a `Window` should be headless. A headless window is
+     *        never shown; the client application renders into an off-screen @a `FrameBuffer`
+     *        instead. This is useful for benchmarks and image tests on machines with no display.
+     */
+    Bool headless = false;
+
+    /**
+     * @brief The API used to create the @a `Window`'s OpenGL context. Headless windows on machines
+     *        with no GPU should use @a `WindowContextApi::Egl` or @a `WindowContextApi::OsMesa`.
+     *        On Linux, headless windows using @a `WindowContextApi::Egl` are created on Mesa's
+     *        surfaceless platform, without GLFW, so that no display server is needed; the others
+     *        still need one to initialize GLFW.
+     */
+    WindowContextApi contextApi = WindowContextApi::Native;
+
+    /**
+     * @brief Indicates whether or not Mesa should be forced to use its software rasterizer
+     *        (llvmpipe), even if a graphics card is available. This sets the process's
+     *        @a `LIBGL_ALWAYS_SOFTWARE` variable, unless it is set already.
+     */
+    Bool softwareRendering = false;
+
   };
 
   /**
@@ -62,13 +96,49 @@ namespace dg
      */
     void update () const;
 
+    /**
+     * @brief Polls events from the @a `Window` without presenting its contents.
+     */
+    void pollEvents () const;
+
+    /**
+     * @brief Presents the @a `Window`'s rendered contents. Does nothing if the window is headless.
+     */
+    void present () const;
+
+    /**
+     * @brief Makes the @a `Window`'s graphics context current on the calling thread.
+     */
+    void makeContextCurrent () const;
+
+    /**
+     * @brief Releases the graphics context current on the calling thread, so that another thread
+     *        may make it current.
+     */
+    void releaseContext () const;
+
     /**
      * @brief Retrieves the @a `Window`'s underlying @a `GLFWwindow` structure.
      * 
-     * @return  A pointer to the underlying @a `GLFWwindow` structure. 
+     * @return  A pointer to the underlying @a `GLFWwindow` structure, or @a `nullptr` if this is a
+     *          headless window created without GLFW.
      */
     GLFWwindow* getPointer () const;
 
+    /**
+     * @brief Retrieves the width and height of the @a `Window`.
+     * 
+     * @return  The window's size, in pixels. 
+     */
+    const Vector2u& getSize () const;
+
+    /**
+     * @brief Retrieves whether or not this is a headless @a `Window`.
+     * 
+     * @return  @a `true` if this window is headless; @a `false` otherwise. 
+     */
+    Bool isHeadless () const;
+
   private:
 
     /**
@@ -76,6 +146,13 @@ namespace dg
      */
     GLFWwindow* m_glfwWindow = nullptr;
 
+    /**
+     * @brief The EGL display and context of a headless @a `Window` created without GLFW, or
+     *        @a `nullptr` otherwise.
+     */
+    void* m_eglDisplay = nullptr;
+    void* m_eglContext = nullptr;
+
     /**
      * @brief Contains the text which appears in the @a `Window`'s title bar.
      */
@@ -92,6 +169,11 @@ namespace dg
      */
     Bool m_vertical_sync;
 
+    /**
+     * @brief Indicates whether or not this @a `Window` is headless.
+     */
+    Bool m_headless;
+
   };
 
 }
@@ -127,6 +127,20 @@ namespace dg
      */
     static Ref<ColorPalette> getOrEmplace (const String& filename);
 
+    /**
+     * @brief Retrieves a @a `ColorPalette` asset which is mapped to the given relative filename
+     *        string. If no such asset is found, then a new, empty @a `ColorPalette` asset is
+     *        mapped to the given filename string right away, and its palette file is read and
+     *        parsed on the @a `AssetLoader`'s worker threads. The colors are moved into the asset
+     *        on the main thread by @a `AssetLoader::update`.
+     * 
+     * @param filename  The relative filename of the asset to get or load.
+     * 
+     * @return  A shared pointer to the mapped (or newly-created) @a `ColorPalette` asset, which may
+     *          still be loading.
+     */
+    static Ref<ColorPalette> loadAsync (const String& filename);
+
     /**
      * @brief Checks to see if a loaded @a `ColorPalette` asset has been mapped to the given relative
      *        filename string.
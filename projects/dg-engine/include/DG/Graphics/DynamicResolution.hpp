@@ -0,0 +1,206 @@
+/** @file DG/Graphics/DynamicResolution.hpp */
+
+#pragma once
+
+#include <DG/Core/Clock.hpp>
+#include <DG/Graphics/FrameBuffer.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `DynamicResolutionSpecification` struct describes attributes defining the
+   *        @a `DynamicResolution` helper.
+   */
+  struct DynamicResolutionSpecification
+  {
+
+    /**
+     * @brief Should the resolution scale adapt to the time taken to draw each frame? If not, the
+     *        scale stays at the maximum.
+     */
+    Bool enabled = false;
+
+    /**
+     * @brief The time, in seconds, which each frame's 2D scenes should take to draw, at most.
+     */
+    Float32 frameBudget = 1.0f / 60.0f;
+
+    /**
+     * @brief The fraction of the budget which is kept free. The scale is only raised while frames
+     *        take less than the rest of it, so that it does not swing back and forth.
+     */
+    Float32 headroom = 0.1f;
+
+    /**
+     * @brief The smallest resolution scale, as a fraction of the output size.
+     */
+    Float32 minScale = 0.5f;
+
+    /**
+     * @brief The largest resolution scale, as a fraction of the output size.
+     */
+    Float32 maxScale = 1.0f;
+
+    /**
+     * @brief The steps in which the resolution scale changes, so that the scene target is not
+     *        resized for every small change in frame time.
+     */
+    Float32 scaleStep = 0.05f;
+
+    /**
+     * @brief How quickly the measured frame time follows the latest frame, between @a `0.0`
+     *        (never) and @a `1.0` (at once).
+     */
+    Float32 smoothing = 0.1f;
+
+    /**
+     * @brief The number of frames to wait after the scale changes before changing it again, so
+     *        that the change has time to show up in the measured frame time.
+     */
+    Count settleFrames = 15;
+
+  };
+
+  /**
+   * @brief The @a `DynamicResolutionStats` struct reports what the @a `DynamicResolution` helper
+   *        has measured, and the scale it has settled on.
+   */
+  struct DynamicResolutionStats
+  {
+    /**
+     * @brief The current resolution scale, as a fraction of the output size.
+     */
+    Float32 scale = 1.0f;
+
+    /**
+     * @brief The smoothed time taken by the graphics card to draw each frame's 2D scenes, in
+     *        seconds; zero if the backend cannot measure it.
+     */
+    Float32 gpuTime = 0.0f;
+
+    /**
+     * @brief The smoothed time between frames, in seconds.
+     */
+    Float32 frameTime = 0.0f;
+
+    /**
+     * @brief The number of times the scale has changed.
+     */
+    Count changeCount = 0;
+  };
+
+  /**
+   * @brief The @a `DynamicResolution` class is a static helper class which picks the internal
+   *        resolution at which the 2D scene is drawn, lowering it when frames take longer than
+   *        their budget and raising it again once there is room.
+   *
+   *        The time taken by the graphics card is measured with timer queries around each 2D
+   *        scene, which the @a `Renderer` starts and stops, and falls back to the time between
+   *        frames where the backend cannot measure it. The scene's @a `FrameBuffer` is drawn at
+   *        the scaled size, within attachments allocated for the full output size, so changing
+   *        the scale never reallocates. It is then upscaled to the output, either with
+   *        @a `FrameBuffer::blit`, or by drawing its attachment as a texture with the coordinates
+   *        given by @a `FrameBuffer::getTextureCoordinateScale`.
+   *
+   *        When enabled, the @a `Application` does this for its window: it draws the 2D scene
+   *        into a frame buffer of its own, calls @a `apply` on it at the start of each frame, and
+   *        blits it into the window once its layers have been updated.
+   */
+  class DynamicResolution
+  {
+  public:
+
+    /**
+     * @brief Sets up the dynamic resolution helper with the given specification.
+     *
+     * @param spec  The dynamic resolution specification.
+     */
+    static void initialize (const DynamicResolutionSpecification& spec = {});
+
+    /**
+     * @brief Drops any timer queries still in flight, and clears the helper's numbers.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief Starts measuring the time taken by the graphics card to draw a 2D scene. Called by
+     *        @a `Renderer::beginScene2D`.
+     */
+    static void beginTiming ();
+
+    /**
+     * @brief Stops measuring the time taken to draw a 2D scene. Called by
+     *        @a `Renderer::endScene2D`.
+     */
+    static void endTiming ();
+
+    /**
+     * @brief Takes in the frame times which have been measured, then adjusts the resolution
+     *        scale. Called once at the start of every frame.
+     */
+    static void update ();
+
+    /**
+     * @brief   Sizes the given frame buffer to the scaled output size. It should be made with the
+     *          full output size first, so that its attachments have room for every scale.
+     *
+     * @param   target      The frame buffer which the scene is drawn into.
+     * @param   outputSize  The size of the output which the scene is upscaled to, in pixels.
+     *
+     * @return  @a `true` if the frame buffer's size changed; @a `false` otherwise.
+     */
+    static Bool apply (FrameBuffer& target, const Vector2u& outputSize);
+
+    /**
+     * @brief   Scales the given output size by the current resolution scale.
+     *
+     * @param   outputSize  The size of the output, in pixels.
+     *
+     * @return  The scaled size, in pixels; at least one pixel on each side.
+     */
+    static Vector2u getScaledSize (const Vector2u& outputSize);
+
+    /**
+     * @brief   Retrieves the current resolution scale.
+     *
+     * @return  The resolution scale, as a fraction of the output size.
+     */
+    static Float32 getScale ();
+
+    /**
+     * @brief   Retrieves what the helper has measured, and the scale it has settled on.
+     *
+     * @return  The helper's statistics.
+     */
+    static const DynamicResolutionStats& getStats ();
+
+  private:
+
+    /**
+     * @brief A timer query in flight, along with the frame it was started in.
+     */
+    struct Timing
+    {
+      Uint32 handle = 0;
+      Index frame = 0;
+    };
+
+    /**
+     * @brief Adds a new measurement to a smoothed time.
+     */
+    static void smooth (Float32& smoothed, Float32 measured);
+
+    static DynamicResolutionSpecification s_spec;
+    static DynamicResolutionStats         s_stats;
+    static std::deque<Timing>             s_timings;
+    static Clock                          s_clock;
+    static Index                          s_frame;
+    static Index                          s_sampleFrame;
+    static Float32                        s_sampleTime;
+    static Count                          s_settleFrames;
+    static Bool                           s_measuring;
+
+  };
+
+}
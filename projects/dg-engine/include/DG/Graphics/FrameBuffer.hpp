@@ -2,7 +2,8 @@
 
 #pragma once
 
-#include <DG_Pch.hpp>
+#include <DG/Graphics/PixelReadback.hpp>
+#include <DG/Graphics/RenderPass.hpp>
 
 namespace dg
 {
@@ -114,6 +115,14 @@ namespace dg
      */
     Uint32 sampleCount = 1;
 
+    /**
+     * @brief The extra room, as a fraction of the size, given to the attachments when they must be
+     *        reallocated to grow. While the size stays within the attachments' capacity, resizing
+     *        only changes the part of them which is drawn into, and nothing is reallocated.
+     *        With no headroom, the attachments are exactly as large as the @a `FrameBuffer`.
+     */
+    Float32 headroom = 0.0f;
+
     /**
      * @brief The @a `FrameBuffer`'s attachment specification.
      */
@@ -144,12 +153,30 @@ namespace dg
 
     /**
      * @brief   Sets this @a `FrameBuffer` as the current @a `GL_FRAMEBUFFER` for drawing, reading
-     *          or both.
+     *          or both. When drawing, the viewport is set to this frame buffer's size and the
+     *          frame buffer is cleared; use @a `beginPass` to choose what is cleared instead.
      * 
      * @param   target  The type of target to set this @a `FrameBuffer` as.
      */
     void bind (const FrameBufferTarget target = FrameBufferTarget::Drawing) const;
 
+    /**
+     * @brief   Binds this @a `FrameBuffer` for drawing, without the clear which @a `bind` makes,
+     *          then prepares each of its attachments as the given render pass asks: clearing it,
+     *          keeping its contents, or telling the driver its contents are not needed.
+     * 
+     * @param   pass  The render pass's descriptor.
+     */
+    void beginPass (const RenderPassDescriptor& pass = {});
+
+    /**
+     * @brief   Finishes a render pass begun with @a `beginPass`, telling the driver which of this
+     *          @a `FrameBuffer`'s attachments need not be kept.
+     * 
+     * @param   pass  The render pass's descriptor, as given to @a `beginPass`.
+     */
+    void endPass (const RenderPassDescriptor& pass = {});
+
     /**
      * @brief   Un-sets the current @a `GL_FRAMEBUFFER` for drawing, reading or both.
      * 
@@ -179,6 +206,90 @@ namespace dg
     Int32 readPixel (const Index index, Int32 x, Int32 y);
     Int32 readPixel (const Index index, Float32 x, Float32 y);
 
+    /**
+     * @brief   Starts reading the value of a pixel from a color attachment in this
+     *          @a `FrameBuffer` at the given index, without stalling the graphics pipeline. The
+     *          value arrives a frame or two later.
+     * 
+     * @param   index     The index of the color attachment texture to read.
+     * @param   x         The target pixel's X coordinate.
+     * @param   y         The target pixel's Y coordinate.
+     * @param   callback  If given, a function called by @a `PixelReadback::update` once the value
+     *                    has arrived.
+     * 
+     * @return  A shared pointer to the readback, whose value is @a `-1` if the pixel lies outside
+     *          this @a `FrameBuffer`.
+     */
+    Ref<PixelReadback> readPixelAsync (const Index index, Int32 x, Int32 y,
+      const PixelReadbackCallback& callback = nullptr);
+
+    /**
+     * @brief   Starts reading a rectangle of pixels from a color attachment in this
+     *          @a `FrameBuffer` at the given index in a single transfer, without stalling the
+     *          graphics pipeline. The values arrive a frame or two later.
+     * 
+     * @param   index     The index of the color attachment texture to read.
+     * @param   position  The position of the rectangle's lower-left corner, in pixels.
+     * @param   size      The rectangle's size, in pixels. The part of the rectangle outside this
+     *                    @a `FrameBuffer` is not read.
+     * @param   callback  If given, a function called by @a `PixelReadback::update` once the values
+     *                    have arrived.
+     * 
+     * @return  A shared pointer to the readback.
+     */
+    Ref<PixelReadback> readPixelsAsync (const Index index, const Vector2i& position,
+      const Vector2u& size, const PixelReadbackCallback& callback = nullptr);
+
+    /**
+     * @brief   Reads every pixel of a color attachment in this @a `FrameBuffer`, bottom row first.
+     *          This is mostly useful for comparing the output of a headless application against
+     *          reference images.
+     * 
+     * @param   index   The index of the color attachment texture to read.
+     * @param   pixels  A handle to the collection which will receive the pixel data.
+     */
+    void readColorAttachment (const Index index, Collection<Uint8>& pixels);
+
+    /**
+     * @brief   Copies a color attachment in this @a `FrameBuffer` into one in another, scaling it
+     *          from this frame buffer's size to the other's. This is how a scene drawn at a lower
+     *          resolution is upscaled to its output.
+     * 
+     * @param   index             The index of the color attachment to copy from.
+     * @param   destination       The frame buffer to copy into.
+     * @param   destinationIndex  The index of the color attachment to copy into.
+     * @param   linear            Should the pixels be filtered linearly when scaled?
+     * 
+     * @throw   @a `std::out_of_range` if either index is out of range.
+     * @throw   @a `std::invalid_argument` if this frame buffer is multisampled and is not the same
+     *          size as the destination.
+     */
+    void blit (const Index index, FrameBuffer& destination, const Index destinationIndex = 0,
+      const Bool linear = true) const;
+
+    /**
+     * @brief   Copies a color attachment in this @a `FrameBuffer` into the window, scaling it to
+     *          the given rectangle.
+     * 
+     * @param   index     The index of the color attachment to copy from.
+     * @param   position  The position of the rectangle's lower-left corner, in the window.
+     * @param   size      The size of the rectangle, in pixels.
+     * @param   linear    Should the pixels be filtered linearly when scaled?
+     * 
+     * @throw   @a `std::out_of_range` if the index is out of range.
+     * @throw   @a `std::invalid_argument` if this frame buffer is multisampled and is not the same
+     *          size as the rectangle.
+     */
+    void blitToWindow (const Index index, const Vector2i& position, const Vector2u& size,
+      const Bool linear = true) const;
+
+    /**
+     * @brief   Retrieves the unique ID coresponding to the @a `FrameBuffer` on the graphics card.
+     * 
+     * @return  The frame buffer handle.
+     */
+    Uint32 getHandle () const;
+
     /**
      * @brief   Retrieves the unique ID coresponding to one of the @a `FrameBuffer`'s color 
      *          attachment handles on the graphics card.
@@ -244,14 +355,36 @@ namespace dg
     inline const Vector2u& getSize () const { return m_spec.size; }
 
     /**
-     * @brief   Sets the size of this @a `FrameBuffer`.
+     * @brief   Retrieves the size which this @a `FrameBuffer`'s attachments are allocated with.
+     *          Only the lower-left part of each attachment, as large as the frame buffer's size,
+     *          is drawn into.
+     * 
+     * @return  The frame buffer's capacity, in pixels.
+     */
+    inline const Vector2u& getCapacity () const { return m_capacity; }
+
+    /**
+     * @brief   Retrieves the texture coordinate of the upper-right corner of the part of each
+     *          attachment which is drawn into, for use when drawing an attachment as a texture,
+     *          such as with Dear ImGui.
+     * 
+     * @return  The frame buffer's size divided by its capacity.
+     */
+    inline Vector2f getTextureCoordinateScale () const
+    {
+      return Vector2f { m_spec.size } / Vector2f { m_capacity };
+    }
+
+    /**
+     * @brief   Sets the size of this @a `FrameBuffer`. The attachments are only reallocated if the
+     *          new size does not fit within their capacity.
      * 
      * @param   width   The frame buffer's new width, in pixels.
      * @param   height  The frame buffer's new height, in pixels.
      * 
-     * @return  @a `true` if the framebuffer's width or height is changed to a different value, 
-     *          causing the framebuffer to be rebuilt; 
-     *          @a `false` otherwise.
+     * @return  @a `true` if the framebuffer's width or height is changed to a different value,
+     *          whether or not that rebuilds it - it is only rebuilt if the new size exceeds its
+     *          capacity; @a `false` otherwise.
      */
     inline Bool setSize (const Uint32 width, const Uint32 height)
     {
@@ -260,7 +393,9 @@ namespace dg
       {
         m_spec.size.x = width;
         m_spec.size.y = height;
-        build();
+        if (width > m_capacity.x || height > m_capacity.y) {
+          build();
+        }
 
         return true;
       }
@@ -269,13 +404,14 @@ namespace dg
     }
 
     /**
-     * @brief   Sets the size of this @a `FrameBuffer`.
+     * @brief   Sets the size of this @a `FrameBuffer`. The attachments are only reallocated if the
+     *          new size does not fit within their capacity.
      * 
      * @param   size  The frame buffer's new size, in pixels.
      * 
-     * @return  @a `true` if the framebuffer's width or height is changed to a different value, 
-     *          causing the framebuffer to be rebuilt; 
-     *          @a `false` otherwise.
+     * @return  @a `true` if the framebuffer's width or height is changed to a different value,
+     *          whether or not that rebuilds it - it is only rebuilt if the new size exceeds its
+     *          capacity; @a `false` otherwise.
      */
     inline Bool setSize (const Vector2u& size)
     {
@@ -289,6 +425,12 @@ namespace dg
      */
     void build ();
 
+    /**
+     * @brief Copies a color attachment into the given framebuffer, scaling it to fit.
+     */
+    void blitInto (const Index index, Uint32 destination, const Index destinationIndex,
+      const Vector2i& position, const Vector2u& size, const Bool linear) const;
+
   private:
     /**
      * @brief The integer pointing to this @a `FrameBuffer` on the graphics card.
@@ -312,6 +454,11 @@ namespace dg
      */
     FrameBufferSpecification m_spec;
 
+    /**
+     * @brief The size which the @a `FrameBuffer`'s attachments are allocated with.
+     */
+    Vector2u m_capacity = { 0, 0 };
+
     /**
      * @brief A collection of specifications describing the @a `FrameBuffer`'s color attachment
      *        textures.
@@ -0,0 +1,211 @@
+/** @file DG/Graphics/FrameCapture.hpp */
+
+#pragma once
+
+#include <DG/Core/ThreadPool.hpp>
+#include <DG/Graphics/FrameBuffer.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `FrameCaptureFormat` enum enumerates the ways in which captured frames can be
+   *        written to disk: as one file of raw RGBA pixels, top row first; as one YUV4MPEG2 video
+   *        file, which most video tools can read; or as a numbered sequence of PNG images.
+   */
+  enum class FrameCaptureFormat
+  {
+    Raw,
+    Y4M,
+    PNG
+  };
+
+  /**
+   * @brief The @a `FrameCaptureSpecification` struct describes attributes defining a recording
+   *        made by the @a `FrameCapture`.
+   */
+  struct FrameCaptureSpecification
+  {
+
+    /**
+     * @brief The file to write the recording to; or, for PNG sequences, the directory to write
+     *        the images into.
+     */
+    Path path;
+
+    /**
+     * @brief The format in which the recording is written.
+     */
+    FrameCaptureFormat format = FrameCaptureFormat::Y4M;
+
+    /**
+     * @brief The index of the color attachment to capture. It must be a @a `ColorRGBA8`
+     *        attachment.
+     */
+    Index attachment = 0;
+
+    /**
+     * @brief The frame rate written into a Y4M file's header, in frames per second.
+     */
+    Count frameRate = 60;
+
+    /**
+     * @brief The number of frames which may be in transfer from the graphics card at once. Frames
+     *        captured while this many are still in transfer are dropped.
+     */
+    Count maxInFlightFrames = 3;
+
+    /**
+     * @brief The number of frames which may wait to be written at once. Frames which arrive while
+     *        this many are still waiting are dropped.
+     */
+    Count maxQueuedFrames = 8;
+
+  };
+
+  /**
+   * @brief The @a `FrameCaptureStats` struct reports how the current or last recording made by the
+   *        @a `FrameCapture` has fared.
+   */
+  struct FrameCaptureStats
+  {
+    /**
+     * @brief The number of frames captured, including those which were dropped.
+     */
+    Count capturedCount = 0;
+
+    /**
+     * @brief The number of frames dropped because the graphics card or the writer fell behind, or
+     *        because the frame's size changed partway through a raw or Y4M recording.
+     */
+    Count droppedCount = 0;
+
+    /**
+     * @brief The number of frames written to disk.
+     */
+    Count writtenCount = 0;
+
+    /**
+     * @brief The number of frames which could not be read back or written.
+     */
+    Count failedCount = 0;
+
+    /**
+     * @brief The number of bytes written to disk.
+     */
+    Size byteCount = 0;
+  };
+
+  /**
+   * @brief The @a `FrameCapture` class is a static helper class which records the frames drawn
+   *        into a @a `FrameBuffer` to disk, such as to capture gameplay footage for QA.
+   *
+   *        Each captured frame is read into memory on the graphics card behind a fence, as with
+   *        @a `FrameBuffer::readPixelsAsync`. Once it arrives, @a `update`, which the
+   *        @a `Application` calls once per frame, hands it to a writer thread, which converts it
+   *        and writes it to disk. The render loop never waits on either: if the graphics card or
+   *        the writer falls behind, frames are dropped and counted instead.
+   */
+  class FrameCapture
+  {
+  public:
+
+    /**
+     * @brief   Starts a recording, stopping the current one first if need be.
+     *
+     * @param   spec  The recording's specification.
+     *
+     * @return  @a `true` if the recording was started; @a `false` if its file or directory could
+     *          not be created.
+     */
+    static Boolean start (const FrameCaptureSpecification& spec);
+
+    /**
+     * @brief Stops the current recording. Frames still in transfer from the graphics card are
+     *        dropped; frames waiting to be written are written first, so this may take a moment.
+     */
+    static void stop ();
+
+    /**
+     * @brief Stops the current recording, if there is one.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief   Captures the frame currently drawn into the given frame buffer, if a recording has
+     *          been started. Call this once the frame has been drawn.
+     *
+     * @param   target  The frame buffer to capture.
+     *
+     * @throw   @a `std::out_of_range` if the frame buffer has no color attachment at the
+     *          recording's attachment index.
+     * @throw   @a `std::invalid_argument` if that attachment is not a @a `ColorRGBA8` attachment.
+     */
+    static void capture (const FrameBuffer& target);
+
+    /**
+     * @brief Hands the captured frames which have arrived from the graphics card to the writer
+     *        thread. Called once at the start of every frame.
+     */
+    static void update ();
+
+    /**
+     * @brief   Retrieves whether or not a recording is in progress.
+     *
+     * @return  @a `true` if a recording has been started and not stopped; @a `false` otherwise.
+     */
+    static Boolean isRecording ();
+
+    /**
+     * @brief   Retrieves how the current or last recording has fared.
+     *
+     * @return  The recording's statistics.
+     */
+    static const FrameCaptureStats& getStats ();
+
+  private:
+
+    /**
+     * @brief A captured frame in transfer from the graphics card.
+     */
+    struct InFlightFrame
+    {
+      Uint32 handle = 0;
+      Index frame = 0;
+      Vector2u size = { 0, 0 };
+      Collection<Uint8> pixels;
+    };
+
+    /**
+     * @brief The state of the recording which is only touched by the writer thread, along with
+     *        the counters which it shares with the main thread.
+     */
+    struct Writer
+    {
+      FrameCaptureSpecification spec;
+      std::ofstream stream;
+      Bool headerWritten = false;
+      std::atomic<Count> queuedCount = 0;
+      std::atomic<Count> writtenCount = 0;
+      std::atomic<Count> failedCount = 0;
+      std::atomic<Size> byteCount = 0;
+      std::mutex freeMutex;
+      Collection<Collection<Uint8>> freePixels;
+    };
+
+    /**
+     * @brief Converts a frame and writes it to disk. Run on the writer thread.
+     */
+    static void write (Writer& writer, Index frame, const Vector2u& size,
+      Collection<Uint8>& pixels);
+
+    static FrameCaptureSpecification  s_spec;
+    static FrameCaptureStats          s_stats;
+    static Vector2u                   s_size;
+    static std::deque<InFlightFrame>  s_inFlight;
+    static Ref<Writer>                s_writer;
+    static Scope<ThreadPool>          s_thread;
+
+  };
+
+}
@@ -0,0 +1,198 @@
+/** @file DG/Graphics/GLRenderBackend.hpp */
+
+#pragma once
+
+#include <DG/Graphics/RenderBackend.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `GLRenderBackend` class is the @a `RenderBackend` which carries out commands
+   *        on the graphics card through OpenGL.
+   */
+  class GLRenderBackend : public RenderBackend
+  {
+  public:
+    RenderBackendType getType () const override;
+    void initialize () override;
+
+  public: // State and Draw Calls
+    void setViewport (const Vector2i& position, const Vector2u& size) override;
+    void setClearColor (const Color& color) override;
+    void clear () override;
+    void setPixelStore (GLenum name, Int32 value) override;
+    void drawIndexed (GLenum primitive, Count indexCount, GLenum indexType) override;
+
+  public: // Buffers
+    Uint32 createBuffer () override;
+    void destroyBuffer (Uint32 handle) override;
+    void bindBuffer (GLenum target, Uint32 handle) override;
+    void allocateBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      GLenum usage) override;
+    void uploadBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      Size offset = 0) override;
+
+  public: // Vertex Arrays
+    Uint32 createVertexArray () override;
+    void destroyVertexArray (Uint32 handle) override;
+    void bindVertexArray (Uint32 handle) override;
+    void setVertexAttribute (Index index, Count elementCount, GLenum type, Bool normalized,
+      Size stride, Size offset) override;
+
+  public: // Textures
+    Uint32 createTexture () override;
+    void destroyTexture (Uint32 handle) override;
+    void bindTexture (GLenum target, Uint32 handle, Index slot = 0) override;
+    void setTextureParameter (GLenum target, Uint32 handle, GLenum name, Int32 value) override;
+    void allocateTexture2D (Uint32 handle, GLenum internalFormat, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data) override;
+    void allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    void allocateTextureStorage2D (Uint32 handle, Count levelCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    Bool isTextureFormatSupported (GLenum internalFormat) override;
+    void uploadTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data, Index level = 0) override;
+    void uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, Uint32 buffer, Size bufferOffset,
+      Index level = 0) override;
+    void uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum compressedFormat, const void* data, Size byteCount, Index level = 0) override;
+    void generateTextureMipmaps (Uint32 handle) override;
+    void clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+      const void* data) override;
+
+  public: // Frame Buffers
+    Uint32 createFramebuffer () override;
+    void destroyFramebuffer (Uint32 handle) override;
+    void bindFramebuffer (GLenum target, Uint32 handle) override;
+    void attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+      Uint32 texture) override;
+    void setDrawBuffers (const GLenum* buffers, Count count) override;
+    void setReadBuffer (GLenum buffer) override;
+    void clearFramebufferColor (Uint32 framebuffer, Index index, const Vector4f& color) override;
+    void clearFramebufferInteger (Uint32 framebuffer, Index index,
+      const Vector4i& value) override;
+    void clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+      Int32 stencil) override;
+    void invalidateFramebuffer (Uint32 framebuffer, const GLenum* attachments,
+      Count count) override;
+    void blitFramebuffer (Uint32 source, Index sourceIndex, const Vector2i& sourcePosition,
+      const Vector2u& sourceSize, Uint32 destination, Index destinationIndex,
+      const Vector2i& destinationPosition, const Vector2u& destinationSize,
+      Bool linear) override;
+    Bool isFramebufferComplete () override;
+    void readPixels (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType, void* data) override;
+    Uint32 beginReadback (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType) override;
+    ReadbackStatus pollReadback (Uint32 handle, void* data, Bool wait = false) override;
+    void destroyReadback (Uint32 handle) override;
+
+  public: // Timer Queries
+    Uint32 beginTimerQuery () override;
+    void endTimerQuery () override;
+    QueryStatus pollTimerQuery (Uint32 handle, Uint64& nanoseconds) override;
+    void destroyTimerQuery (Uint32 handle) override;
+
+  public: // Fences
+    Uint32 insertFence () override;
+    Bool pollFence (Uint32 handle, Bool wait = false) override;
+    void destroyFence (Uint32 handle) override;
+
+  public: // Shader Programs
+    Uint32 createProgram (const String& vertexCode, const String& fragmentCode) override;
+    Uint32 beginProgram (const String& vertexCode, const String& fragmentCode) override;
+    ProgramStatus pollProgram (Uint32 handle, Bool wait = false) override;
+    Uint32 createProgramFromBinary (GLenum format, const void* data, Size byteCount) override;
+    Bool getProgramBinary (Uint32 handle, GLenum& format, Collection<Uint8>& binary) override;
+    String getDeviceName () override;
+    void destroyProgram (Uint32 handle) override;
+    void useProgram (Uint32 handle) override;
+    void setUniform (Uint32 program, const String& name, ShaderUniformType type,
+      const void* value) override;
+
+  private:
+    /**
+     * @brief The shader stages of a program whose build has been started, but not yet checked.
+     */
+    struct PendingProgram
+    {
+      Uint32 vertexShader = 0;
+      Uint32 fragmentShader = 0;
+    };
+
+    /**
+     * @brief The programs whose builds have been started, but not yet checked.
+     */
+    Map<Uint32, PendingProgram> m_pendingPrograms;
+
+    /**
+     * @brief A pixel pack buffer, which pixels are read into without waiting on the transfer.
+     */
+    struct PackBuffer
+    {
+      Uint32 handle = 0;
+      Size capacity = 0;
+    };
+
+    /**
+     * @brief A pixel transfer whose fence has not yet been seen to signal.
+     */
+    struct PendingReadback
+    {
+      PackBuffer buffer;
+      GLsync fence = nullptr;
+      Size byteCount = 0;
+    };
+
+    /**
+     * @brief The readbacks which have been started, but not yet finished.
+     */
+    Map<Uint32, PendingReadback> m_pendingReadbacks;
+
+    /**
+     * @brief The pack buffers left over from finished readbacks, which later readbacks reuse.
+     */
+    Collection<PackBuffer> m_freePackBuffers;
+
+    /**
+     * @brief The handle given to the next readback.
+     */
+    Uint32 m_nextReadback = 1;
+
+    /**
+     * @brief The timer queries which have been started, but whose results have not been taken.
+     */
+    Map<Uint32, Uint32> m_pendingQueries;
+
+    /**
+     * @brief The queries left over from finished timer queries, which later ones reuse.
+     */
+    Collection<Uint32> m_freeQueries;
+
+    /**
+     * @brief The handle given to the next timer query.
+     */
+    Uint32 m_nextQuery = 1;
+
+    /**
+     * @brief The fences which have been inserted, but not yet seen to signal.
+     */
+    Map<Uint32, GLsync> m_pendingFences;
+
+    /**
+     * @brief The handle given to the next fence.
+     */
+    Uint32 m_nextFence = 1;
+
+    /**
+     * @brief Indicates whether or not the graphics driver can report when a build has finished
+     *        without waiting for it.
+     */
+    Bool m_parallelCompile = false;
+
+  };
+
+}
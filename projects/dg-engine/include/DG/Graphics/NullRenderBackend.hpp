@@ -0,0 +1,238 @@
+/** @file DG/Graphics/NullRenderBackend.hpp */
+
+#pragma once
+
+#include <DG/Graphics/RenderBackend.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderCommandType` enum enumerates the kinds of commands which are recorded
+   *        by the @a `NullRenderBackend`.
+   */
+  enum class RenderCommandType
+  {
+    Clear,
+    DrawIndexed,
+    UploadBuffer,
+    UploadTexture,
+    BindTexture,
+    BindFramebuffer,
+    UseProgram,
+    SetUniform,
+    ReadPixels,
+    InvalidateFramebuffer,
+    BlitFramebuffer
+  };
+
+  /**
+   * @brief The @a `RenderCommand` struct describes a single command recorded by the
+   *        @a `NullRenderBackend`.
+   */
+  struct RenderCommand
+  {
+
+    /**
+     * @brief The kind of command which was recorded.
+     */
+    RenderCommandType type;
+
+    /**
+     * @brief The handle of the object targeted by the command, if any.
+     */
+    Uint32 handle = 0;
+
+    /**
+     * @brief The number of indices drawn by a draw call.
+     */
+    Count count = 0;
+
+    /**
+     * @brief The number of bytes which would have been transferred to or from the graphics card.
+     */
+    Size byteCount = 0;
+
+  };
+
+  /**
+   * @brief The @a `NullRenderBackend` class is a @a `RenderBackend` which does not talk to the
+   *        graphics card at all. Instead, it hands out fake object handles and records the commands
+   *        issued to it, allowing the CPU side of the renderer to be measured and tested without
+   *        an OpenGL context.
+   *
+   *        Recording is off until @a `setRecording` turns it on, since nothing else clears the
+   *        recorded commands, and an application left running on this backend would otherwise
+   *        grow them every frame. Uploaded bytes are counted either way.
+   */
+  class NullRenderBackend : public RenderBackend
+  {
+  public:
+    RenderBackendType getType () const override;
+    void initialize () override;
+
+  public: // State and Draw Calls
+    void setViewport (const Vector2i& position, const Vector2u& size) override;
+    void setClearColor (const Color& color) override;
+    void clear () override;
+    void setPixelStore (GLenum name, Int32 value) override;
+    void drawIndexed (GLenum primitive, Count indexCount, GLenum indexType) override;
+
+  public: // Buffers
+    Uint32 createBuffer () override;
+    void destroyBuffer (Uint32 handle) override;
+    void bindBuffer (GLenum target, Uint32 handle) override;
+    void allocateBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      GLenum usage) override;
+    void uploadBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      Size offset = 0) override;
+
+  public: // Vertex Arrays
+    Uint32 createVertexArray () override;
+    void destroyVertexArray (Uint32 handle) override;
+    void bindVertexArray (Uint32 handle) override;
+    void setVertexAttribute (Index index, Count elementCount, GLenum type, Bool normalized,
+      Size stride, Size offset) override;
+
+  public: // Textures
+    Uint32 createTexture () override;
+    void destroyTexture (Uint32 handle) override;
+    void bindTexture (GLenum target, Uint32 handle, Index slot = 0) override;
+    void setTextureParameter (GLenum target, Uint32 handle, GLenum name, Int32 value) override;
+    void allocateTexture2D (Uint32 handle, GLenum internalFormat, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data) override;
+    void allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    void allocateTextureStorage2D (Uint32 handle, Count levelCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    Bool isTextureFormatSupported (GLenum internalFormat) override;
+    void uploadTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data, Index level = 0) override;
+    void uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, Uint32 buffer, Size bufferOffset,
+      Index level = 0) override;
+    void uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum compressedFormat, const void* data, Size byteCount, Index level = 0) override;
+    void generateTextureMipmaps (Uint32 handle) override;
+    void clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+      const void* data) override;
+
+  public: // Frame Buffers
+    Uint32 createFramebuffer () override;
+    void destroyFramebuffer (Uint32 handle) override;
+    void bindFramebuffer (GLenum target, Uint32 handle) override;
+    void attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+      Uint32 texture) override;
+    void setDrawBuffers (const GLenum* buffers, Count count) override;
+    void setReadBuffer (GLenum buffer) override;
+    void clearFramebufferColor (Uint32 framebuffer, Index index, const Vector4f& color) override;
+    void clearFramebufferInteger (Uint32 framebuffer, Index index,
+      const Vector4i& value) override;
+    void clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+      Int32 stencil) override;
+    void invalidateFramebuffer (Uint32 framebuffer, const GLenum* attachments,
+      Count count) override;
+    void blitFramebuffer (Uint32 source, Index sourceIndex, const Vector2i& sourcePosition,
+      const Vector2u& sourceSize, Uint32 destination, Index destinationIndex,
+      const Vector2i& destinationPosition, const Vector2u& destinationSize,
+      Bool linear) override;
+    Bool isFramebufferComplete () override;
+    void readPixels (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType, void* data) override;
+    Uint32 beginReadback (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType) override;
+    ReadbackStatus pollReadback (Uint32 handle, void* data, Bool wait = false) override;
+    void destroyReadback (Uint32 handle) override;
+
+  public: // Timer Queries
+    Uint32 beginTimerQuery () override;
+    void endTimerQuery () override;
+    QueryStatus pollTimerQuery (Uint32 handle, Uint64& nanoseconds) override;
+    void destroyTimerQuery (Uint32 handle) override;
+
+  public: // Fences
+    Uint32 insertFence () override;
+    Bool pollFence (Uint32 handle, Bool wait = false) override;
+    void destroyFence (Uint32 handle) override;
+
+  public: // Shader Programs
+    Uint32 createProgram (const String& vertexCode, const String& fragmentCode) override;
+    Uint32 beginProgram (const String& vertexCode, const String& fragmentCode) override;
+    ProgramStatus pollProgram (Uint32 handle, Bool wait = false) override;
+    Uint32 createProgramFromBinary (GLenum format, const void* data, Size byteCount) override;
+    Bool getProgramBinary (Uint32 handle, GLenum& format, Collection<Uint8>& binary) override;
+    String getDeviceName () override;
+    void destroyProgram (Uint32 handle) override;
+    void useProgram (Uint32 handle) override;
+    void setUniform (Uint32 program, const String& name, ShaderUniformType type,
+      const void* value) override;
+
+  public: // Recorded Commands
+
+    /**
+     * @brief Turns the recording of commands on or off. Commands already recorded are kept.
+     *
+     * @param recording Should commands be recorded from here on?
+     */
+    void setRecording (Bool recording);
+
+    /**
+     * @brief   Retrieves whether or not commands are being recorded.
+     *
+     * @return  @a `true` if commands are being recorded; @a `false` otherwise.
+     */
+    Bool isRecording () const;
+
+    /**
+     * @brief   Retrieves the commands recorded since the last call to @a `clearCommands`.
+     *
+     * @return  The recorded commands, in the order they were issued.
+     */
+    const Collection<RenderCommand>& getCommands () const;
+
+    /**
+     * @brief   Counts the recorded commands of the given type.
+     *
+     * @param   type  The type of command to count.
+     *
+     * @return  The number of recorded commands of that type.
+     */
+    Count countCommands (const RenderCommandType type) const;
+
+    /**
+     * @brief   Retrieves the total number of bytes which would have been uploaded to the graphics
+     *          card since the last call to @a `clearCommands`.
+     *
+     * @return  The number of bytes uploaded.
+     */
+    Size getUploadedByteCount () const;
+
+    /**
+     * @brief Discards all recorded commands and resets the uploaded byte count.
+     */
+    void clearCommands ();
+
+  private:
+
+    /**
+     * @brief Appends a command to the recorded command list, if recording, and counts the bytes
+     *        it uploads.
+     */
+    void record (const RenderCommandType type, Uint32 handle = 0, Count count = 0,
+      Size byteCount = 0);
+
+    /**
+     * @brief Hands out the next fake object handle.
+     */
+    Uint32 nextHandle ();
+
+  private:
+    Collection<RenderCommand> m_commands;
+    Bool m_recording = false;
+    Size m_uploadedByteCount = 0;
+    Uint32 m_nextHandle = 1;
+    Map<Uint32, Size> m_readbackByteCounts;
+
+  };
+
+}
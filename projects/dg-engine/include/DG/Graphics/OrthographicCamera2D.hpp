@@ -0,0 +1,143 @@
+/** @file DG/Graphics/OrthographicCamera2D.hpp */
+
+#pragma once
+
+#include <DG/Math/AABB2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `OrthographicCamera2D` class describes a camera looking onto a two-dimensional
+   *        scene, by its position, rotation and zoom.
+   *
+   *        The camera's view and projection matrices, their product, and the bounds of the part
+   *        of the world it can see are worked out once, the first time one of them is asked for
+   *        after the camera changes, and kept until it changes again. Pass the camera to
+   *        @a `Renderer::beginScene2D` to draw what it sees; its bounds can also be used to skip
+   *        work on anything out of view.
+   */
+  class OrthographicCamera2D
+  {
+  public:
+
+    /**
+     * @brief Constructs a new @a `OrthographicCamera2D`.
+     *
+     * @param viewportSize  The width and height of the part of the world the camera sees when it
+     *                      is not zoomed.
+     */
+    OrthographicCamera2D (const Vector2f& viewportSize = { 2.0f, 2.0f });
+
+  public: // Setters
+
+    /**
+     * @brief Moves the camera so that it is centered on the given point.
+     *
+     * @param position  The camera's new position in the world.
+     */
+    void setPosition (const Vector2f& position);
+
+    /**
+     * @brief Turns the camera to the given angle. The world appears to turn the other way.
+     *
+     * @param rotation  The camera's new counter-clockwise rotation, in degrees.
+     */
+    void setRotation (Float32 rotation);
+
+    /**
+     * @brief   Sets how far the camera is zoomed in. At a zoom of two, the camera sees half as far
+     *          in each direction as it does at a zoom of one.
+     *
+     * @param   zoom  The camera's new zoom.
+     *
+     * @throw   @a `std::invalid_argument` if the zoom is not a finite number greater than zero.
+     */
+    void setZoom (Float32 zoom);
+
+    /**
+     * @brief   Sets the width and height of the part of the world the camera sees when it is not
+     *          zoomed, such as to match the aspect ratio of a resized window.
+     *
+     * @param   viewportSize  The camera's new viewport size.
+     *
+     * @throw   @a `std::invalid_argument` if either side is not a finite number greater than
+     *          zero.
+     */
+    void setViewportSize (const Vector2f& viewportSize);
+
+    /**
+     * @brief Sets the range of Z coordinates which the camera can see. Anything nearer or farther
+     *        is clipped.
+     *
+     * @param nearPlane The nearest Z coordinate which the camera can see.
+     * @param farPlane  The farthest Z coordinate which the camera can see.
+     */
+    void setDepthRange (Float32 nearPlane, Float32 farPlane);
+
+  public: // Getters
+
+    inline const Vector2f& getPosition () const { return m_position; }
+    inline Float32 getRotation () const { return m_rotation; }
+    inline Float32 getZoom () const { return m_zoom; }
+    inline const Vector2f& getViewportSize () const { return m_viewportSize; }
+    inline Float32 getNearPlane () const { return m_nearPlane; }
+    inline Float32 getFarPlane () const { return m_farPlane; }
+
+    /**
+     * @brief   Retrieves the camera's view matrix, which moves the world so that the camera sits at
+     *          its origin.
+     *
+     * @return  The view matrix.
+     */
+    const Matrix4f& getView () const;
+
+    /**
+     * @brief   Retrieves the camera's projection matrix, which maps the part of the world the
+     *          camera sees onto the render target.
+     *
+     * @return  The projection matrix.
+     */
+    const Matrix4f& getProjection () const;
+
+    /**
+     * @brief   Retrieves the product of the camera's projection and view matrices, as expected by
+     *          @a `Renderer::beginScene2D`.
+     *
+     * @return  The camera product.
+     */
+    const Matrix4f& getViewProjection () const;
+
+    /**
+     * @brief   Retrieves the bounds of the part of the world the camera can see. If the camera is
+     *          turned, this is the smallest box around the turned view.
+     *
+     * @return  The camera's view bounds, in world space.
+     */
+    const AABB2D& getBounds () const;
+
+  private:
+
+    /**
+     * @brief Works out the camera's matrices and bounds again, if it has changed since they were
+     *        last worked out.
+     */
+    void recalculate () const;
+
+  private:
+    Vector2f m_position = { 0.0f, 0.0f };
+    Vector2f m_viewportSize = { 2.0f, 2.0f };
+    Float32 m_rotation = 0.0f;
+    Float32 m_zoom = 1.0f;
+    Float32 m_nearPlane = -1.0f;
+    Float32 m_farPlane = 1.0f;
+
+    mutable Matrix4f m_view = Matrix4f { 1.0f };
+    mutable Matrix4f m_projection = Matrix4f { 1.0f };
+    mutable Matrix4f m_viewProjection = Matrix4f { 1.0f };
+    mutable AABB2D m_bounds;
+    mutable Bool m_dirty = true;
+
+  };
+
+}
@@ -0,0 +1,165 @@
+/** @file DG/Graphics/PixelReadback.hpp */
+
+#pragma once
+
+#include <DG/Graphics/RenderBackend.hpp>
+
+namespace dg
+{
+
+  class PixelReadback;
+
+  /**
+   * @brief A function called once a @a `PixelReadback`'s pixels have arrived.
+   */
+  using PixelReadbackCallback = LFunction<void, const PixelReadback&>;
+
+  /**
+   * @brief The @a `PixelReadback` class holds a rectangle of pixels being read from a
+   *        @a `FrameBuffer`'s color attachment without stalling the graphics pipeline, such as
+   *        the entity IDs under the mouse cursor or under a marquee selection.
+   *
+   *        The pixels are copied into memory on the graphics card behind a fence, and arrive a
+   *        frame or two later. They can be checked on with @a `poll`, or handed to a callback by
+   *        @a `PixelReadback::update`, which the @a `Application` calls once per frame.
+   *
+   *        Both color attachment formats use four bytes per pixel, so each pixel is held as one
+   *        @a `Int32` value.
+   */
+  class PixelReadback
+  {
+  public:
+
+    /**
+     * @brief Constructs a @a `PixelReadback` for a transfer which has already been started.
+     *
+     * @param position  The position of the rectangle's lower-left corner, in pixels.
+     * @param size      The rectangle's size, in pixels.
+     * @param handle    The handle of the backend's readback; @a `0` if there is nothing to read,
+     *                  in which case the readback is ready right away, with no pixels.
+     */
+    PixelReadback (const Vector2i& position, const Vector2u& size, Uint32 handle);
+    ~PixelReadback ();
+
+    /**
+     * @brief Polls every readback which was given a callback, calling and then dropping those
+     *        whose pixels have arrived.
+     */
+    static void update ();
+
+    /**
+     * @brief Drops every readback which was given a callback, without calling it.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief Has the given function called by @a `update` once this readback's pixels have
+     *        arrived. The readback is kept alive until then.
+     *
+     * @param readback  The readback to watch.
+     * @param callback  The function to call.
+     */
+    static void watch (const Ref<PixelReadback>& readback, const PixelReadbackCallback& callback);
+
+  public:
+
+    /**
+     * @brief   Checks on the transfer, taking its pixels if it is complete.
+     *
+     * @param   wait  Should this wait for the transfer to finish?
+     *
+     * @return  @a `true` if the pixels have arrived; @a `false` otherwise.
+     */
+    Boolean poll (Bool wait = false);
+
+    /**
+     * @brief   Retrieves whether or not this readback's pixels have arrived.
+     *
+     * @return  @a `true` if the pixels have arrived; @a `false` otherwise.
+     */
+    Boolean isReady () const;
+
+    /**
+     * @brief   Retrieves the value of the pixel at the given framebuffer coordinates.
+     *
+     * @param   x   The pixel's X coordinate.
+     * @param   y   The pixel's Y coordinate.
+     *
+     * @return  The value of the pixel; @a `-1` if it lies outside the rectangle read, or if the
+     *          pixels have not arrived.
+     */
+    Int32 getValue (Int32 x, Int32 y) const;
+
+    /**
+     * @brief   Retrieves the value of every pixel read, bottom row first.
+     *
+     * @return  The pixel values; empty if the pixels have not arrived.
+     */
+    const Collection<Int32>& getValues () const;
+
+    /**
+     * @brief   Retrieves each distinct value among the pixels read, such as the IDs of every
+     *          entity within a marquee selection.
+     *
+     * @param   ignored   A value to leave out, such as the one which the attachment is cleared to.
+     *
+     * @return  The distinct pixel values, in ascending order.
+     */
+    Collection<Int32> getDistinctValues (Int32 ignored = -1) const;
+
+    /**
+     * @brief   Retrieves the position of the rectangle read.
+     *
+     * @return  The position of the rectangle's lower-left corner, in pixels.
+     */
+    const Vector2i& getPosition () const;
+
+    /**
+     * @brief   Retrieves the size of the rectangle read.
+     *
+     * @return  The rectangle's size, in pixels.
+     */
+    const Vector2u& getSize () const;
+
+  private:
+    /**
+     * @brief The position of the rectangle's lower-left corner, in pixels.
+     */
+    Vector2i m_position = { 0, 0 };
+
+    /**
+     * @brief The rectangle's size, in pixels.
+     */
+    Vector2u m_size = { 0, 0 };
+
+    /**
+     * @brief The handle of the backend's readback, while the transfer is pending.
+     */
+    Uint32 m_handle = 0;
+
+    /**
+     * @brief Indicates whether or not the pixels have arrived.
+     */
+    Bool m_ready = false;
+
+    /**
+     * @brief The value of every pixel read, bottom row first.
+     */
+    Collection<Int32> m_values;
+
+  private:
+
+    /**
+     * @brief A readback watched by @a `update`, along with the function to call.
+     */
+    struct Watch
+    {
+      Ref<PixelReadback> readback = nullptr;
+      PixelReadbackCallback callback = nullptr;
+    };
+
+    static Collection<Watch> s_watches;
+
+  };
+
+}
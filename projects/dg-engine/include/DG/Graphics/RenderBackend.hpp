@@ -0,0 +1,769 @@
+/** @file DG/Graphics/RenderBackend.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+#include <DG/Graphics/Color.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderBackendType` enum enumerates the kinds of @a `RenderBackend` which can
+   *        carry out the @a `RenderInterface`'s commands.
+   */
+  enum class RenderBackendType
+  {
+    OpenGL,
+    Null
+  };
+
+  /**
+   * @brief The @a `ReadbackStatus` enum enumerates the states of a pixel transfer started with
+   *        @a `RenderBackend::beginReadback`.
+   */
+  enum class ReadbackStatus
+  {
+    Pending,
+    Complete,
+    Failed
+  };
+
+  /**
+   * @brief The @a `ProgramStatus` enum enumerates the states of a shader program whose build was
+   *        started with @a `RenderBackend::beginProgram`.
+   */
+  enum class ProgramStatus
+  {
+    Pending,
+    Linked,
+    Failed
+  };
+
+  /**
+   * @brief The @a `QueryStatus` enum enumerates the states of a timer query started with
+   *        @a `RenderBackend::beginTimerQuery`.
+   */
+  enum class QueryStatus
+  {
+    Pending,
+    Complete,
+    Failed
+  };
+
+  /**
+   * @brief The @a `ShaderUniformType` enum enumerates the types of values which can be sent to a
+   *        shader uniform.
+   */
+  enum class ShaderUniformType
+  {
+    Float,
+    Float2,
+    Float3,
+    Float4,
+    Float2x2,
+    Float3x3,
+    Float4x4,
+    Double,
+    Double2,
+    Double3,
+    Double4,
+    Double2x2,
+    Double3x3,
+    Double4x4,
+    Int,
+    Int2,
+    Int3,
+    Int4,
+    Uint,
+    Uint2,
+    Uint3,
+    Uint4
+  };
+
+  /**
+   * @brief The @a `RenderBackend` class is the interface through which the engine's graphics
+   *        classes issue their commands to the graphics card. Handles and enumerations passed to
+   *        and returned from the backend follow OpenGL's conventions.
+   */
+  class RenderBackend
+  {
+  public:
+    virtual ~RenderBackend () = default;
+
+    /**
+     * @brief   Retrieves the type of this @a `RenderBackend`.
+     *
+     * @return  The backend's @a `RenderBackendType`.
+     */
+    virtual RenderBackendType getType () const = 0;
+
+    /**
+     * @brief Initializes the backend. This is called by the @a `RenderInterface` once a graphics
+     *        context is current.
+     */
+    virtual void initialize () = 0;
+
+  public: // State and Draw Calls
+
+    /**
+     * @brief Sets the viewport of the current framebuffer.
+     * 
+     * @param position  The position of the viewport's lower-left corner, in pixels.
+     * @param size      The viewport's size, in pixels.
+     */
+    virtual void setViewport (const Vector2i& position, const Vector2u& size) = 0;
+
+    /**
+     * @brief Sets the color to clear the current framebuffer to.
+     * 
+     * @param color The color to clear to.
+     */
+    virtual void setClearColor (const Color& color) = 0;
+
+    /**
+     * @brief Clears the color and depth buffers of the current framebuffer.
+     */
+    virtual void clear () = 0;
+
+    /**
+     * @brief Sets a pixel storage mode, such as @a `GL_PACK_ALIGNMENT`.
+     * 
+     * @param name  The pixel storage parameter to set.
+     * @param value The parameter's new value.
+     */
+    virtual void setPixelStore (GLenum name, Int32 value) = 0;
+
+    /**
+     * @brief Draws the vertices of the bound vertex array, as indexed by its index buffer.
+     * 
+     * @param primitive   The type of primitive into which the vertices are grouped.
+     * @param indexCount  The number of indices to draw.
+     * @param indexType   The type of the indices in the index buffer.
+     */
+    virtual void drawIndexed (GLenum primitive, Count indexCount, GLenum indexType) = 0;
+
+  public: // Buffers
+
+    /**
+     * @brief   Creates a new, empty buffer object.
+     * 
+     * @return  The new buffer's handle.
+     */
+    virtual Uint32 createBuffer () = 0;
+
+    /**
+     * @brief Destroys the buffer object with the given handle.
+     * 
+     * @param handle  The handle of the buffer to destroy.
+     */
+    virtual void destroyBuffer (Uint32 handle) = 0;
+
+    /**
+     * @brief Binds a buffer object to the given buffer target.
+     * 
+     * @param target  The buffer target, such as @a `GL_ARRAY_BUFFER`.
+     * @param handle  The handle of the buffer to bind, or @a `0` to un-bind the target.
+     */
+    virtual void bindBuffer (GLenum target, Uint32 handle) = 0;
+
+    /**
+     * @brief Allocates storage for a buffer object, optionally filling it with the given data.
+     * 
+     * @param target  The buffer target to bind the buffer to while allocating.
+     * @param handle  The handle of the buffer to allocate.
+     * @param data    Points to the data to fill the buffer with, or @a `nullptr`.
+     * @param size    The size of the storage to allocate, in bytes.
+     * @param usage   The buffer's expected usage, such as @a `GL_DYNAMIC_DRAW`.
+     */
+    virtual void allocateBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      GLenum usage) = 0;
+
+    /**
+     * @brief Uploads data into a buffer object's existing storage.
+     * 
+     * @param target  The buffer target to bind the buffer to while uploading.
+     * @param handle  The handle of the buffer to upload to.
+     * @param data    Points to the data to upload.
+     * @param size    The size of the data to upload, in bytes.
+     * @param offset  The offset into the buffer's storage at which to upload, in bytes.
+     */
+    virtual void uploadBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      Size offset = 0) = 0;
+
+  public: // Vertex Arrays
+
+    /**
+     * @brief   Creates a new vertex array object.
+     * 
+     * @return  The new vertex array's handle.
+     */
+    virtual Uint32 createVertexArray () = 0;
+
+    /**
+     * @brief Destroys the vertex array object with the given handle.
+     * 
+     * @param handle  The handle of the vertex array to destroy.
+     */
+    virtual void destroyVertexArray (Uint32 handle) = 0;
+
+    /**
+     * @brief Binds a vertex array object.
+     * 
+     * @param handle  The handle of the vertex array to bind, or @a `0` to un-bind.
+     */
+    virtual void bindVertexArray (Uint32 handle) = 0;
+
+    /**
+     * @brief Describes, then enables, a vertex attribute of the bound vertex array, sourced from
+     *        the bound @a `GL_ARRAY_BUFFER`.
+     * 
+     * @param index         The index of the vertex attribute.
+     * @param elementCount  The number of primitive elements in the attribute.
+     * @param type          The type of the attribute's elements.
+     * @param normalized    Should the attribute's values be normalized into a unit range?
+     * @param stride        The distance between consecutive vertices, in bytes.
+     * @param offset        The attribute's offset within a vertex, in bytes.
+     */
+    virtual void setVertexAttribute (Index index, Count elementCount, GLenum type,
+      Bool normalized, Size stride, Size offset) = 0;
+
+  public: // Textures
+
+    /**
+     * @brief   Creates a new texture object.
+     * 
+     * @return  The new texture's handle.
+     */
+    virtual Uint32 createTexture () = 0;
+
+    /**
+     * @brief Destroys the texture object with the given handle.
+     * 
+     * @param handle  The handle of the texture to destroy.
+     */
+    virtual void destroyTexture (Uint32 handle) = 0;
+
+    /**
+     * @brief Binds a texture object to the given texture slot.
+     * 
+     * @param target  The texture target, such as @a `GL_TEXTURE_2D`.
+     * @param handle  The handle of the texture to bind, or @a `0` to un-bind the slot.
+     * @param slot    The texture slot to bind to.
+     */
+    virtual void bindTexture (GLenum target, Uint32 handle, Index slot = 0) = 0;
+
+    /**
+     * @brief Sets an integer parameter, such as a wrap or filter mode, on a texture object.
+     * 
+     * @param target  The texture's target.
+     * @param handle  The handle of the texture.
+     * @param name    The parameter to set.
+     * @param value   The parameter's new value.
+     */
+    virtual void setTextureParameter (GLenum target, Uint32 handle, GLenum name,
+      Int32 value) = 0;
+
+    /**
+     * @brief Allocates storage for a two-dimensional texture, optionally filling it with the
+     *        given pixel data.
+     * 
+     * @param handle          The handle of the texture.
+     * @param internalFormat  The format in which the graphics card stores the texture.
+     * @param size            The texture's size, in pixels.
+     * @param pixelFormat     The format of the given pixel data.
+     * @param dataType        The type of the given pixel data's components.
+     * @param data            Points to the pixel data, or @a `nullptr`.
+     */
+    virtual void allocateTexture2D (Uint32 handle, GLenum internalFormat, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data) = 0;
+
+    /**
+     * @brief Allocates storage for a multisampled, two-dimensional texture.
+     * 
+     * @param handle          The handle of the texture.
+     * @param sampleCount     The number of samples per pixel.
+     * @param internalFormat  The format in which the graphics card stores the texture.
+     * @param size            The texture's size, in pixels.
+     */
+    virtual void allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount,
+      GLenum internalFormat, const Vector2u& size) = 0;
+
+    /**
+     * @brief Allocates immutable storage for a two-dimensional texture and every level of its mip
+     *        chain. The storage's size and format cannot be changed afterwards; a new texture
+     *        object must be created instead.
+     * 
+     * @param handle          The handle of the texture.
+     * @param levelCount      The number of mip levels to allocate, including the base level.
+     * @param internalFormat  The format in which the graphics card stores the texture, which may
+     *                        be a block-compressed format.
+     * @param size            The size of the base level, in pixels.
+     */
+    virtual void allocateTextureStorage2D (Uint32 handle, Count levelCount, GLenum internalFormat,
+      const Vector2u& size) = 0;
+
+    /**
+     * @brief   Retrieves whether or not the graphics card can sample textures stored in the given
+     *          internal format.
+     * 
+     * @param   internalFormat  The internal format to check.
+     * 
+     * @return  @a `true` if the format is supported; @a `false` otherwise.
+     */
+    virtual Bool isTextureFormatSupported (GLenum internalFormat) = 0;
+
+    /**
+     * @brief Uploads pixel data into a region of a two-dimensional texture's existing storage.
+     * 
+     * @param handle      The handle of the texture.
+     * @param offset      The position of the region's lower-left corner, in pixels.
+     * @param size        The region's size, in pixels.
+     * @param pixelFormat The format of the given pixel data.
+     * @param dataType    The type of the given pixel data's components.
+     * @param data        Points to the pixel data.
+     * @param level       The mip level to upload into.
+     */
+    virtual void uploadTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data, Index level = 0) = 0;
+
+    /**
+     * @brief Uploads pixel data staged in a pixel unpack buffer into a region of a two-dimensional
+     *        texture's existing storage. The graphics card copies the pixels on its own time, so
+     *        the caller is not stalled.
+     * 
+     * @param handle        The handle of the texture.
+     * @param offset        The position of the region's lower-left corner, in pixels.
+     * @param size          The region's size, in pixels.
+     * @param pixelFormat   The format of the staged pixel data.
+     * @param dataType      The type of the staged pixel data's components.
+     * @param buffer        The handle of the buffer holding the staged pixel data.
+     * @param bufferOffset  The offset of the pixel data within the buffer, in bytes.
+     * @param level         The mip level to upload into.
+     */
+    virtual void uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset,
+      const Vector2u& size, GLenum pixelFormat, GLenum dataType, Uint32 buffer,
+      Size bufferOffset, Index level = 0) = 0;
+
+    /**
+     * @brief Uploads block-compressed data into a region of a two-dimensional texture's existing
+     *        storage, which must be in the same compressed format.
+     * 
+     * @param handle            The handle of the texture.
+     * @param offset            The position of the region's lower-left corner, in pixels. Must be
+     *                          a multiple of four.
+     * @param size              The region's size, in pixels.
+     * @param compressedFormat  The compressed format of the given data.
+     * @param data              Points to the compressed data.
+     * @param byteCount         The size of the compressed data, in bytes.
+     * @param level             The mip level to upload into.
+     */
+    virtual void uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset,
+      const Vector2u& size, GLenum compressedFormat, const void* data, Size byteCount,
+      Index level = 0) = 0;
+
+    /**
+     * @brief Fills every level of a texture's mip chain below the base level by repeatedly
+     *        downsampling the base level.
+     * 
+     * @param handle  The handle of the texture.
+     */
+    virtual void generateTextureMipmaps (Uint32 handle) = 0;
+
+    /**
+     * @brief Fills every pixel of a texture with the given value.
+     * 
+     * @param handle      The handle of the texture.
+     * @param pixelFormat The format of the given value.
+     * @param dataType    The type of the given value's components.
+     * @param data        Points to the value to clear to.
+     */
+    virtual void clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+      const void* data) = 0;
+
+  public: // Frame Buffers
+
+    /**
+     * @brief   Creates a new framebuffer object.
+     * 
+     * @return  The new framebuffer's handle.
+     */
+    virtual Uint32 createFramebuffer () = 0;
+
+    /**
+     * @brief Destroys the framebuffer object with the given handle.
+     * 
+     * @param handle  The handle of the framebuffer to destroy.
+     */
+    virtual void destroyFramebuffer (Uint32 handle) = 0;
+
+    /**
+     * @brief Binds a framebuffer object for drawing, reading or both.
+     * 
+     * @param target  The framebuffer target, such as @a `GL_DRAW_FRAMEBUFFER`.
+     * @param handle  The handle of the framebuffer, or @a `0` for the window's framebuffer.
+     */
+    virtual void bindFramebuffer (GLenum target, Uint32 handle) = 0;
+
+    /**
+     * @brief Attaches a texture to the framebuffer bound to @a `GL_FRAMEBUFFER`.
+     * 
+     * @param attachment    The attachment point, such as @a `GL_COLOR_ATTACHMENT0`.
+     * @param textureTarget The texture's target.
+     * @param texture       The handle of the texture to attach.
+     */
+    virtual void attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+      Uint32 texture) = 0;
+
+    /**
+     * @brief Selects the color attachments of the bound framebuffer which are drawn into.
+     * 
+     * @param buffers Points to the color attachment points to draw into.
+     * @param count   The number of attachment points. If zero, no color buffer is drawn.
+     */
+    virtual void setDrawBuffers (const GLenum* buffers, Count count) = 0;
+
+    /**
+     * @brief Selects the color attachment of the bound read framebuffer which pixels are read
+     *        from.
+     * 
+     * @param buffer  The color attachment point to read from.
+     */
+    virtual void setReadBuffer (GLenum buffer) = 0;
+
+    /**
+     * @brief Clears one color attachment of a framebuffer with a normalized or floating-point
+     *        format to the given color.
+     * 
+     * @param framebuffer The handle of the framebuffer.
+     * @param index       The index of the color attachment.
+     * @param color       The color to clear to.
+     */
+    virtual void clearFramebufferColor (Uint32 framebuffer, Index index,
+      const Vector4f& color) = 0;
+
+    /**
+     * @brief Clears one color attachment of a framebuffer with an integer format to the given
+     *        value.
+     * 
+     * @param framebuffer The handle of the framebuffer.
+     * @param index       The index of the color attachment.
+     * @param value       The value to clear to.
+     */
+    virtual void clearFramebufferInteger (Uint32 framebuffer, Index index,
+      const Vector4i& value) = 0;
+
+    /**
+     * @brief Clears the depth / stencil attachment of a framebuffer to the given values.
+     * 
+     * @param framebuffer The handle of the framebuffer.
+     * @param depth       The depth value to clear to.
+     * @param stencil     The stencil value to clear to.
+     */
+    virtual void clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+      Int32 stencil) = 0;
+
+    /**
+     * @brief Tells the graphics driver that the contents of the given attachments of a
+     *        framebuffer are no longer needed, so that it need not load or store them.
+     * 
+     * @param framebuffer The handle of the framebuffer.
+     * @param attachments Points to the attachment points whose contents are not needed.
+     * @param count       The number of attachment points.
+     */
+    virtual void invalidateFramebuffer (Uint32 framebuffer, const GLenum* attachments,
+      Count count) = 0;
+
+    /**
+     * @brief Copies a rectangle of one framebuffer's color attachment into a rectangle of
+     *        another's, scaling it to fit. The destination's draw buffers are left as they were.
+     * 
+     * @param source              The handle of the framebuffer to copy from.
+     * @param sourceIndex         The index of the color attachment to copy from.
+     * @param sourcePosition      The position of the source rectangle's lower-left corner.
+     * @param sourceSize          The size of the source rectangle, in pixels.
+     * @param destination         The handle of the framebuffer to copy into; @a `0` for the
+     *                            window's framebuffer.
+     * @param destinationIndex    The index of the color attachment to copy into. Ignored for the
+     *                            window's framebuffer.
+     * @param destinationPosition The position of the destination rectangle's lower-left corner.
+     * @param destinationSize     The size of the destination rectangle, in pixels.
+     * @param linear              Should the pixels be filtered linearly when scaled, rather than
+     *                            taken from the nearest source pixel?
+     */
+    virtual void blitFramebuffer (Uint32 source, Index sourceIndex, const Vector2i& sourcePosition,
+      const Vector2u& sourceSize, Uint32 destination, Index destinationIndex,
+      const Vector2i& destinationPosition, const Vector2u& destinationSize, Bool linear) = 0;
+
+    /**
+     * @brief   Checks whether the framebuffer bound to @a `GL_FRAMEBUFFER` is complete.
+     * 
+     * @return  @a `true` if the framebuffer is complete and ready to be used;
+     *          @a `false` otherwise.
+     */
+    virtual Bool isFramebufferComplete () = 0;
+
+    /**
+     * @brief Reads a rectangle of pixels from the bound read framebuffer.
+     * 
+     * @param position    The position of the rectangle's lower-left corner, in pixels.
+     * @param size        The rectangle's size, in pixels.
+     * @param pixelFormat The format of the pixel data to read.
+     * @param dataType    The type of the pixel data's components.
+     * @param data        Points to the memory which will receive the pixel data.
+     */
+    virtual void readPixels (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType, void* data) = 0;
+
+    /**
+     * @brief   Starts reading a rectangle of pixels from the bound read framebuffer into memory on
+     *          the graphics card, without waiting for the transfer to finish. The pixels are packed
+     *          with no row padding.
+     *
+     * @param   position    The position of the rectangle's lower-left corner, in pixels.
+     * @param   size        The rectangle's size, in pixels.
+     * @param   pixelFormat The format of the pixel data to read.
+     * @param   dataType    The type of the pixel data's components.
+     *
+     * @return  The handle of the new readback.
+     */
+    virtual Uint32 beginReadback (const Vector2i& position, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType) = 0;
+
+    /**
+     * @brief   Checks on a readback started with @a `beginReadback`. Once the transfer is
+     *          complete, its pixels are copied into the given memory and the readback is
+     *          destroyed; its handle may then be handed out again.
+     *
+     * @param   handle  The handle of the readback.
+     * @param   data    Points to the memory which will receive the pixel data. It must be large
+     *                  enough for the whole rectangle.
+     * @param   wait    Should this wait for the transfer to finish?
+     *
+     * @return  The state of the transfer. @a `ReadbackStatus::Failed` is returned for a handle
+     *          which is not that of a pending readback.
+     */
+    virtual ReadbackStatus pollReadback (Uint32 handle, void* data, Bool wait = false) = 0;
+
+    /**
+     * @brief Destroys a readback whose pixels are no longer wanted.
+     *
+     * @param handle  The handle of the readback. Handles of finished readbacks are ignored.
+     */
+    virtual void destroyReadback (Uint32 handle) = 0;
+
+  public: // Timer Queries
+
+    /**
+     * @brief   Starts measuring how long the graphics card takes to carry out the commands which
+     *          follow, until @a `endTimerQuery` is called. Only one timer query may be measuring
+     *          at a time.
+     *
+     * @return  The handle of the new timer query.
+     */
+    virtual Uint32 beginTimerQuery () = 0;
+
+    /**
+     * @brief Stops the timer query which is measuring.
+     */
+    virtual void endTimerQuery () = 0;
+
+    /**
+     * @brief   Checks on a timer query, without waiting for it. Once its result is available, the
+     *          query is destroyed; its handle may then be handed out again.
+     *
+     * @param   handle      The handle of the timer query.
+     * @param   nanoseconds Receives the time measured, in nanoseconds, once it is available.
+     *
+     * @return  The state of the query. @a `QueryStatus::Failed` is returned for a handle which is
+     *          not that of a pending query.
+     */
+    virtual QueryStatus pollTimerQuery (Uint32 handle, Uint64& nanoseconds) = 0;
+
+    /**
+     * @brief Destroys a timer query whose result is no longer wanted.
+     *
+     * @param handle  The handle of the timer query. Handles of finished queries are ignored.
+     */
+    virtual void destroyTimerQuery (Uint32 handle) = 0;
+
+  public: // Fences
+
+    /**
+     * @brief   Inserts a fence after the commands issued so far, which signals once the graphics
+     *          card has carried them all out.
+     *
+     * @return  The handle of the new fence.
+     */
+    virtual Uint32 insertFence () = 0;
+
+    /**
+     * @brief   Checks whether a fence inserted with @a `insertFence` has signaled. Once it has,
+     *          the fence is destroyed; its handle may then be handed out again.
+     *
+     * @param   handle  The handle of the fence.
+     * @param   wait    Should this wait for the fence to signal?
+     *
+     * @return  @a `true` if the fence has signaled, or the handle is not that of a pending fence;
+     *          @a `false` otherwise.
+     */
+    virtual Bool pollFence (Uint32 handle, Bool wait = false) = 0;
+
+    /**
+     * @brief Destroys a fence which is no longer waited on.
+     *
+     * @param handle  The handle of the fence. Handles of signaled fences are ignored.
+     */
+    virtual void destroyFence (Uint32 handle) = 0;
+
+  public: // Shader Programs
+
+    /**
+     * @brief   Compiles and links a shader program from the given vertex and fragment source code.
+     *
+     * @param   vertexCode    The source code of the vertex shader.
+     * @param   fragmentCode  The source code of the fragment shader.
+     *
+     * @return  The handle of the new shader program if it is built successfully;
+     *          @a `0` otherwise.
+     */
+    virtual Uint32 createProgram (const String& vertexCode, const String& fragmentCode) = 0;
+
+    /**
+     * @brief   Starts compiling and linking a shader program from the given vertex and fragment
+     *          source code, without waiting for the build to finish. Where the graphics driver
+     *          supports parallel shader compilation, the build runs on the driver's own threads.
+     *
+     *          The program must not be used until @a `pollProgram` reports that it is linked.
+     *
+     * @param   vertexCode    The source code of the vertex shader.
+     * @param   fragmentCode  The source code of the fragment shader.
+     *
+     * @return  The handle of the new shader program.
+     */
+    virtual Uint32 beginProgram (const String& vertexCode, const String& fragmentCode) = 0;
+
+    /**
+     * @brief   Checks on a shader program whose build was started with @a `beginProgram`. If the
+     *          build failed, its errors are logged and the program is destroyed.
+     *
+     * @param   handle  The handle of the shader program.
+     * @param   wait    Should this wait for the build to finish? If not, and the graphics driver
+     *                  cannot tell whether the build is finished without waiting, the build is
+     *                  reported as pending until it can.
+     *
+     * @return  The state of the program's build.
+     */
+    virtual ProgramStatus pollProgram (Uint32 handle, Bool wait = false) = 0;
+
+    /**
+     * @brief   Creates a shader program from a binary previously retrieved with
+     *          @a `getProgramBinary`. The graphics driver may reject a binary written by another
+     *          driver, or another version of the same driver.
+     *
+     * @param   format    The binary's driver-specific format.
+     * @param   data      Points to the binary.
+     * @param   byteCount The size of the binary, in bytes.
+     *
+     * @return  The handle of the new shader program if the binary is accepted; @a `0` otherwise.
+     */
+    virtual Uint32 createProgramFromBinary (GLenum format, const void* data, Size byteCount) = 0;
+
+    /**
+     * @brief   Retrieves the linked binary of the given shader program, so that it can be handed
+     *          back to @a `createProgramFromBinary` later.
+     *
+     * @param   handle  The handle of the shader program.
+     * @param   format  Receives the binary's driver-specific format.
+     * @param   binary  Receives the binary.
+     *
+     * @return  @a `true` if the binary is retrieved; @a `false` if the driver cannot give one.
+     */
+    virtual Bool getProgramBinary (Uint32 handle, GLenum& format, Collection<Uint8>& binary) = 0;
+
+    /**
+     * @brief   Retrieves a string naming the graphics driver and device, which changes whenever
+     *          program binaries written by one would be unusable by the other.
+     *
+     * @return  The vendor, renderer and version strings of the graphics driver.
+     */
+    virtual String getDeviceName () = 0;
+
+    /**
+     * @brief Destroys the shader program with the given handle.
+     * 
+     * @param handle  The handle of the shader program to destroy.
+     */
+    virtual void destroyProgram (Uint32 handle) = 0;
+
+    /**
+     * @brief Sets the given shader program as the active shader program.
+     * 
+     * @param handle  The handle of the shader program, or @a `0` to un-set the active program.
+     */
+    virtual void useProgram (Uint32 handle) = 0;
+
+    /**
+     * @brief   Sends a value to the uniform with the given name in the given shader program. The
+     *          value is ignored if the program has no such uniform.
+     *
+     * @param   program The handle of the shader program.
+     * @param   name    The name of the shader uniform.
+     * @param   type    The type of the value pointed to by @a `value`.
+     * @param   value   Points to the value to send.
+     */
+    virtual void setUniform (Uint32 program, const String& name, ShaderUniformType type,
+      const void* value) = 0;
+
+  public: // Submission
+
+    /**
+     * @brief Runs the given function where the backend's commands are carried out. This is used
+     *        for calls which the backend does not wrap, such as those made by Dear ImGui. The
+     *        default runs the function immediately.
+     *
+     * @param function  The function to run.
+     */
+    virtual void submit (const LFunction<void>& function);
+
+    /**
+     * @brief Waits for every command issued so far to be carried out. The default does nothing,
+     *        since commands are carried out as they are issued.
+     */
+    virtual void flush ();
+
+    /**
+     * @brief Marks the end of a frame's commands. The default does nothing.
+     */
+    virtual void endFrame ();
+
+    /**
+     * @brief   Resolves a handle returned by this backend into the handle used by the graphics
+     *          card. This may only be called from within a function passed to @a `submit`. The
+     *          default returns the handle unchanged.
+     *
+     * @param   handle  The handle to resolve.
+     *
+     * @return  The resolved handle.
+     */
+    virtual Uint32 resolveHandle (Uint32 handle) const;
+
+  public: // Helpers
+
+    /**
+     * @brief   Calculates the size, in bytes, of an image with the given pixel format and data
+     *          type.
+     *
+     * @param   size        The width and height of the image, in pixels.
+     * @param   pixelFormat The image's pixel format, such as @a `GL_RGBA`.
+     * @param   dataType    The data type of each of the image's color channels.
+     * @param   alignment   The alignment of the start of each row of pixels, in bytes.
+     *
+     * @return  The size of the image, in bytes.
+     */
+    static Size getImageByteCount (const Vector2u& size, GLenum pixelFormat, GLenum dataType,
+      const Size alignment = 1);
+
+  };
+
+}
@@ -0,0 +1,115 @@
+/** @file DG/Graphics/RenderCommandQueue.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderCommandQueue` class records functions to be run later, in order, on
+   *        another thread. Functions and any data they point to are stored in blocks of memory
+   *        which are kept between frames, so recording a frame does not allocate once the blocks
+   *        have grown large enough.
+   */
+  class RenderCommandQueue
+  {
+  public:
+    RenderCommandQueue () = default;
+    RenderCommandQueue (RenderCommandQueue&&) = default;
+    RenderCommandQueue& operator= (RenderCommandQueue&&) = default;
+    RenderCommandQueue (const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator= (const RenderCommandQueue&) = delete;
+    ~RenderCommandQueue ();
+
+    /**
+     * @brief Records a function to be run by the next call to @a `execute`.
+     *
+     * @tparam F  The type of function to record.
+     *
+     * @param function  The function to record.
+     */
+    template <typename F>
+    inline void submit (F&& function)
+    {
+      using Command = std::decay_t<F>;
+
+      void* memory = allocate(sizeof(Command), alignof(Command));
+      new (memory) Command { std::forward<F>(function) };
+
+      m_commands.push_back({
+        memory,
+        [] (void* object, Bool run)
+        {
+          auto command = static_cast<Command*>(object);
+          if (run == true) {
+            try { (*command)(); }
+            catch (...) { command->~Command(); throw; }
+          }
+          command->~Command();
+        }
+      });
+    }
+
+    /**
+     * @brief   Copies data into the queue's memory, so that a recorded function can read it after
+     *          the caller's copy is gone.
+     *
+     * @param   data  The data to copy.
+     * @param   size  The size of the data, in bytes.
+     *
+     * @return  A pointer to the copy, which stays valid until the queue is executed or cleared;
+     *          @a `nullptr` if the given data is null.
+     */
+    void* copy (const void* data, const Size size);
+
+    /**
+     * @brief Runs, then discards, every recorded function in the order they were recorded.
+     */
+    void execute ();
+
+    /**
+     * @brief Discards every recorded function without running it.
+     */
+    void clear ();
+
+    /**
+     * @brief   Retrieves the number of functions recorded.
+     *
+     * @return  The number of recorded functions.
+     */
+    Count getCommandCount () const;
+
+  private:
+    void* allocate (const Size size, const Size alignment);
+    void reset (Index first);
+
+  private:
+
+    /**
+     * @brief The size of each block of memory, in bytes. Larger allocations get a block of their
+     *        own.
+     */
+    static constexpr Size BLOCK_SIZE = 64 * 1024;
+
+    struct Command
+    {
+      void* object;
+      void (*invoke) (void*, Bool);
+    };
+
+    struct Block
+    {
+      Scope<Uint8[]>  data;
+      Size            size = 0;
+      Size            used = 0;
+    };
+
+    Collection<Command> m_commands;
+    Collection<Block>   m_blocks;
+    Index               m_blockIndex = 0;
+
+  };
+
+}
@@ -0,0 +1,278 @@
+/** @file DG/Graphics/RenderGraph.hpp */
+
+#pragma once
+
+#include <DG/Graphics/RenderTargetPool.hpp>
+
+namespace dg
+{
+
+  class RenderGraph;
+
+  /**
+   * @brief Identifies a render target declared in a @a `RenderGraph`.
+   */
+  using RenderGraphResource = Index;
+
+  /**
+   * @brief The @a `RenderGraphStats` struct reports what a @a `RenderGraph` made of its passes
+   *        when it was last compiled.
+   */
+  struct RenderGraphStats
+  {
+    /**
+     * @brief The number of passes declared.
+     */
+    Count passCount = 0;
+
+    /**
+     * @brief The number of passes culled, since nothing kept uses what they draw.
+     */
+    Count culledPassCount = 0;
+
+    /**
+     * @brief The number of transient render targets used by the passes which are kept.
+     */
+    Count transientCount = 0;
+
+    /**
+     * @brief The approximate video memory which the transient render targets would hold if each
+     *        had its own, in bytes.
+     */
+    Size transientByteCount = 0;
+
+    /**
+     * @brief The approximate video memory held by the transient render targets which are alive
+     *        at once, at the worst point in the frame, in bytes.
+     */
+    Size peakTransientByteCount = 0;
+  };
+
+  /**
+   * @brief The @a `RenderGraphBuilder` class is handed to a pass's setup function, so that the
+   *        pass can declare the render targets it creates, reads and draws into.
+   */
+  class RenderGraphBuilder
+  {
+  public:
+
+    /**
+     * @brief   Declares a transient render target. It is only given a @a `FrameBuffer` for the
+     *          part of the frame in which it is used, and that frame buffer may be shared with
+     *          other transient targets used at other times.
+     *
+     * @param   name  The render target's name, for debugging purposes.
+     * @param   spec  The render target's specification.
+     *
+     * @return  The new render target.
+     */
+    RenderGraphResource create (const String& name, const FrameBufferSpecification& spec);
+
+    /**
+     * @brief Declares that this pass reads the given render target, such as by sampling its
+     *        attachments.
+     *
+     * @param resource  The render target to read.
+     *
+     * @throw @a `std::invalid_argument` if the render target does not exist.
+     * @throw @a `std::runtime_error` if the render target is transient, and no earlier pass draws
+     *        into it.
+     */
+    void read (RenderGraphResource resource);
+
+    /**
+     * @brief Declares that this pass draws into the given render target. The graph begins the
+     *        render pass before the pass's execute function is called, and ends it afterwards.
+     *
+     * @param resource  The render target to draw into.
+     * @param pass      What the pass does with the target's attachments as it begins and ends.
+     *                  A pass which loads none of them makes earlier passes drawing into the same
+     *                  target redundant.
+     *
+     * @throw @a `std::invalid_argument` if the render target does not exist, or if this pass
+     *        already draws into another.
+     */
+    void write (RenderGraphResource resource, const RenderPassDescriptor& pass = {});
+
+    /**
+     * @brief Marks this pass as one which is never culled, such as one which draws the GUI into
+     *        the window.
+     */
+    void setSideEffect ();
+
+  private:
+    friend class RenderGraph;
+    RenderGraphBuilder (RenderGraph& graph, Index passIndex);
+
+    RenderGraph&  m_graph;
+    Index         m_passIndex = 0;
+
+  };
+
+  /**
+   * @brief The @a `RenderGraphContext` class is handed to a pass's execute function, so that the
+   *        pass can get at the frame buffers behind the render targets it declared.
+   */
+  class RenderGraphContext
+  {
+  public:
+
+    /**
+     * @brief   Retrieves the @a `FrameBuffer` behind the given render target.
+     *
+     * @param   resource  The render target.
+     *
+     * @return  A shared pointer to the frame buffer.
+     *
+     * @throw   @a `std::invalid_argument` if the render target does not exist.
+     * @throw   @a `std::runtime_error` if the render target has no frame buffer right now, since
+     *          the pass being executed did not declare it.
+     */
+    const Ref<FrameBuffer>& getTarget (RenderGraphResource resource) const;
+
+  private:
+    friend class RenderGraph;
+    RenderGraphContext (const RenderGraph& graph);
+
+    const RenderGraph& m_graph;
+
+  };
+
+  /**
+   * @brief A function which declares what a render graph pass creates, reads and draws into.
+   */
+  using RenderGraphSetupFunction = LFunction<void, RenderGraphBuilder&>;
+
+  /**
+   * @brief A function which carries out a render graph pass.
+   */
+  using RenderGraphExecuteFunction = LFunction<void, RenderGraphContext&>;
+
+  /**
+   * @brief The @a `RenderGraph` class runs a frame's rendering as a series of passes, each of
+   *        which declares the render targets it reads and draws into, rather than drawing into
+   *        @a `FrameBuffer`s which are created by hand and live forever.
+   *
+   *        Passes run in the order they are added, which is always a valid order, since a pass can
+   *        only read what an earlier pass has drawn. When the graph is compiled, passes whose
+   *        output nothing kept uses are culled; a pass is kept if it has a side effect, draws into
+   *        an imported target, or draws into a target which a kept pass reads.
+   *
+   *        Transient targets are acquired from the @a `RenderTargetPool` just before the first
+   *        pass which uses them, and released just after the last, so that targets used at
+   *        different times in the frame share a frame buffer where their formats allow.
+   *
+   *        A graph is meant to be built, compiled and executed once per frame, then cleared.
+   */
+  class RenderGraph
+  {
+  public:
+
+    /**
+     * @brief   Imports a long-lived @a `FrameBuffer`, such as the one shown in a viewport, into
+     *          the graph. Passes drawing into it are never culled, and it is never shared.
+     *
+     * @param   name    The render target's name, for debugging purposes.
+     * @param   target  The frame buffer to import.
+     *
+     * @return  The new render target.
+     *
+     * @throw   @a `std::invalid_argument` if the frame buffer is null.
+     */
+    RenderGraphResource importTarget (const String& name, const Ref<FrameBuffer>& target);
+
+    /**
+     * @brief Adds a pass to the graph. Its setup function is called right away.
+     *
+     * @param name      The pass's name, for debugging purposes.
+     * @param setup     The function declaring what the pass creates, reads and draws into.
+     * @param execute   The function carrying out the pass.
+     */
+    void addPass (const String& name, const RenderGraphSetupFunction& setup,
+      const RenderGraphExecuteFunction& execute);
+
+    /**
+     * @brief Culls the passes which are not needed, then works out when each transient render
+     *        target is first and last used.
+     */
+    void compile ();
+
+    /**
+     * @brief Carries out every pass which was not culled, compiling the graph first if need be.
+     */
+    void execute ();
+
+    /**
+     * @brief Removes every pass and render target, so that the next frame's graph can be built.
+     */
+    void clear ();
+
+    /**
+     * @brief   Retrieves the names of the passes which are carried out, in order.
+     *
+     * @return  The pass names. Empty if the graph has not been compiled.
+     */
+    Collection<String> getExecutionOrder () const;
+
+    /**
+     * @brief   Retrieves what the graph made of its passes when it was last compiled.
+     *
+     * @return  The graph's statistics.
+     */
+    const RenderGraphStats& getStats () const;
+
+  private:
+    friend class RenderGraphBuilder;
+    friend class RenderGraphContext;
+
+    /**
+     * @brief A render target declared in the graph.
+     */
+    struct Resource
+    {
+      String                    name = "";
+      FrameBufferSpecification  spec;
+      Ref<FrameBuffer>          target = nullptr;
+      Bool                      imported = false;
+      Count                     writerCount = 0;
+    };
+
+    /**
+     * @brief A pass added to the graph.
+     */
+    struct Pass
+    {
+      String                          name = "";
+      RenderGraphExecuteFunction      execute = nullptr;
+      Collection<RenderGraphResource> reads;
+      RenderGraphResource             target = 0;
+      Bool                            writes = false;
+      RenderPassDescriptor            pass;
+      Bool                            sideEffect = false;
+    };
+
+    /**
+     * @brief A pass which is carried out, along with the transient targets acquired just before
+     *        it and released just after it.
+     */
+    struct Step
+    {
+      Index                           passIndex = 0;
+      Collection<RenderGraphResource> acquires;
+      Collection<RenderGraphResource> releases;
+    };
+
+    /**
+     * @brief Ensures that the given render target exists.
+     */
+    Resource& getResource (RenderGraphResource resource, const char* function);
+
+    Collection<Resource>  m_resources;
+    Collection<Pass>      m_passes;
+    Collection<Step>      m_steps;
+    Bool                  m_compiled = false;
+    RenderGraphStats      m_stats;
+
+  };
+
+}
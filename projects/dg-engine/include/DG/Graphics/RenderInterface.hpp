@@ -5,6 +5,8 @@
 #include <DG_Pch.hpp>
 #include <DG/Graphics/Color.hpp>
 #include <DG/Graphics/VertexArray.hpp>
+#include <DG/Graphics/RenderBackend.hpp>
+#include <DG/Graphics/ThreadedRenderBackend.hpp>
 
 namespace dg
 {
@@ -22,16 +24,44 @@ namespace dg
 
   /**
    * @brief The @a `RenderInterface` class is a static helper class which is used by the
-   *        @a `Renderer` to directly interface with OpenGL.
+   *        @a `Renderer` to interface with the graphics card through a @a `RenderBackend`.
    */
   class RenderInterface
   {
   public:
 
     /**
-     * @brief Initializes the render interface.
+     * @brief Initializes the render interface, creating the backend through which its commands
+     *        are carried out.
+     *
+     * @param type    The type of @a `RenderBackend` to create.
+     * @param thread  Describes the dedicated render thread, if one is to carry out the backend's
+     *                commands.
+     */
+    static void initialize (const RenderBackendType type = RenderBackendType::OpenGL,
+      const RenderThreadSpecification& thread = {});
+
+    /**
+     * @brief Destroys the render interface's backend.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief   Retrieves the backend through which the render interface's commands are carried out.
+     *
+     * @return  The current @a `RenderBackend`.
+     *
+     * @throw   @a `std::runtime_error` if the render interface has not been initialized.
+     */
+    static RenderBackend& getBackend ();
+
+    /**
+     * @brief   Retrieves whether or not the backend's commands are carried out on a dedicated
+     *          render thread.
+     *
+     * @return  @a `true` if a render thread is in use; @a `false` otherwise.
      */
-    static void initialize ();
+    static Bool isThreaded ();
 
     /**
      * @brief   Sets the viewport of the current framebuffer.
@@ -47,6 +77,14 @@ namespace dg
      */
     static void setClearColor (const Color& color);
 
+    /**
+     * @brief   Retrieves the color which the current framebuffer is cleared to. Render passes
+     *          clear color attachments which they say nothing about to this color, too.
+     *
+     * @return  The clear color.
+     */
+    static const Color& getClearColor ();
+
     /**
      * @brief Clears the current framebuffer, or the window if none is set.
      */
@@ -90,6 +128,21 @@ namespace dg
      */
     static RenderPrimitiveType s_primitiveType;
 
+    /**
+     * @brief The backend through which commands are carried out.
+     */
+    static Scope<RenderBackend> s_backend;
+
+    /**
+     * @brief Whether or not the backend's commands are carried out on a dedicated render thread.
+     */
+    static Bool s_threaded;
+
+    /**
+     * @brief The color which the current framebuffer is cleared to.
+     */
+    static Color s_clearColor;
+
   };
 
 }
@@ -0,0 +1,116 @@
+/** @file DG/Graphics/RenderPass.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Color.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderPassLoadOp` enum enumerates what becomes of an attachment's contents at
+   *        the start of a render pass: they may be kept and drawn over, cleared to the
+   *        attachment's clear value, or left undefined when every pixel is about to be
+   *        overwritten anyway.
+   */
+  enum class RenderPassLoadOp
+  {
+    Load,
+    Clear,
+    DontCare
+  };
+
+  /**
+   * @brief The @a `RenderPassStoreOp` enum enumerates what becomes of an attachment's contents at
+   *        the end of a render pass: they may be kept to be read or drawn over later, or
+   *        discarded when they are not needed after the pass, as is often so of a depth buffer.
+   */
+  enum class RenderPassStoreOp
+  {
+    Store,
+    Discard
+  };
+
+  /**
+   * @brief The @a `RenderPassColorAttachment` struct describes how a render pass treats one of a
+   *        @a `FrameBuffer`'s color attachments.
+   */
+  struct RenderPassColorAttachment
+  {
+
+    /**
+     * @brief What becomes of the attachment's contents at the start of the pass.
+     */
+    RenderPassLoadOp load = RenderPassLoadOp::Clear;
+
+    /**
+     * @brief What becomes of the attachment's contents at the end of the pass.
+     */
+    RenderPassStoreOp store = RenderPassStoreOp::Store;
+
+    /**
+     * @brief The color which a normalized color attachment, such as @a `ColorRGBA8`, is cleared
+     *        to.
+     */
+    Color clearColor;
+
+    /**
+     * @brief The value which an integer color attachment, such as @a `ColorR32`, is cleared to.
+     */
+    Int32 clearInteger = -1;
+
+  };
+
+  /**
+   * @brief The @a `RenderPassDepthAttachment` struct describes how a render pass treats a
+   *        @a `FrameBuffer`'s depth / stencil attachment.
+   */
+  struct RenderPassDepthAttachment
+  {
+
+    /**
+     * @brief What becomes of the attachment's contents at the start of the pass.
+     */
+    RenderPassLoadOp load = RenderPassLoadOp::Clear;
+
+    /**
+     * @brief What becomes of the attachment's contents at the end of the pass.
+     */
+    RenderPassStoreOp store = RenderPassStoreOp::Store;
+
+    /**
+     * @brief The depth value which the attachment is cleared to.
+     */
+    Float32 clearDepth = 1.0f;
+
+    /**
+     * @brief The stencil value which the attachment is cleared to.
+     */
+    Int32 clearStencil = 0;
+
+  };
+
+  /**
+   * @brief The @a `RenderPassDescriptor` struct describes what a render pass does with each of a
+   *        @a `FrameBuffer`'s attachments as it starts and ends. Clearing only what needs it, and
+   *        telling the driver which contents are not needed, saves the graphics card from moving
+   *        pixels which are never looked at - which matters most with multisampled targets.
+   */
+  struct RenderPassDescriptor
+  {
+
+    /**
+     * @brief Describes the color attachments, in the order the @a `FrameBuffer` lists them.
+     *        Color attachments without an entry here are cleared to the
+     *        @a `RenderInterface`'s clear color (or to @a `-1`, for integer formats) and stored.
+     */
+    Collection<RenderPassColorAttachment> colorAttachments;
+
+    /**
+     * @brief Describes the depth / stencil attachment, if the @a `FrameBuffer` has one.
+     */
+    RenderPassDepthAttachment depthAttachment;
+
+  };
+
+}
@@ -0,0 +1,164 @@
+/** @file DG/Graphics/RenderTargetPool.hpp */
+
+#pragma once
+
+#include <DG/Graphics/FrameBuffer.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderTargetPoolSpecification` struct describes attributes defining the
+   *        @a `RenderTargetPool`.
+   */
+  struct RenderTargetPoolSpecification
+  {
+
+    /**
+     * @brief The headroom given to the render targets which the pool creates, as a fraction of
+     *        their size, unless they ask for more. See @a `FrameBufferSpecification::headroom`.
+     */
+    Float32 headroom = 0.25f;
+
+    /**
+     * @brief The number of frames for which a released render target is kept without being
+     *        acquired again, before it is destroyed. If zero, released targets are kept until the
+     *        pool is shut down.
+     */
+    Count maxIdleFrames = 120;
+
+  };
+
+  /**
+   * @brief The @a `RenderTargetPoolStats` struct reports how often the @a `RenderTargetPool` has
+   *        been able to hand back a render target it already had.
+   */
+  struct RenderTargetPoolStats
+  {
+    /**
+     * @brief The number of render targets held by the pool, acquired or not.
+     */
+    Count pooledCount = 0;
+
+    /**
+     * @brief The number of render targets currently acquired.
+     */
+    Count acquiredCount = 0;
+
+    /**
+     * @brief The approximate video memory held by the pool's render targets, in bytes.
+     */
+    Size byteCount = 0;
+
+    /**
+     * @brief The number of acquisitions handed a render target which the pool already had.
+     */
+    Count hitCount = 0;
+
+    /**
+     * @brief The number of acquisitions for which a new render target had to be created.
+     */
+    Count missCount = 0;
+
+    /**
+     * @brief The number of idle render targets destroyed since the pool was initialized.
+     */
+    Count evictionCount = 0;
+
+    /**
+     * @brief The number of frames counted since the pool was initialized.
+     */
+    Index frame = 0;
+  };
+
+  /**
+   * @brief The @a `RenderTargetPool` class is a static helper class which recycles transient
+   *        @a `FrameBuffer`s, such as those backing a resizable viewport panel or an intermediate
+   *        rendering pass, so that they need not be rebuilt whenever their size changes.
+   *
+   *        Render targets are matched by their attachment formats and sample count. A released
+   *        target whose attachments' capacity fits the size asked for is handed back with its
+   *        size changed, and is drawn into through a viewport of that size; only when no such
+   *        target is free is a new one created, with some headroom so that it can grow later.
+   */
+  class RenderTargetPool
+  {
+  public:
+
+    /**
+     * @brief Sets up the render target pool with the given specification.
+     *
+     * @param spec  The render target pool's specification.
+     */
+    static void initialize (const RenderTargetPoolSpecification& spec = {});
+
+    /**
+     * @brief Drops every render target held by the pool, and clears the pool's numbers. Targets
+     *        which are still acquired stay alive for as long as their holders keep them.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief   Acquires a render target matching the given specification, re-using a released
+     *          one if one fits.
+     *
+     * @param   spec  The render target's specification.
+     *
+     * @return  A shared pointer to the render target. Its size is that of the specification, but
+     *          its capacity may be larger.
+     *
+     * @throw   @a `std::invalid_argument` if the specification's size is zero.
+     */
+    static Ref<FrameBuffer> acquire (const FrameBufferSpecification& spec);
+
+    /**
+     * @brief   Hands a render target back to the pool, so that later acquisitions can re-use it.
+     *
+     * @param   target  The render target to release.
+     *
+     * @throw   @a `std::invalid_argument` if the render target was not acquired from the pool.
+     */
+    static void release (const Ref<FrameBuffer>& target);
+
+    /**
+     * @brief Destroys released render targets which have been idle for too long, then moves on to
+     *        the next frame. Called once at the start of every frame.
+     */
+    static void update ();
+
+    /**
+     * @brief   Retrieves the render target pool's numbers.
+     *
+     * @return  The pool's statistics.
+     */
+    static const RenderTargetPoolStats& getStats ();
+
+  private:
+
+    /**
+     * @brief A render target held by the pool.
+     */
+    struct Entry
+    {
+      Ref<FrameBuffer> target = nullptr;
+      Bool acquired = false;
+      Index lastUsedFrame = 0;
+    };
+
+    /**
+     * @brief Checks whether a render target can be handed out for the given specification.
+     */
+    static Bool fits (const FrameBuffer& target, const FrameBufferSpecification& spec);
+
+    /**
+     * @brief Recounts the render targets held by the pool.
+     */
+    static void count ();
+
+    static RenderTargetPoolSpecification  s_spec;
+    static RenderTargetPoolStats          s_stats;
+    static Collection<Entry>              s_entries;
+
+  };
+
+}
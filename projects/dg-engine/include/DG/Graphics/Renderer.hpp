@@ -2,12 +2,19 @@
 
 #pragma once
 
+#include <DG/Graphics/DynamicResolution.hpp>
 #include <DG/Graphics/FrameBuffer.hpp>
+#include <DG/Graphics/OrthographicCamera2D.hpp>
+#include <DG/Graphics/RenderTargetPool.hpp>
 #include <DG/Graphics/Color.hpp>
 #include <DG/Graphics/VertexArray.hpp>
 #include <DG/Graphics/Shader.hpp>
+#include <DG/Graphics/ShaderCache.hpp>
 #include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/SubTexture.hpp>
 #include <DG/Graphics/RenderInterface.hpp>
+#include <DG/Math/Transform2D.hpp>
+#include <DG/Scene/Components.hpp>
 
 namespace dg
 {
@@ -51,11 +58,28 @@ namespace dg
      */
     Matrix4f cameraProduct = Matrix4f { 1.0f };
 
+    /**
+     * @brief Indicates whether or not quads falling wholly outside of @a `viewBounds` are skipped.
+     *        This is only the case for scenes begun with an @a `OrthographicCamera2D`.
+     */
+    Bool cullToView = false;
+
+    /**
+     * @brief The bounds of the part of the world seen by the current scene's camera.
+     */
+    AABB2D viewBounds;
+
     /**
      * @brief Points to a @a `FrameBuffer` to which the 2D scene will be rendered.
      */
     Ref<FrameBuffer> framebuffer = nullptr;
 
+    /**
+     * @brief Describes what each 2D scene does with the frame buffer's attachments as it begins
+     *        and ends.
+     */
+    RenderPassDescriptor pass;
+
     /**
      * @brief Points to a blank, white, 1x1 pixel texture. This texture is to be used when rendering
      *        non-textured primitives.
@@ -141,6 +165,11 @@ namespace dg
      */
     Count batchCount = 0;
 
+    /**
+     * @brief The number of quads skipped in the current 2D scene for being out of view.
+     */
+    Count culledCount = 0;
+
   };
 
   /**
@@ -161,6 +190,13 @@ namespace dg
      */
     Ref<Texture> texture = nullptr;
 
+    /**
+     * @brief Points to a region of a @a `Texture`, such as a frame of a sprite sheet, to be
+     *        rendered over the top of the primitive. If given, this takes the place of
+     *        @a `texture`.
+     */
+    Ref<SubTexture> subTexture = nullptr;
+
     /**
      * @brief Indicates the ID of an entity, if any, to which the primitive being rendered may
      *        belong.
@@ -175,6 +211,43 @@ namespace dg
   struct RendererSpecification
   {
 
+    /**
+     * @brief The type of backend through which the renderer's commands are carried out. The
+     *        @a `Null` backend records commands instead of drawing, and needs no OpenGL context.
+     */
+    RenderBackendType backend = RenderBackendType::OpenGL;
+
+    /**
+     * @brief Describes the dedicated render thread, if the backend's commands are to be carried
+     *        out on one.
+     */
+    RenderThreadSpecification thread;
+
+    /**
+     * @brief Describes how textures loaded from files are uploaded to the graphics card.
+     */
+    TextureUploadSpecification uploads;
+
+    /**
+     * @brief Describes the video memory budget kept by @a `Texture` assets.
+     */
+    TextureResidencySpecification residency;
+
+    /**
+     * @brief Describes where linked shader program binaries are cached between launches.
+     */
+    ShaderCacheSpecification shaderCache;
+
+    /**
+     * @brief Describes how transient render targets are recycled.
+     */
+    RenderTargetPoolSpecification targets;
+
+    /**
+     * @brief Describes how the resolution of the 2D scene adapts to the time taken to draw it.
+     */
+    DynamicResolutionSpecification resolution;
+
   };
 
   /**
@@ -197,11 +270,15 @@ namespace dg
   public: // Use Shader / Frame Buffer
 
     /**
-     * @brief   Sets the frame buffer into which a 2D scene will be rendered.
+     * @brief   Sets the frame buffer into which a 2D scene will be rendered, and what each scene
+     *          does with its attachments. By default, every attachment is cleared as a scene
+     *          begins, and stored as it ends.
      * 
      * @param   framebuffer Points to the @a `FrameBuffer` to be used.
+     * @param   pass        The render pass's descriptor.
      */
-    void useFrameBuffer2D (const Ref<FrameBuffer>& framebuffer);
+    void useFrameBuffer2D (const Ref<FrameBuffer>& framebuffer,
+      const RenderPassDescriptor& pass = {});
 
     /**
      * @brief   Sets the shader to be used for rendering quads in two-dimensional space.
@@ -229,6 +306,15 @@ namespace dg
      */
     void beginScene2D (const Matrix4f& projection, const Matrix4f& view);
 
+    /**
+     * @brief   Begins rendering a new scene in two-dimensional space, as seen by the given camera.
+     *          Quads submitted to this scene which fall wholly outside the camera's bounds are
+     *          skipped.
+     * 
+     * @param   camera  The camera through which the scene is seen.
+     */
+    void beginScene2D (const OrthographicCamera2D& camera);
+
     /**
      * @brief   Flushes the current 2D rendering batch, rendering any vertices which have been
      *          submitted.
@@ -265,18 +351,50 @@ namespace dg
     void submitQuad2D (const Vector3f& position, const Vector2f& size, const Float32 rotation,
       const RenderDrawSpecification2D& spec = {});
 
+    /**
+     * @brief   Submits a quad to be rendered in two-dimensional space. The quad's corners are
+     *          worked out from the transformation with a few multiply-adds, rather than four
+     *          matrix products, so this is the cheapest way to submit a quad.
+     * 
+     * @param   transform The quad's transformation, which places its unit square in the world.
+     * @param   depth     The quad's Z coordinate.
+     * @param   spec      Describes how the quad should be rendered.
+     */
+    void submitQuad2D (const Transform2D& transform, const Float32 depth,
+      const RenderDrawSpecification2D& spec = {});
+
+    /**
+     * @brief   Submits a run of sprites to be rendered in two-dimensional space, such as the
+     *          entities of a @a `Scene`. The arrays are read in step, and each sprite is drawn with
+     *          its entity's index as its entity ID, for picking. A texture shared by neighbouring
+     *          sprites is only slotted once.
+     * 
+     * @param   transforms  The sprites' transformations.
+     * @param   sprites     Describes how each sprite should be rendered.
+     * @param   entities    The entity to which each sprite belongs.
+     * @param   count       The number of sprites in each array.
+     */
+    void submitSprites2D (const TransformComponent* transforms,
+      const SpriteRendererComponent* sprites, const entt::entity* entities, const Count count);
+
   public: // Getters / Setters
 
     inline Count getVertexCount2D () const { return m_renderData2D.totalVertexCount; }
     inline Count getIndexCount2D () const { return m_renderData2D.totalIndexCount; }
     inline Count getBatchCount2D () const { return m_renderData2D.batchCount; }
+    inline Count getCulledCount2D () const { return m_renderData2D.culledCount; }
 
   private: // Vertex Submission Functions
 
     void submitQuadVertex2D (const QuadVertex2D& vertex);
+    void submitQuadCorners2D (const Vector3f* corners, const RenderDrawSpecification2D& spec);
+    void writeQuad2D (const Vector3f* corners, const Vector2f* textureCoordinates,
+      const Float32 textureIndex, const Vector4f& color, const Float32 entityId);
 
   private: // Other Private Functions
 
+    void getQuadCorners2D (const Transform2D& transform, const Float32 depth, Vector3f* corners);
+    Bool cullQuad2D (const Vector3f* corners);
     Index slotTexture2D (const Ref<Texture>& texture);
 
   private:
@@ -3,10 +3,36 @@
 #pragma once
 
 #include <DG/Graphics/GraphicsBuffers.hpp>
+#include <DG/Graphics/RenderBackend.hpp>
 
 namespace dg
 {
 
+  /**
+   * @brief The @a `ShaderSources` struct holds the source code read from a shader file.
+   */
+  struct ShaderSources
+  {
+
+    /**
+     * @brief The source code of the vertex shader, following the @a `#shader vertex` directive.
+     */
+    String vertexCode = "";
+
+    /**
+     * @brief The source code of the fragment shader, following the @a `#shader fragment`
+     *        directive.
+     */
+    String fragmentCode = "";
+
+    /**
+     * @brief The names given by the file's @a `#feature` directives, in the order they appear.
+     *        These are used by @a `ShaderVariantSet`, and ignored otherwise.
+     */
+    Collection<String> features;
+
+  };
+
   /**
    * @brief The @a `Shader` class describes a small program which instructs the graphics card on how
    *        to render the vertices in a @a `VertexBuffer`.
@@ -57,6 +83,32 @@ namespace dg
      */
     Boolean loadFromSources (const String& vertexCode, const String& fragmentCode);
 
+    /**
+     * @brief Starts building a shader program from the given source code strings, without waiting
+     *        for the build to finish. Until @a `poll` reports that the new program is linked, this
+     *        @a `Shader` keeps using its previous program, if it had one.
+     *
+     *        If the program's binary is cached, it is loaded right away instead.
+     *
+     * @param vertexCode    The source code of the vertex shader.
+     * @param fragmentCode  The source code of the fragment (or pixel) shader.
+     *
+     * @return  @a `true` if the build is started, or the cached program is loaded; @a `false` if
+     *          either source code string is empty.
+     */
+    Boolean loadFromSourcesAsync (const String& vertexCode, const String& fragmentCode);
+
+    /**
+     * @brief   Checks on the build started by @a `loadFromSourcesAsync`. Once the new program is
+     *          linked, it replaces this @a `Shader`'s previous program.
+     *
+     * @param   wait  Should this wait for the build to finish?
+     *
+     * @return  The state of the build; if no build is pending, @a `ProgramStatus::Linked` if this
+     *          @a `Shader` is valid, and @a `ProgramStatus::Failed` otherwise.
+     */
+    ProgramStatus poll (Bool wait = false);
+
     /**
      * @brief Attempts to build a shader program from source code loaded from the given file.
      * 
@@ -67,6 +119,17 @@ namespace dg
      */
     Boolean loadFromFile (const Path& path);
 
+    /**
+     * @brief Reads the source code of each shader stage, and the names of any features, from the
+     *        given shader file.
+     *
+     * @param path      The path to the shader file to read.
+     * @param sources   Receives the source code and feature names.
+     *
+     * @return  @a `true` if the file is read and its directives are valid; @a `false` otherwise.
+     */
+    static Boolean readFile (const Path& path, ShaderSources& sources);
+
     /**
      * @brief Sets the value of a shader uniform of type @a `T` mapped to the given string name.
      * 
@@ -85,6 +148,14 @@ namespace dg
      */
     Boolean isValid () const;
 
+    /**
+     * @brief Retrieves whether or not this @a `Shader` has a build which is still pending.
+     *
+     * @return  @a `true` if a build started by @a `loadFromSourcesAsync` is still pending;
+     *          @a `false` otherwise.
+     */
+    Boolean isPending () const;
+
   private:
     /**
      * @brief Attempts to build the shader program.
@@ -93,21 +164,17 @@ namespace dg
      */
     Boolean build ();
 
-    /**
-     * @brief Attempts to resolve the given shader uniform name to an ID on the shader program.
-     * 
-     * @param name  The name of the shader uniform to resolve.
-     * 
-     * @return  The resolved integer ID of the shader uniform if found; @a `-1` otherwise. 
-     */
-    Int32 findUniform (StringView name);
-
   private:
     /**
      * @brief The unique ID pointing to this shader program on the graphics card.
      */
     Uint32 m_handle = 0;
 
+    /**
+     * @brief The unique ID of the shader program being built in the background, if any.
+     */
+    Uint32 m_pendingHandle = 0;
+
     /**
      * @brief The source code of the vertex shader.
      */
@@ -138,6 +205,20 @@ namespace dg
      */
     static Ref<Shader> getOrEmplace (const String& filename);
 
+    /**
+     * @brief Retrieves a @a `Shader` asset which is mapped to the given relative filename string.
+     *        If no such asset is found, then a new @a `Shader` asset is mapped to the given
+     *        filename string right away, and its source file is read on the @a `AssetLoader`'s
+     *        worker threads. The program is built on the main thread by
+     *        @a `AssetLoader::update`.
+     * 
+     * @param filename  The relative filename of the asset to get or load.
+     * 
+     * @return  A shared pointer to the mapped (or newly-created) @a `Shader` asset, which may
+     *          still be loading.
+     */
+    static Ref<Shader> loadAsync (const String& filename);
+
     /**
      * @brief Checks to see if a loaded @a `Shader` asset has been mapped to the given relative
      *        filename string.
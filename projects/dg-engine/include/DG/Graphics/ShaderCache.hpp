@@ -0,0 +1,119 @@
+/** @file DG/Graphics/ShaderCache.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The file extension given to cached shader program binaries.
+   */
+  constexpr const char* SHADER_CACHE_EXTENSION = ".dgshader";
+
+  /**
+   * @brief The @a `ShaderCacheSpecification` struct describes attributes defining the
+   *        @a `ShaderCache`.
+   */
+  struct ShaderCacheSpecification
+  {
+
+    /**
+     * @brief Indicates whether or not linked shader program binaries should be cached on disk. If
+     *        not, every shader program is compiled and linked from source.
+     */
+    Bool enabled = true;
+
+    /**
+     * @brief The directory in which cached program binaries are kept. It is created if need be.
+     */
+    Path directory = fs::temp_directory_path() / "dg-shader-cache";
+
+  };
+
+  /**
+   * @brief The @a `ShaderCache` class is a static helper class which keeps linked shader program
+   *        binaries on disk, so that a shader program built once need not be compiled and linked
+   *        from source again on later launches.
+   *
+   *        Each binary is keyed by an FNV-1a hash of its vertex and fragment source code and of
+   *        the graphics driver's vendor, renderer and version strings, so a driver update makes
+   *        the old binaries miss rather than load. A binary which the driver still rejects is
+   *        deleted, and the program is built from source instead.
+   */
+  class ShaderCache
+  {
+  public:
+
+    /**
+     * @brief Sets up the shader cache with the given specification, creating its directory.
+     *
+     * @param spec  The shader cache's specification.
+     */
+    static void initialize (const ShaderCacheSpecification& spec = {});
+
+    /**
+     * @brief Disables the shader cache. Binaries already on disk are kept.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief   Retrieves whether or not the shader cache is enabled.
+     *
+     * @return  @a `true` if program binaries are cached; @a `false` otherwise.
+     */
+    static Bool isEnabled ();
+
+    /**
+     * @brief   Creates a shader program from the cached binary for the given source code, if there
+     *          is one which the graphics driver accepts.
+     *
+     * @param   vertexCode    The source code of the vertex shader.
+     * @param   fragmentCode  The source code of the fragment shader.
+     *
+     * @return  The handle of the new shader program; @a `0` if there is no usable binary, or if
+     *          the cache is disabled.
+     */
+    static Uint32 load (const String& vertexCode, const String& fragmentCode);
+
+    /**
+     * @brief   Writes the binary of the given shader program, built from the given source code, to
+     *          the cache. Nothing is written if the cache is disabled, or if the graphics driver
+     *          cannot give a binary.
+     *
+     * @param   program       The handle of the linked shader program.
+     * @param   vertexCode    The source code of the vertex shader.
+     * @param   fragmentCode  The source code of the fragment shader.
+     *
+     * @return  @a `true` if the binary is written; @a `false` otherwise.
+     */
+    static Bool store (Uint32 program, const String& vertexCode, const String& fragmentCode);
+
+    /**
+     * @brief   Works out the key under which the binary for the given source code is cached, on
+     *          the current graphics driver.
+     *
+     * @param   vertexCode    The source code of the vertex shader.
+     * @param   fragmentCode  The source code of the fragment shader.
+     *
+     * @return  The 64-bit FNV-1a hash of the source code and the driver's device name.
+     */
+    static Uint64 getKey (const String& vertexCode, const String& fragmentCode);
+
+    /**
+     * @brief   Retrieves the path of the cache file for the given key.
+     *
+     * @param   key The key of the cached binary.
+     *
+     * @return  The path of the cache file, in the cache directory.
+     */
+    static Path getCachePath (Uint64 key);
+
+  private:
+    static ShaderCacheSpecification s_spec;
+    static String                   s_deviceName;
+
+  };
+
+}
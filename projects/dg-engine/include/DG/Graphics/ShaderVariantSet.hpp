@@ -0,0 +1,187 @@
+/** @file DG/Graphics/ShaderVariantSet.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Shader.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `ShaderVariantSet` class builds variants of a single shader source, each with a
+   *        different set of features switched on, so that feature toggles need not be written as
+   *        copies of a whole shader file.
+   *
+   *        Features are named by @a `#feature NAME` directives in the shader file. A variant is
+   *        keyed by a bitmask in which bit @a `i` switches on the @a `i`th feature; its source code
+   *        has a @a `#define NAME 1` line injected after the @a `#version` line of each stage for
+   *        every feature switched on.
+   *
+   *        Variants are built lazily, the first time they are asked for. Those known to be needed
+   *        ahead of time can instead be started together by @a `prepare`, so that the graphics
+   *        driver can build them in parallel while frames keep being drawn.
+   */
+  class ShaderVariantSet
+  {
+  public:
+
+    /**
+     * @brief The largest number of features which a variant set can have.
+     */
+    static constexpr Count MAX_FEATURES = 64;
+
+  public:
+
+    /**
+     * @brief Creates a new @a `ShaderVariantSet` from the given shader source file.
+     *
+     * @param path  The path to the shader file to load.
+     *
+     * @return  A shared pointer to the newly-created @a `ShaderVariantSet`.
+     */
+    static Ref<ShaderVariantSet> make (const Path& path);
+
+    /**
+     * @brief Creates a new @a `ShaderVariantSet` from the given source code and feature names.
+     *
+     * @param vertexCode    The source code of the vertex shader.
+     * @param fragmentCode  The source code of the fragment (or pixel) shader.
+     * @param features      The names of the features, in bit order.
+     *
+     * @return  A shared pointer to the newly-created @a `ShaderVariantSet`.
+     */
+    static Ref<ShaderVariantSet> make (const String& vertexCode, const String& fragmentCode,
+      const Collection<String>& features);
+
+    /**
+     * @brief Loads the source code and feature names from the given shader file, discarding any
+     *        variants already built.
+     *
+     * @param path  The path to the shader file to load.
+     *
+     * @return  @a `true` if the file is loaded and its features are valid; @a `false` otherwise.
+     */
+    Boolean loadFromFile (const Path& path);
+
+    /**
+     * @brief Sets the source code and feature names, discarding any variants already built.
+     *
+     * @param vertexCode    The source code of the vertex shader.
+     * @param fragmentCode  The source code of the fragment (or pixel) shader.
+     * @param features      The names of the features, in bit order.
+     *
+     * @return  @a `true` if the source code is provided, and there are no more than
+     *          @a `MAX_FEATURES` distinct features; @a `false` otherwise.
+     */
+    Boolean loadFromSources (const String& vertexCode, const String& fragmentCode,
+      const Collection<String>& features);
+
+    /**
+     * @brief   Works out the variant mask which switches on the given features.
+     *
+     * @param   names   The names of the features to switch on.
+     *
+     * @return  The variant mask.
+     *
+     * @throw   @a `std::invalid_argument` if a name is not one of this set's features.
+     */
+    Uint64 getMask (const Collection<String>& names) const;
+
+    /**
+     * @brief   Retrieves the variant with the given mask, building it first if need be. If the
+     *          variant's build is still pending, this waits for it to finish.
+     *
+     * @param   mask  The variant mask.
+     *
+     * @return  A shared pointer to the variant's @a `Shader`.
+     *
+     * @throw   @a `std::invalid_argument` if the mask switches on a feature which does not exist.
+     * @throw   @a `std::runtime_error` if the variant could not be built.
+     */
+    const Ref<Shader>& get (Uint64 mask);
+
+    /**
+     * @brief Starts building each of the given variants which has not yet been built, without
+     *        waiting for the builds to finish.
+     *
+     * @param masks   The masks of the variants to build.
+     *
+     * @throw @a `std::invalid_argument` if a mask switches on a feature which does not exist.
+     */
+    void prepare (const Collection<Uint64>& masks);
+
+    /**
+     * @brief   Checks, without waiting, whether or not the variant with the given mask is built and
+     *          can be drawn with.
+     *
+     * @param   mask  The variant mask.
+     *
+     * @return  @a `true` if the variant is built and linked; @a `false` if it was never started,
+     *          is still pending, or failed to build.
+     */
+    Boolean isReady (Uint64 mask);
+
+    /**
+     * @brief   Checks on every pending variant without waiting, swapping in those whose builds have
+     *          finished. This is meant to be called once per frame while variants are pending.
+     *
+     * @return  The number of variants still pending.
+     */
+    Count update ();
+
+    /**
+     * @brief   Retrieves the names of this set's features, in bit order.
+     *
+     * @return  The feature names.
+     */
+    const Collection<String>& getFeatures () const;
+
+    /**
+     * @brief   Retrieves the number of variants which have been started, whether or not they have
+     *          finished building.
+     *
+     * @return  The number of variants.
+     */
+    Count getVariantCount () const;
+
+  private:
+
+    /**
+     * @brief Ensures that the given mask switches on only features which exist.
+     */
+    void checkMask (Uint64 mask, const char* function) const;
+
+    /**
+     * @brief Injects the @a `#define` lines for the given mask into the given stage's source code.
+     */
+    String injectDefines (const String& code, Uint64 mask) const;
+
+    /**
+     * @brief Retrieves the variant with the given mask, starting its build if need be.
+     */
+    Ref<Shader>& begin (Uint64 mask);
+
+  private:
+    /**
+     * @brief The source code of the vertex shader, before any defines are injected.
+     */
+    String m_vertexCode = "";
+
+    /**
+     * @brief The source code of the fragment shader, before any defines are injected.
+     */
+    String m_fragmentCode = "";
+
+    /**
+     * @brief The names of the features, in bit order.
+     */
+    Collection<String> m_features;
+
+    /**
+     * @brief The variants which have been started, keyed by mask.
+     */
+    Map<Uint64, Ref<Shader>> m_variants;
+
+  };
+
+}
@@ -0,0 +1,127 @@
+/** @file DG/Graphics/SubTexture.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Texture.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `SubTexture` class describes a rectangular region of a @a `Texture`, such as one
+   *        frame of a sprite sheet. Its texture coordinates are worked out once, when it is
+   *        created, so that quads drawn with it cost no more to submit than those drawn with the
+   *        whole texture - and since every region of a sheet shares the sheet's texture, they are
+   *        all drawn in the same batch.
+   *
+   *        Pixel regions are measured from the image's top-left corner, as in an image editor.
+   */
+  class SubTexture
+  {
+  public:
+
+    /**
+     * @brief Constructs a @a `SubTexture` covering the given texture coordinates.
+     *
+     * @param texture     The texture which this region belongs to.
+     * @param minimum     The texture coordinate of the region's lower-left corner.
+     * @param maximum     The texture coordinate of the region's upper-right corner.
+     */
+    SubTexture (const Ref<Texture>& texture, const Vector2f& minimum, const Vector2f& maximum);
+
+    /**
+     * @brief Creates a new @a `SubTexture` covering the given texture coordinates.
+     *
+     * @param texture     The texture which this region belongs to.
+     * @param minimum     The texture coordinate of the region's lower-left corner.
+     * @param maximum     The texture coordinate of the region's upper-right corner.
+     *
+     * @return  A shared pointer to the newly-created @a `SubTexture`.
+     *
+     * @throw   @a `std::invalid_argument` if the texture is null.
+     */
+    static Ref<SubTexture> make (const Ref<Texture>& texture, const Vector2f& minimum,
+      const Vector2f& maximum);
+
+    /**
+     * @brief Creates a new @a `SubTexture` covering the given rectangle of pixels.
+     *
+     * @param texture   The texture which this region belongs to. It must already have been given
+     *                  its image data, so that its size is known.
+     * @param position  The position of the rectangle's top-left corner, in pixels.
+     * @param size      The rectangle's width and height, in pixels.
+     *
+     * @return  A shared pointer to the newly-created @a `SubTexture`.
+     *
+     * @throw   @a `std::invalid_argument` if the texture is null or has no size yet.
+     */
+    static Ref<SubTexture> makeFromPixels (const Ref<Texture>& texture, const Vector2f& position,
+      const Vector2f& size);
+
+    /**
+     * @brief Creates a new @a `SubTexture` covering one cell of a sprite sheet laid out in a grid.
+     *
+     * @param texture   The texture which this region belongs to. It must already have been given
+     *                  its image data, so that its size is known.
+     * @param cell      The cell's column and row, counted from the top-left cell.
+     * @param cellSize  The size of each cell, in pixels.
+     * @param span      The number of columns and rows which the region covers.
+     *
+     * @return  A shared pointer to the newly-created @a `SubTexture`.
+     *
+     * @throw   @a `std::invalid_argument` if the texture is null or has no size yet.
+     */
+    static Ref<SubTexture> makeFromGrid (const Ref<Texture>& texture, const Vector2u& cell,
+      const Vector2u& cellSize, const Vector2u& span = { 1, 1 });
+
+    /**
+     * @brief Slices a sprite sheet laid out in a grid into one @a `SubTexture` per cell.
+     *
+     * @param texture   The texture to slice. It must already have been given its image data, so
+     *                  that its size is known.
+     * @param cellSize  The size of each cell, in pixels.
+     * @param spacing   The gap between neighbouring cells, in pixels.
+     * @param margin    The gap between the outer cells and the edges of the texture, in pixels.
+     *
+     * @return  The cells which fit entirely within the texture, in reading order: left to right,
+     *          then top to bottom.
+     *
+     * @throw   @a `std::invalid_argument` if the texture is null or has no size yet, or if the
+     *          cell size is zero.
+     */
+    static Collection<Ref<SubTexture>> slice (const Ref<Texture>& texture,
+      const Vector2u& cellSize, const Vector2u& spacing = { 0, 0 },
+      const Vector2u& margin = { 0, 0 });
+
+  public:
+
+    /**
+     * @brief Retrieves the @a `Texture` which this region belongs to.
+     *
+     * @return  A shared pointer to the texture.
+     */
+    const Ref<Texture>& getTexture () const;
+
+    /**
+     * @brief Retrieves the texture coordinates of this region's four corners, in the order in
+     *        which the @a `Renderer` submits a quad's vertices: lower-left, lower-right,
+     *        upper-right, then upper-left.
+     *
+     * @return  The four texture coordinates.
+     */
+    const Vector2f* getTextureCoordinates () const;
+
+  private:
+    /**
+     * @brief The @a `Texture` which this region belongs to.
+     */
+    Ref<Texture> m_texture = nullptr;
+
+    /**
+     * @brief The texture coordinates of this region's four corners.
+     */
+    Vector2f m_textureCoordinates[4];
+
+  };
+
+}
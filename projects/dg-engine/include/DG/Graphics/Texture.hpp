@@ -3,6 +3,8 @@
 #pragma once
 
 #include <DG_Pch.hpp>
+#include <DG/Graphics/TextureResidency.hpp>
+#include <DG/Graphics/TextureUploadQueue.hpp>
 
 namespace dg
 {
@@ -28,11 +30,19 @@ namespace dg
   /**
    * @brief The @a `TextureFilterMode` enum enumerates the modes by which a texture coordinate is
    *        resolved to a pixel in a @a `Texture`.
+   *
+   *        The @a `Mipmap` modes also pick between the levels of the texture's mip chain, and only
+   *        apply to minification; used for magnification, they act as @a `Nearest` or @a `Linear`.
+   *        @a `LinearMipmapLinear` is trilinear filtering.
    */
   enum class TextureFilterMode
   {
     Nearest,
-    Linear
+    Linear,
+    NearestMipmapNearest,
+    LinearMipmapNearest,
+    NearestMipmapLinear,
+    LinearMipmapLinear
   };
 
   /**
@@ -66,6 +76,13 @@ namespace dg
      */
     TextureFilterMode minify = TextureFilterMode::Nearest;
 
+    /**
+     * @brief Should the @a `Texture` have a full mip chain? If its image data holds only the base
+     *        level, the rest of the chain is generated on the graphics card. Block-compressed
+     *        image data must bring its own mip chain.
+     */
+    Bool mipmaps = false;
+
   };  
 
   /**
@@ -74,6 +91,10 @@ namespace dg
    */
   class Texture
   {
+    friend class TextureManager;
+    friend class TextureResidency;
+    friend class TextureUploadQueue;
+
   public:
     Texture ();
     ~Texture ();
@@ -94,6 +115,28 @@ namespace dg
      */
     static Ref<Texture> make (const Path& path);
 
+    /**
+     * @brief Creates a new @a `Texture` from the given image file, with the given wrap, filter
+     *        and mipmap settings. The specification's size and color channels are ignored.
+     * 
+     * @param path  The path the texture file to load.
+     * @param spec  The texture's specification.
+     *  
+     * @return  A shared pointer to the newly-created @a `Texture`. 
+     */
+    static Ref<Texture> make (const Path& path, const TextureSpecification& spec);
+
+    /**
+     * @brief Reads and decodes the given image file on the @a `AssetLoader`'s worker threads,
+     *        preferring an up-to-date cooked texture file, then loads it into the given
+     *        @a `Texture` on the main thread.
+     * 
+     * @param texture The texture to load into, which is kept alive until the load finishes.
+     * @param path    The path to the image file to load.
+     * @param key     The key under which the load is submitted to the @a `AssetLoader`.
+     */
+    static void loadAsync (const Ref<Texture>& texture, const Path& path, const String& key);
+
     /**
      * @brief Sets this @a `Texture` as the active texture at the given texture slot.
      * 
@@ -119,6 +162,12 @@ namespace dg
 
     /**
      * @brief Attempts to create a new @a `Texture` by loading image data from the given file.
+     *        Texture container files - DDS, KTX2 and cooked texture files (see
+     *        @a `TextureContainer`) - are mapped into memory and uploaded as they are, without
+     *        being decoded, and may hold block-compressed data.
+     *
+     *        If the @a `TextureUploadQueue` is enabled, the image data is uploaded over the next
+     *        few frames, and the texture is not valid until it is resident.
      * 
      * @param path  The path to the image file to load.
      *  
@@ -128,7 +177,45 @@ namespace dg
     Boolean loadFromFile (const Path& path);
 
     /**
-     * @brief Attempts to upload raw data to this @a `Texture`.
+     * @brief Attempts to create a new @a `Texture` from decoded pixel data, taking ownership of it.
+     *
+     *        If the @a `TextureUploadQueue` is enabled, the pixel data is uploaded over the next
+     *        few frames, and the texture is not valid until it is resident.
+     * 
+     * @param pixels        The tightly-packed pixel data, starting with the bottom row.
+     * @param size          The image's width and height, in pixels.
+     * @param colorChannels The number of color channels in each pixel.
+     * @param levels        The levels of the mip chain found in the pixel data. If empty, the
+     *                      pixel data holds only the base level.
+     *  
+     * @return  @a `true` if the @a `Texture` is created successfully; @a `false` otherwise. 
+     */
+    Boolean loadFromPixels (PixelData pixels, const Vector2u& size, const Uint32 colorChannels,
+      const Collection<TextureLevel>& levels = {});
+
+    /**
+     * @brief Attempts to create a new @a `Texture` from block-compressed data, such as BC1, BC3 or
+     *        BC7 blocks. The data is uploaded right away, and stays compressed on the graphics
+     *        card.
+     * 
+     * @param data              The compressed blocks, starting with the bottom row of blocks.
+     * @param size              The image's width and height, in pixels.
+     * @param compressedFormat  The compressed format, such as @a `GL_COMPRESSED_RGBA_BPTC_UNORM`.
+     * @param byteCount         The size of the compressed data, in bytes.
+     * @param levels            The levels of the mip chain found in the compressed data. If
+     *                          empty, the data holds only the base level.
+     *  
+     * @return  @a `true` if the @a `Texture` is created successfully; @a `false` otherwise, or if
+     *          the graphics card does not support the compressed format.
+     */
+    Boolean loadFromCompressed (PixelData data, const Vector2u& size,
+      const GLenum compressedFormat, const Size byteCount,
+      const Collection<TextureLevel>& levels = {});
+
+    /**
+     * @brief Attempts to upload raw data to the base level of this @a `Texture`, regenerating the
+     *        rest of its mip chain if it has one. Compressed textures cannot be uploaded to. An
+     *        evicted texture has its storage set aside again first, and is valid afterwards.
      * 
      * @param data  Points to the raw data to be uploaded.
      * @param size  The size of the data to be uploaded.
@@ -144,6 +231,14 @@ namespace dg
      */
     Vector2f getTextureCoordinate (const Vector2f& position) const;
 
+    /**
+     * @brief Retrieves the size of this @a `Texture`'s base level.
+     * 
+     * @return  The texture's width and height, in pixels, or zero if it has not yet been given
+     *          any image data.
+     */
+    const Vector2u& getSize () const;
+
     /**
      * @brief Retrieves whether or not this @a `Texture` is valid and ready to be used.
      * 
@@ -151,6 +246,58 @@ namespace dg
      */
     Boolean isValid () const;
 
+    /**
+     * @brief Retrieves whether or not this @a `Texture`'s image data is still waiting in the
+     *        @a `TextureUploadQueue`.
+     * 
+     * @return  @a `true` if this texture's upload is pending; @a `false` otherwise. 
+     */
+    Boolean isPending () const;
+
+    /**
+     * @brief Retrieves whether or not this @a `Texture` is stored in a block-compressed format.
+     * 
+     * @return  @a `true` if this texture is compressed; @a `false` otherwise. 
+     */
+    Boolean isCompressed () const;
+
+    /**
+     * @brief Retrieves the number of levels in this @a `Texture`'s mip chain.
+     * 
+     * @return  The number of mip levels, including the base level.
+     */
+    Count getLevelCount () const;
+
+    /**
+     * @brief Retrieves the approximate amount of video memory held by this @a `Texture`'s storage,
+     *        across its whole mip chain.
+     * 
+     * @return  The size of the texture's storage, in bytes, or @a `0` if it has none.
+     */
+    Size getByteCount () const;
+
+    /**
+     * @brief Retrieves the path to the file which this @a `Texture` was loaded from.
+     * 
+     * @return  The path to the image file, or to its cooked texture file; or an empty path if this
+     *          texture was not loaded from a file.
+     */
+    const Path& getFilepath () const;
+
+  private:
+    /**
+     * @brief Allocates immutable storage for this @a `Texture`, at its current size and internal
+     *        format, with the given number of mip levels. The texture object is re-created if it
+     *        already has storage.
+     */
+    void allocateStorage (Count levelCount);
+
+    /**
+     * @brief Drops this @a `Texture`'s storage on the graphics card, keeping its specification, so
+     *        that it can be loaded again later.
+     */
+    void evict ();
+
   private:
     /**
      * @brief The integer ID pointing to the @a `Texture` on the graphics card.
@@ -167,6 +314,43 @@ namespace dg
      */
     Boolean m_valid = false;
 
+    /**
+     * @brief Indicates whether or not this @a `Texture` is waiting to be uploaded.
+     */
+    Boolean m_pending = false;
+
+    /**
+     * @brief Indicates whether or not this @a `Texture` is stored in a block-compressed format.
+     */
+    Boolean m_compressed = false;
+
+    /**
+     * @brief Indicates whether or not storage has been allocated for this @a `Texture`.
+     */
+    Boolean m_allocated = false;
+
+    /**
+     * @brief The number of levels in this @a `Texture`'s mip chain.
+     */
+    Count m_levelCount = 1;
+
+    /**
+     * @brief The approximate amount of video memory held by this @a `Texture`'s storage.
+     */
+    Size m_byteCount = 0;
+
+    /**
+     * @brief Indicates whether or not this @a `Texture`'s storage has been evicted by the
+     *        @a `TextureResidency` layer, and not yet loaded again.
+     */
+    Boolean m_evicted = false;
+
+    /**
+     * @brief The frame in which this @a `Texture` was last drawn, as counted by the
+     *        @a `TextureResidency` layer.
+     */
+    Index m_lastUsedFrame = 0;
+
     /**
      * @brief If this @a `Texture` was loaded from an image file, this contains the absolute path
      *        to that image file.
@@ -191,6 +375,9 @@ namespace dg
      * @brief Retrieves a loaded @a `Texture` asset which is mapped to the given relative filename
      *        string. If no such asset is found, then a new @a `Texture` asset is created, loaded
      *        from that file, then mapped to the given filename string.
+     *
+     *        If the file has a cooked texture file which is at least as new as it, the cooked
+     *        texture file is loaded instead.
      * 
      * @param filename  The relative filename of the asset to get or emplace.
      * 
@@ -198,6 +385,36 @@ namespace dg
      */
     static Ref<Texture> getOrEmplace (const String& filename);
 
+    /**
+     * @brief Retrieves a @a `Texture` asset which is mapped to the given relative filename string.
+     *        If no such asset is found, then a new @a `Texture` asset is mapped to the given
+     *        filename string right away, and its image file is read and decoded on the
+     *        @a `AssetLoader`'s worker threads, preferring an up-to-date cooked texture file as
+     *        @a `getOrEmplace` does. The asset is finalized on the main thread by
+     *        @a `AssetLoader::update`.
+     * 
+     * @param filename  The relative filename of the asset to get or load.
+     * 
+     * @return  A shared pointer to the mapped (or newly-created) @a `Texture` asset, which may
+     *          still be loading.
+     */
+    static Ref<Texture> loadAsync (const String& filename);
+
+    /**
+     * @brief Sets the wrap, filter and mipmap settings given to @a `Texture` assets loaded from
+     *        now on by @a `getOrEmplace` and @a `loadAsync`.
+     * 
+     * @param spec  The specification to load with. Its size and color channels are ignored.
+     */
+    static void setLoadSpecification (const TextureSpecification& spec);
+
+    /**
+     * @brief Retrieves the wrap, filter and mipmap settings given to loaded @a `Texture` assets.
+     * 
+     * @return  The specification loaded with.
+     */
+    static const TextureSpecification& getLoadSpecification ();
+
     /**
      * @brief Checks to see if a loaded @a `Texture` asset has been mapped to the given relative
      *        filename string.
@@ -240,6 +457,11 @@ namespace dg
      */
     static Dictionary<Ref<Texture>> s_assets;
 
+    /**
+     * @brief The specification given to newly-loaded @a `Texture` assets.
+     */
+    static TextureSpecification s_loadSpec;
+
   };
 
 }
@@ -0,0 +1,143 @@
+/** @file DG/Graphics/TextureContainer.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+#include <DG/Core/MappedFile.hpp>
+#include <DG/Graphics/TextureUploadQueue.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `MappedImage` struct describes an image whose pixel data is read straight from a
+   *        texture container file which has been mapped into memory, without being decoded.
+   */
+  struct MappedImage
+  {
+    /**
+     * @brief The mapped file, which must stay alive for as long as its pixel data is in use.
+     */
+    Ref<MappedFile> file = nullptr;
+
+    /**
+     * @brief The image's width and height, in pixels.
+     */
+    Vector2u size = { 0, 0 };
+
+    /**
+     * @brief The number of color channels in each pixel.
+     */
+    Uint32 colorChannels = 0;
+
+    /**
+     * @brief The block-compressed format of the pixel data, or @a `0` if the pixel data is not
+     *        compressed.
+     */
+    GLenum compressedFormat = 0;
+
+    /**
+     * @brief The levels of the image's mip chain, starting with the base level. Each level's
+     *        offset is counted from the start of the mapped file, or of @a `pixels`.
+     */
+    Collection<TextureLevel> levels;
+
+    /**
+     * @brief If the file stores its rows top row first, a copy of the whole file with each level
+     *        flipped upside down, or its levels decoded and flipped; otherwise, empty, and the
+     *        pixel data is read from the file.
+     */
+    Collection<Uint8> pixels;
+  };
+
+  /**
+   * @brief The @a `TextureContainer` class is a static helper class which reads texture container
+   *        files - DDS, KTX2 and cooked texture files - whose pixel data can be handed to the
+   *        graphics card as it is.
+   *
+   *        OpenGL expects the bottom row first. DDS files, and KTX2 files unless their
+   *        @a `KTXorientation` says otherwise, store the top row first, so their levels are copied
+   *        out and flipped as they are loaded. Block-compressed levels are flipped a row of blocks
+   *        at a time, along with the rows of pixels within each block. BC1 and BC3 images with a
+   *        level more than four pixels high, whose height is not a multiple of four, cannot be
+   *        flipped that way, so they are decoded into four-channel pixels instead.
+   */
+  class TextureContainer
+  {
+  public:
+
+    /**
+     * @brief   Retrieves whether or not the given path names a texture container file which this
+     *          class can read.
+     *
+     * @param   path  The path to check.
+     *
+     * @return  @a `true` if the path has a @a `.dds`, @a `.ktx2` or @a `.dgtex` extension;
+     *          @a `false` otherwise.
+     */
+    static Bool isContainerPath (const Path& path);
+
+    /**
+     * @brief   Maps the given texture container file into memory and reads its first image,
+     *          along with any mip levels stored for it.
+     *
+     * @param   path  The path to the texture container file.
+     * @param   image Receives the mapped file and a description of its first image.
+     *
+     * @return  @a `true` if the file is mapped and holds a supported image; @a `false` otherwise.
+     */
+    static Bool load (const Path& path, MappedImage& image);
+
+    /**
+     * @brief   Retrieves the size of a single block of the given block-compressed format.
+     *
+     * @param   compressedFormat  The block-compressed format.
+     *
+     * @return  The size of a four-by-four block of pixels, in bytes, or @a `0` if the format is
+     *          not a known block-compressed format.
+     */
+    static Size getBlockByteCount (GLenum compressedFormat);
+
+    /**
+     * @brief   Retrieves the size of an image stored in the given block-compressed format.
+     *
+     * @param   compressedFormat  The block-compressed format.
+     * @param   size              The image's width and height, in pixels.
+     *
+     * @return  The size of the compressed image, in bytes.
+     */
+    static Size getCompressedByteCount (GLenum compressedFormat, const Vector2u& size);
+
+    /**
+     * @brief   Retrieves the number of levels in a full mip chain for an image of the given size,
+     *          down to and including a level of one by one pixels.
+     *
+     * @param   size  The size of the base level, in pixels.
+     *
+     * @return  The number of levels in the full mip chain.
+     */
+    static Count getFullLevelCount (const Vector2u& size);
+
+    /**
+     * @brief   Lays out the levels of a mip chain stored one after another, largest first, with no
+     *          padding in between.
+     *
+     * @param   compressedFormat  The block-compressed format, or @a `0` if not compressed.
+     * @param   colorChannels     The number of color channels in each pixel, if not compressed.
+     * @param   size              The size of the base level, in pixels.
+     * @param   levelCount        The number of levels stored.
+     * @param   offset            The offset of the base level, in bytes.
+     *
+     * @return  The levels of the mip chain.
+     */
+    static Collection<TextureLevel> getPackedLevels (GLenum compressedFormat,
+      Uint32 colorChannels, const Vector2u& size, Count levelCount, Size offset = 0);
+
+  private:
+    static Bool loadDds (const Path& path, MappedImage& image);
+    static Bool loadKtx2 (const Path& path, MappedImage& image);
+    static Bool loadCooked (const Path& path, MappedImage& image);
+
+  };
+
+}
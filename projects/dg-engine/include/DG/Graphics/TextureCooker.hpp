@@ -0,0 +1,198 @@
+/** @file DG/Graphics/TextureCooker.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+#include <DG/Core/MappedFile.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The file extension given to cooked texture files.
+   */
+  constexpr const char* COOKED_TEXTURE_EXTENSION = ".dgtex";
+
+  /**
+   * @brief The four bytes - "DGTX" - found at the start of every cooked texture file.
+   */
+  constexpr Uint32 COOKED_TEXTURE_MAGIC = 0x58544744;
+
+  /**
+   * @brief The version of the cooked texture format written by the @a `TextureCooker`.
+   */
+  constexpr Uint16 COOKED_TEXTURE_VERSION = 1;
+
+  /**
+   * @brief The @a `CookedTextureFormat` enum enumerates the ways in which a cooked texture's pixel
+   *        data may be stored.
+   */
+  enum class CookedTextureFormat : Uint16
+  {
+    Raw = 0,
+    BC1 = 1,
+    BC3 = 2,
+    BC7 = 3
+  };
+
+  /**
+   * @brief The @a `CookedTextureHeader` struct is found at the start of every cooked texture file,
+   *        and is followed right away by the texture's pixel data.
+   *
+   *        Raw pixel data is tightly packed, starting with the bottom row, so that it can be handed
+   *        to the graphics card as it is. Block-compressed pixel data is stored as rows of
+   *        four-by-four blocks, likewise starting with the bottom row. The levels of the mip chain
+   *        follow one another, largest first.
+   */
+  struct CookedTextureHeader
+  {
+    Uint32 magic = COOKED_TEXTURE_MAGIC;
+    Uint16 version = COOKED_TEXTURE_VERSION;
+    CookedTextureFormat format = CookedTextureFormat::Raw;
+    Uint32 width = 0;
+    Uint32 height = 0;
+    Uint32 colorChannels = 0;
+    Uint32 mipCount = 1;
+    Uint64 payloadSize = 0;
+  };
+
+  static_assert(sizeof(CookedTextureHeader) == 32, "Cooked texture header must be 32 bytes!");
+
+  /**
+   * @brief The @a `TextureCookSpecification` struct describes how the @a `TextureCooker` should
+   *        store an image's pixel data.
+   */
+  struct TextureCookSpecification
+  {
+
+    /**
+     * @brief Should the pixel data be block-compressed? RGB images are compressed to BC1 and RGBA
+     *        images to BC3, taking a sixth and a quarter as much video memory respectively.
+     *        Images with one or two color channels are always stored raw.
+     */
+    Bool compress = false;
+
+    /**
+     * @brief Should a full mip chain be stored? Each level is built by averaging two-by-two
+     *        squares of the level before it.
+     */
+    Bool mipmaps = true;
+
+  };
+
+  /**
+   * @brief The @a `CookedTexture` struct describes a cooked texture file which has been mapped
+   *        into memory.
+   */
+  struct CookedTexture
+  {
+    Ref<MappedFile>     file = nullptr;
+    CookedTextureHeader header;
+    const Uint8*        payload = nullptr;
+  };
+
+  /**
+   * @brief The @a `TextureCooker` class is a static helper class which converts image files into
+   *        cooked texture files, whose pixel data is already decoded and flipped, so that they can
+   *        be mapped into memory and uploaded without going through an image decoder.
+   *
+   *        The cooked texture file for @a `wall.jpg` is @a `wall.jpg.dgtex`, in the same directory.
+   */
+  class TextureCooker
+  {
+  public:
+
+    /**
+     * @brief   Decodes the given image file and writes it out as a cooked texture file.
+     *
+     * @param   source  The path to the image file to cook.
+     * @param   output  The path to the cooked texture file to write.
+     * @param   spec    How the pixel data should be stored.
+     *
+     * @return  @a `true` if the image file is cooked successfully; @a `false` otherwise.
+     */
+    static Bool cook (const Path& source, const Path& output,
+      const TextureCookSpecification& spec = {});
+
+    /**
+     * @brief   Cooks every image file in the given directory, and its sub-directories, whose
+     *          cooked texture file is missing or out of date.
+     *
+     * @param   directory The path to the directory to search.
+     * @param   spec      How the pixel data should be stored.
+     *
+     * @return  The number of image files cooked.
+     */
+    static Count cookDirectory (const Path& directory, const TextureCookSpecification& spec = {});
+
+    /**
+     * @brief   Maps the given cooked texture file into memory and checks its header.
+     *
+     * @param   path    The path to the cooked texture file.
+     * @param   texture Receives the mapped file, its header and a pointer to its pixel data.
+     *
+     * @return  @a `true` if the file is mapped and valid; @a `false` otherwise.
+     */
+    static Bool load (const Path& path, CookedTexture& texture);
+
+    /**
+     * @brief   Retrieves the OpenGL internal format matching the given cooked texture format.
+     *
+     * @param   format  The cooked texture format.
+     *
+     * @return  The block-compressed internal format, or @a `0` if the format is @a `Raw`.
+     */
+    static GLenum getCompressedFormat (CookedTextureFormat format);
+
+    /**
+     * @brief   Retrieves the path to the cooked texture file for the given image file.
+     *
+     * @param   source  The path to the image file.
+     *
+     * @return  The image file's path, with the cooked texture extension added.
+     */
+    static Path getCookedPath (const Path& source);
+
+    /**
+     * @brief   Retrieves the path to the image file which the given cooked texture file was cooked
+     *          from - the inverse of @a `getCookedPath`.
+     *
+     * @param   path  The path to the cooked texture file, or to an image file.
+     *
+     * @return  The path, less the cooked texture extension if it has one.
+     */
+    static Path getSourcePath (const Path& path);
+
+    /**
+     * @brief   Retrieves whether or not the given path names a cooked texture file.
+     *
+     * @param   path  The path to check.
+     *
+     * @return  @a `true` if the path has the cooked texture extension; @a `false` otherwise.
+     */
+    static Bool isCookedPath (const Path& path);
+
+    /**
+     * @brief   Retrieves whether or not the given image file has a cooked texture file which is at
+     *          least as new as the image file itself.
+     *
+     * @param   source  The path to the image file.
+     *
+     * @return  @a `true` if the cooked texture file can be loaded in place of the image file;
+     *          @a `false` otherwise.
+     */
+    static Bool isUpToDate (const Path& source);
+
+    /**
+     * @brief   Resolves the path from which the given image file should be loaded: its cooked
+     *          texture file if that is up to date, or else the image file itself.
+     *
+     * @param   source  The path to the image file.
+     *
+     * @return  The path to load.
+     */
+    static Path resolve (const Path& source);
+
+  };
+
+}
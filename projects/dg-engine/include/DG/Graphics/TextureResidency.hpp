@@ -0,0 +1,165 @@
+/** @file DG/Graphics/TextureResidency.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  class Texture;
+
+  /**
+   * @brief The @a `TextureResidencySpecification` struct describes attributes defining the
+   *        @a `TextureResidency` layer.
+   */
+  struct TextureResidencySpecification
+  {
+
+    /**
+     * @brief The number of bytes of video memory which tracked textures may hold at once. If zero,
+     *        there is no budget, and no texture is ever evicted.
+     */
+    Size budget = 0;
+
+  };
+
+  /**
+   * @brief The @a `TextureResidencyStats` struct reports how the video memory held by tracked
+   *        textures compares against the @a `TextureResidency` layer's budget.
+   */
+  struct TextureResidencyStats
+  {
+    /**
+     * @brief The number of textures being tracked.
+     */
+    Count trackedCount = 0;
+
+    /**
+     * @brief The number of tracked textures which have storage on the graphics card.
+     */
+    Count residentCount = 0;
+
+    /**
+     * @brief The number of tracked textures whose storage has been evicted, and which have not
+     *        been used since.
+     */
+    Count evictedCount = 0;
+
+    /**
+     * @brief The approximate video memory held by tracked textures, in bytes.
+     */
+    Size residentByteCount = 0;
+
+    /**
+     * @brief The budget in effect, in bytes, or @a `0` if there is none.
+     */
+    Size budget = 0;
+
+    /**
+     * @brief The number of textures evicted since the layer was initialized.
+     */
+    Count evictionCount = 0;
+
+    /**
+     * @brief The number of evicted textures reloaded since the layer was initialized.
+     */
+    Count reloadCount = 0;
+
+    /**
+     * @brief The number of frames counted since the layer was initialized.
+     */
+    Index frame = 0;
+  };
+
+  /**
+   * @brief The @a `TextureResidency` class is a static helper class which keeps the video memory
+   *        held by @a `Texture` assets within a budget.
+   *
+   *        Each tracked texture is stamped with the frame in which it was last drawn. While the
+   *        tracked textures hold more than the budget, the least recently drawn textures have
+   *        their storage on the graphics card dropped; their specification is kept, and they are
+   *        loaded again in the background the next time they are drawn. Until then, they are not
+   *        valid, and are drawn as blank textures.
+   *
+   *        Textures drawn in the frame just finished are never evicted, so the budget may be
+   *        overrun for as long as they are in view.
+   */
+  class TextureResidency
+  {
+  public:
+
+    /**
+     * @brief Sets up the residency layer with the given specification.
+     *
+     * @param spec  The residency layer's specification.
+     */
+    static void initialize (const TextureResidencySpecification& spec = {});
+
+    /**
+     * @brief Stops tracking every texture and clears the residency numbers.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief Starts tracking the given @a `Texture`, which must have been loaded from a file so
+     *        that it can be loaded again after it is evicted.
+     *
+     * @param texture The texture to track.
+     * @param key     The key under which the texture is loaded by the @a `AssetLoader`.
+     */
+    static void track (Texture& texture, const String& key);
+
+    /**
+     * @brief Stops tracking the given @a `Texture`. Called when the texture is destroyed.
+     *
+     * @param texture The texture to stop tracking.
+     */
+    static void untrack (const Texture& texture);
+
+    /**
+     * @brief Stamps the given @a `Texture` as drawn in this frame. If its storage was evicted, it
+     *        is loaded again in the background.
+     *
+     * @param texture The texture being drawn.
+     */
+    static void touch (const Ref<Texture>& texture);
+
+    /**
+     * @brief Evicts the least recently drawn textures until the tracked textures are within the
+     *        budget, then moves on to the next frame. Called once at the start of every frame.
+     */
+    static void update ();
+
+    /**
+     * @brief Changes the number of bytes of video memory which tracked textures may hold at once.
+     *        Textures are evicted, if need be, by the next call to @a `update`.
+     *
+     * @param budget  The new budget, in bytes, or @a `0` for no budget.
+     */
+    static void setBudget (Size budget);
+
+    /**
+     * @brief Retrieves the residency numbers, as of the last call to @a `update`.
+     *
+     * @return  The residency numbers.
+     */
+    static const TextureResidencyStats& getStats ();
+
+  private:
+    struct Entry
+    {
+      Texture*  texture = nullptr;
+      String    key = "";
+    };
+
+    static void count ();
+
+  private:
+    static TextureResidencySpecification  s_spec;
+    static TextureResidencyStats          s_stats;
+    static Collection<Entry>              s_entries;
+
+  };
+
+}
@@ -0,0 +1,172 @@
+/** @file DG/Graphics/TextureUploadQueue.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  class Texture;
+
+  /**
+   * @brief Decoded pixel data, along with the function which frees it. The function may hold on
+   *        to whatever owns the data, such as a @a `MappedFile`.
+   */
+  using PixelData = std::unique_ptr<Uint8[], LFunction<void, Uint8*>>;
+
+  /**
+   * @brief The @a `TextureLevel` struct locates one level of a texture's mip chain within a block
+   *        of pixel data.
+   */
+  struct TextureLevel
+  {
+    Vector2u  size = { 0, 0 };
+    Size      offset = 0;
+    Size      byteCount = 0;
+  };
+
+  /**
+   * @brief The @a `TextureUploadSpecification` struct describes attributes defining the
+   *        @a `TextureUploadQueue`.
+   */
+  struct TextureUploadSpecification
+  {
+
+    /**
+     * @brief Indicates whether or not textures loaded from files should be uploaded over several
+     *        frames. If not, textures are uploaded as soon as they are loaded.
+     */
+    Bool enabled = true;
+
+    /**
+     * @brief The number of bytes of pixel data which may be uploaded each frame.
+     */
+    Size frameBudget = 4 * 1024 * 1024;
+
+    /**
+     * @brief The number of pixel unpack buffers through which pixel data is staged. A buffer is
+     *        only written to again once the graphics card has finished reading from it, so this
+     *        also bounds how much pixel data can be in flight at once.
+     */
+    Count bufferCount = 3;
+
+    /**
+     * @brief The size of each pixel unpack buffer, in bytes. This is the most pixel data which
+     *        can be staged at once.
+     */
+    Size bufferSize = 1024 * 1024;
+
+  };
+
+  /**
+   * @brief The @a `TextureUploadQueue` class is a static helper class which uploads the pixel data
+   *        of loaded @a `Texture`s to the graphics card a few rows at a time, staging it through a
+   *        ring of pixel unpack buffers, so that no single frame is held up by a large upload.
+   *
+   *        A queued @a `Texture` is not valid until all of its pixel data has been uploaded.
+   */
+  class TextureUploadQueue
+  {
+  public:
+
+    /**
+     * @brief Initializes the texture upload queue, creating its pixel unpack buffers.
+     *
+     * @param spec  The texture upload queue's specification.
+     */
+    static void initialize (const TextureUploadSpecification& spec = {});
+
+    /**
+     * @brief Discards any pending uploads and destroys the pixel unpack buffers.
+     */
+    static void shutdown ();
+
+    /**
+     * @brief   Retrieves whether or not textures should be queued up for upload.
+     *
+     * @return  @a `true` if the queue is initialized and enabled; @a `false` otherwise.
+     */
+    static Bool isEnabled ();
+
+    /**
+     * @brief Queues up the given pixel data to be uploaded into a texture's existing storage.
+     *
+     * @param texture         The texture being uploaded, which is made valid once it is resident.
+     * @param handle          The handle of the texture on the graphics card.
+     * @param pixels          The texture's tightly-packed pixel data.
+     * @param levels          The levels of the texture's mip chain found in the pixel data,
+     *                        starting with the base level.
+     * @param pixelFormat     The format of the pixel data.
+     * @param channels        The number of color channels in the pixel data.
+     * @param generateMipmaps Should the rest of the mip chain be generated from the base level
+     *                        once it is uploaded?
+     */
+    static void enqueue (Texture& texture, Uint32 handle, PixelData pixels,
+      const Collection<TextureLevel>& levels, GLenum pixelFormat, Uint32 channels,
+      Bool generateMipmaps = false);
+
+    /**
+     * @brief Discards the pending upload of the given texture, if there is one.
+     *
+     * @param texture The texture whose upload should be discarded.
+     */
+    static void cancel (const Texture& texture);
+
+    /**
+     * @brief Uploads pending pixel data, until either the frame's byte budget is spent or nothing
+     *        is left to upload. Call this once per frame.
+     */
+    static void process ();
+
+    /**
+     * @brief Uploads all pending pixel data, ignoring the frame's byte budget.
+     */
+    static void flush ();
+
+    /**
+     * @brief   Retrieves the number of textures waiting to be made resident.
+     *
+     * @return  The number of pending uploads.
+     */
+    static Count getPendingCount ();
+
+    /**
+     * @brief   Retrieves the number of bytes of pixel data still waiting to be uploaded.
+     *
+     * @return  The number of pending bytes.
+     */
+    static Size getPendingByteCount ();
+
+  private:
+
+    /**
+     * @brief Uploads pending pixel data until the given number of bytes is spent. If the next
+     *        buffer is still being read from, this either waits for it or stops early.
+     */
+    static void upload (Size budget, Bool wait);
+
+  private:
+
+    struct Upload
+    {
+      Texture*                  texture = nullptr;
+      Uint32                    handle = 0;
+      PixelData                 pixels { nullptr, std::free };
+      Collection<TextureLevel>  levels;
+      GLenum                    pixelFormat = 0;
+      Uint32                    channels = 0;
+      Bool                      generateMipmaps = false;
+      Index                     levelIndex = 0;
+      Uint32                    rowsUploaded = 0;
+    };
+
+    static TextureUploadSpecification s_spec;
+    static Collection<Upload>         s_uploads;
+    static Collection<Uint32>         s_buffers;
+    static Collection<Uint32>         s_fences;
+    static Index                      s_bufferIndex;
+
+  };
+
+}
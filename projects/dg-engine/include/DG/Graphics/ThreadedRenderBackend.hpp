@@ -0,0 +1,279 @@
+/** @file DG/Graphics/ThreadedRenderBackend.hpp */
+
+#pragma once
+
+#include <DG/Graphics/RenderBackend.hpp>
+#include <DG/Graphics/RenderCommandQueue.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RenderThreadSpecification` struct describes attributes defining the dedicated
+   *        render thread, if one is used.
+   */
+  struct RenderThreadSpecification
+  {
+
+    /**
+     * @brief Indicates whether or not the renderer's commands should be carried out on a
+     *        dedicated render thread.
+     */
+    Bool enabled = false;
+
+    /**
+     * @brief The number of frame command buffers. With two, the next frame is recorded while the
+     *        previous one is carried out; with three, the main thread may run two frames ahead.
+     */
+    Count frameCount = 2;
+
+    /**
+     * @brief Called on the render thread when it starts, to make the graphics context current.
+     */
+    LFunction<void> attachContext = nullptr;
+
+    /**
+     * @brief Called on the render thread just before it stops, to release the graphics context.
+     */
+    LFunction<void> detachContext = nullptr;
+
+    /**
+     * @brief Called on the render thread at the end of each frame, to present the frame.
+     */
+    LFunction<void> present = nullptr;
+
+  };
+
+  /**
+   * @brief The @a `ThreadedRenderBackend` class is a @a `RenderBackend` which records the
+   *        commands issued to it into per-frame command queues, and carries them out with another
+   *        backend on a dedicated render thread.
+   *
+   *        Handles returned by this backend are stand-ins, which are resolved into real handles on
+   *        the render thread. Data passed by pointer is copied when the command is recorded. Calls
+   *        which return information from the graphics card, such as @a `readPixels`, wait for the
+   *        render thread to catch up.
+   *
+   *        Commands may only be issued from one thread at a time.
+   */
+  class ThreadedRenderBackend : public RenderBackend
+  {
+  public:
+    ThreadedRenderBackend (Scope<RenderBackend> backend, const RenderThreadSpecification& spec);
+    ~ThreadedRenderBackend ();
+
+    RenderBackendType getType () const override;
+    void initialize () override;
+
+  public: // State and Draw Calls
+    void setViewport (const Vector2i& position, const Vector2u& size) override;
+    void setClearColor (const Color& color) override;
+    void clear () override;
+    void setPixelStore (GLenum name, Int32 value) override;
+    void drawIndexed (GLenum primitive, Count indexCount, GLenum indexType) override;
+
+  public: // Buffers
+    Uint32 createBuffer () override;
+    void destroyBuffer (Uint32 handle) override;
+    void bindBuffer (GLenum target, Uint32 handle) override;
+    void allocateBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      GLenum usage) override;
+    void uploadBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+      Size offset = 0) override;
+
+  public: // Vertex Arrays
+    Uint32 createVertexArray () override;
+    void destroyVertexArray (Uint32 handle) override;
+    void bindVertexArray (Uint32 handle) override;
+    void setVertexAttribute (Index index, Count elementCount, GLenum type, Bool normalized,
+      Size stride, Size offset) override;
+
+  public: // Textures
+    Uint32 createTexture () override;
+    void destroyTexture (Uint32 handle) override;
+    void bindTexture (GLenum target, Uint32 handle, Index slot = 0) override;
+    void setTextureParameter (GLenum target, Uint32 handle, GLenum name, Int32 value) override;
+    void allocateTexture2D (Uint32 handle, GLenum internalFormat, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data) override;
+    void allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    void allocateTextureStorage2D (Uint32 handle, Count levelCount, GLenum internalFormat,
+      const Vector2u& size) override;
+    Bool isTextureFormatSupported (GLenum internalFormat) override;
+    void uploadTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, const void* data, Index level = 0) override;
+    void uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum pixelFormat, GLenum dataType, Uint32 buffer, Size bufferOffset,
+      Index level = 0) override;
+    void uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset, const Vector2u& size,
+      GLenum compressedFormat, const void* data, Size byteCount, Index level = 0) override;
+    void generateTextureMipmaps (Uint32 handle) override;
+    void clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+      const void* data) override;
+
+  public: // Frame Buffers
+    Uint32 createFramebuffer () override;
+    void destroyFramebuffer (Uint32 handle) override;
+    void bindFramebuffer (GLenum target, Uint32 handle) override;
+    void attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+      Uint32 texture) override;
+    void setDrawBuffers (const GLenum* buffers, Count count) override;
+    void setReadBuffer (GLenum buffer) override;
+    void clearFramebufferColor (Uint32 framebuffer, Index index, const Vector4f& color) override;
+    void clearFramebufferInteger (Uint32 framebuffer, Index index,
+      const Vector4i& value) override;
+    void clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+      Int32 stencil) override;
+    void invalidateFramebuffer (Uint32 framebuffer, const GLenum* attachments,
+      Count count) override;
+    void blitFramebuffer (Uint32 source, Index sourceIndex, const Vector2i& sourcePosition,
+      const Vector2u& sourceSize, Uint32 destination, Index destinationIndex,
+      const Vector2i& destinationPosition, const Vector2u& destinationSize,
+      Bool linear) override;
+    Bool isFramebufferComplete () override;
+    void readPixels (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType, void* data) override;
+    Uint32 beginReadback (const Vector2i& position, const Vector2u& size, GLenum pixelFormat,
+      GLenum dataType) override;
+    ReadbackStatus pollReadback (Uint32 handle, void* data, Bool wait = false) override;
+    void destroyReadback (Uint32 handle) override;
+
+  public: // Timer Queries
+    Uint32 beginTimerQuery () override;
+    void endTimerQuery () override;
+    QueryStatus pollTimerQuery (Uint32 handle, Uint64& nanoseconds) override;
+    void destroyTimerQuery (Uint32 handle) override;
+
+  public: // Fences
+    Uint32 insertFence () override;
+    Bool pollFence (Uint32 handle, Bool wait = false) override;
+    void destroyFence (Uint32 handle) override;
+
+  public: // Shader Programs
+    Uint32 createProgram (const String& vertexCode, const String& fragmentCode) override;
+    Uint32 beginProgram (const String& vertexCode, const String& fragmentCode) override;
+    ProgramStatus pollProgram (Uint32 handle, Bool wait = false) override;
+    Uint32 createProgramFromBinary (GLenum format, const void* data, Size byteCount) override;
+    Bool getProgramBinary (Uint32 handle, GLenum& format, Collection<Uint8>& binary) override;
+    String getDeviceName () override;
+    void destroyProgram (Uint32 handle) override;
+    void useProgram (Uint32 handle) override;
+    void setUniform (Uint32 program, const String& name, ShaderUniformType type,
+      const void* value) override;
+
+  public: // Submission
+    void submit (const LFunction<void>& function) override;
+    void flush () override;
+    void endFrame () override;
+    Uint32 resolveHandle (Uint32 handle) const override;
+
+  private:
+
+    /**
+     * @brief Records a function into the command queue currently being recorded.
+     */
+    template <typename F>
+    inline void record (F&& function)
+    {
+      m_queues[m_writeIndex].submit(std::forward<F>(function));
+    }
+
+    /**
+     * @brief Copies data into the command queue currently being recorded.
+     */
+    inline const void* copy (const void* data, const Size size)
+    {
+      return m_queues[m_writeIndex].copy(data, size);
+    }
+
+    /**
+     * @brief Hands out a stand-in handle, re-using a released one if there is one. Called on the
+     *        recording thread.
+     */
+    Uint32 allocateHandle ();
+
+    /**
+     * @brief Hands a stand-in handle back for re-use, once the command which destroys its object
+     *        has been recorded, or its query or fence has finished. Called on the recording thread.
+     */
+    void releaseHandle (Uint32 handle);
+
+    /**
+     * @brief Maps a stand-in handle to the real handle it stands for. Called on the render thread.
+     */
+    void bindHandle (Uint32 handle, Uint32 realHandle);
+
+    /**
+     * @brief Hands the current command queue off to the render thread, waiting if every other
+     *        queue is still waiting to be carried out. Returns early if the render thread has
+     *        stopped because of an error.
+     */
+    void publish ();
+
+    /**
+     * @brief Throws if the render thread has stopped because of an error.
+     */
+    void checkForErrors () const;
+
+    /**
+     * @brief The render thread's main loop.
+     */
+    void run ();
+
+  private:
+
+    /**
+     * @brief The state of a readback, shared between the recording thread, which polls it, and
+     *        the render thread, which fills it in.
+     */
+    struct ReadbackState
+    {
+      std::atomic<ReadbackStatus> status { ReadbackStatus::Pending };
+      Collection<Uint8> pixels;
+    };
+
+    /**
+     * @brief The state of a timer query, shared between the recording thread, which polls it, and
+     *        the render thread, which fills it in.
+     */
+    struct TimerQueryState
+    {
+      std::atomic<QueryStatus> status { QueryStatus::Pending };
+      std::atomic<Uint64> nanoseconds { 0 };
+    };
+
+    /**
+     * @brief Set on stand-in handles, so they can be told apart from real handles, such as those
+     *        created by Dear ImGui, when being resolved.
+     */
+    static constexpr Uint32 HANDLE_FLAG = 0x80000000u;
+
+    Scope<RenderBackend>            m_backend = nullptr;
+    RenderThreadSpecification       m_spec;
+    Collection<RenderCommandQueue>  m_queues;
+    std::thread                     m_thread;
+
+    // Recording thread state.
+    Index                           m_writeIndex = 0;
+    Uint32                          m_nextHandle = 1;
+    Collection<Uint32>              m_freeHandles;
+    Collection<Bool>                m_liveHandles;
+    Int32                           m_unpackAlignment = 4;
+    Map<Uint32, Ref<std::atomic<ProgramStatus>>> m_programStatuses;
+    Map<Uint32, Ref<ReadbackState>> m_readbacks;
+    Map<Uint32, Ref<TimerQueryState>> m_timerQueries;
+    Map<Uint32, Ref<std::atomic<Bool>>> m_fences;
+
+    // Render thread state.
+    Index                           m_readIndex = 0;
+    Collection<Uint32>              m_handles;
+    Bool                            m_stopping = false;
+
+    // Shared state.
+    std::atomic<Uint32>             m_pendingFrames { 0 };
+    std::atomic<Bool>               m_failed { false };
+    String                          m_error = "";
+
+  };
+
+}
@@ -0,0 +1,80 @@
+/** @file DG/Math/AABB2D.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `AABB2D` struct describes an axis-aligned box in two-dimensional space, by its
+   *        lowest and highest corners.
+   */
+  struct AABB2D
+  {
+    Vector2f min = { 0.0f, 0.0f };
+    Vector2f max = { 0.0f, 0.0f };
+
+    /**
+     * @brief   Retrieves the point in the middle of this box.
+     *
+     * @return  The box's center.
+     */
+    inline Vector2f getCenter () const
+    {
+      return (min + max) * 0.5f;
+    }
+
+    /**
+     * @brief   Retrieves the width and height of this box.
+     *
+     * @return  The box's size.
+     */
+    inline Vector2f getSize () const
+    {
+      return max - min;
+    }
+
+    /**
+     * @brief   Checks whether the given point lies within this box, or on its edge.
+     *
+     * @param   point The point to check.
+     *
+     * @return  @a `true` if the point lies within the box; @a `false` otherwise.
+     */
+    inline Bool contains (const Vector2f& point) const
+    {
+      return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+    }
+
+    /**
+     * @brief   Checks whether the given box overlaps this one. Boxes which only touch at an edge
+     *          are counted as overlapping.
+     *
+     * @param   other The box to check.
+     *
+     * @return  @a `true` if the boxes overlap; @a `false` otherwise.
+     */
+    inline Bool overlaps (const AABB2D& other) const
+    {
+      return other.min.x <= max.x && other.max.x >= min.x &&
+        other.min.y <= max.y && other.max.y >= min.y;
+    }
+
+    /**
+     * @brief   Creates a new @a `AABB2D` from its center and size.
+     *
+     * @param   center  The new box's center.
+     * @param   size    The new box's width and height.
+     *
+     * @return  The newly-created @a `AABB2D`.
+     */
+    static inline AABB2D fromCenterSize (const Vector2f& center, const Vector2f& size)
+    {
+      return { center - size * 0.5f, center + size * 0.5f };
+    }
+
+  };
+
+}
@@ -0,0 +1,70 @@
+/** @file DG/Math/Circle2D.hpp */
+
+#pragma once
+
+#include <DG/Math/AABB2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `Circle2D` struct describes a circle in two-dimensional space, by its center and
+   *        radius.
+   */
+  struct Circle2D
+  {
+    Vector2f center = { 0.0f, 0.0f };
+    Float32 radius = 0.0f;
+
+    /**
+     * @brief   Retrieves the smallest axis-aligned box around this circle.
+     *
+     * @return  The circle's bounds.
+     */
+    inline AABB2D getBounds () const
+    {
+      return { center - radius, center + radius };
+    }
+
+    /**
+     * @brief   Checks whether the given point lies within this circle, or on its edge.
+     *
+     * @param   point The point to check.
+     *
+     * @return  @a `true` if the point lies within the circle; @a `false` otherwise.
+     */
+    inline Bool contains (const Vector2f& point) const
+    {
+      const Vector2f offset = point - center;
+      return glm::dot(offset, offset) <= radius * radius;
+    }
+
+    /**
+     * @brief   Checks whether the given circle overlaps this one, or touches it.
+     *
+     * @param   other The circle to check.
+     *
+     * @return  @a `true` if the circles overlap; @a `false` otherwise.
+     */
+    inline Bool overlaps (const Circle2D& other) const
+    {
+      const Vector2f offset = other.center - center;
+      const Float32 reach = radius + other.radius;
+      return glm::dot(offset, offset) <= reach * reach;
+    }
+
+    /**
+     * @brief   Checks whether the given box overlaps this circle, or touches it.
+     *
+     * @param   box The box to check.
+     *
+     * @return  @a `true` if the box and circle overlap; @a `false` otherwise.
+     */
+    inline Bool overlaps (const AABB2D& box) const
+    {
+      return contains(glm::clamp(center, box.min, box.max));
+    }
+
+  };
+
+}
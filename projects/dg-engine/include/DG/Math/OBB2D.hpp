@@ -0,0 +1,82 @@
+/** @file DG/Math/OBB2D.hpp */
+
+#pragma once
+
+#include <DG/Math/AABB2D.hpp>
+#include <DG/Math/Transform2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `OBB2D` struct describes a turned box in two-dimensional space, by its center,
+   *        its half-width and half-height, and the direction of its X axis.
+   */
+  struct OBB2D
+  {
+    Vector2f center       = { 0.0f, 0.0f };
+    Vector2f halfExtents  = { 0.0f, 0.0f };
+
+    /**
+     * @brief The direction of the box's X axis. This must be a unit vector.
+     */
+    Vector2f axis = { 1.0f, 0.0f };
+
+    /**
+     * @brief   Retrieves the direction of the box's Y axis, a quarter turn counter-clockwise from
+     *          its X axis.
+     *
+     * @return  The box's Y axis.
+     */
+    inline Vector2f getAxisY () const
+    {
+      return { -axis.y, axis.x };
+    }
+
+    /**
+     * @brief   Retrieves the smallest axis-aligned box around this box.
+     *
+     * @return  The box's bounds.
+     */
+    AABB2D getBounds () const;
+
+    /**
+     * @brief   Checks whether the given point lies within this box, or on its edge.
+     *
+     * @param   point The point to check.
+     *
+     * @return  @a `true` if the point lies within the box; @a `false` otherwise.
+     */
+    Bool contains (const Vector2f& point) const;
+
+    /**
+     * @brief   Checks whether the given axis-aligned box overlaps this box, or touches it.
+     *
+     * @param   box The box to check.
+     *
+     * @return  @a `true` if the boxes overlap; @a `false` otherwise.
+     */
+    Bool overlaps (const AABB2D& box) const;
+
+    /**
+     * @brief   Checks whether the given turned box overlaps this one, or touches it.
+     *
+     * @param   other The box to check.
+     *
+     * @return  @a `true` if the boxes overlap; @a `false` otherwise.
+     */
+    Bool overlaps (const OBB2D& other) const;
+
+    /**
+     * @brief   Creates a new @a `OBB2D` covering the unit quad placed by the given transformation,
+     *          as drawn by @a `Renderer::submitQuad2D`. Any shear in the transformation is ignored.
+     *
+     * @param   transform The quad's transformation.
+     *
+     * @return  The newly-created @a `OBB2D`.
+     */
+    static OBB2D fromTransform (const Transform2D& transform);
+
+  };
+
+}
@@ -0,0 +1,55 @@
+/** @file DG/Math/Ray2D.hpp */
+
+#pragma once
+
+#include <DG/Math/AABB2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `Ray2D` struct describes a ray in two-dimensional space, starting at its origin
+   *        and heading along its direction. Distances along the ray are measured in multiples of
+   *        its direction, so they are world units if the direction is a unit vector.
+   */
+  struct Ray2D
+  {
+    Vector2f origin     = { 0.0f, 0.0f };
+    Vector2f direction  = { 1.0f, 0.0f };
+
+    /**
+     * @brief   Retrieves the point at the given distance along the ray.
+     *
+     * @param   distance  The distance along the ray.
+     *
+     * @return  The point at that distance.
+     */
+    inline Vector2f getPoint (Float32 distance) const
+    {
+      return origin + direction * distance;
+    }
+
+    /**
+     * @brief   Retrieves the reciprocal of the ray's direction, used to cast it against boxes. A
+     *          component which is zero gives a very large number, rather than infinity, so that a
+     *          ray lying along a box's edge does not produce a NaN.
+     *
+     * @return  The reciprocal direction.
+     */
+    Vector2f getInverseDirection () const;
+
+    /**
+     * @brief   Casts the ray against the given box.
+     *
+     * @param   box         The box to cast against.
+     * @param   maxDistance The distance along the ray past which the box is not hit.
+     * @param   distance    Receives the distance along the ray at which the box is first hit;
+     *                      zero, if the ray starts inside of it.
+     *
+     * @return  @a `true` if the ray hits the box; @a `false` otherwise.
+     */
+    Bool cast (const AABB2D& box, Float32 maxDistance, Float32& distance) const;
+
+  };
+
+}
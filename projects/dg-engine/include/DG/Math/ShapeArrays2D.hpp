@@ -0,0 +1,144 @@
+/** @file DG/Math/ShapeArrays2D.hpp */
+
+#pragma once
+
+#include <DG/Math/AABB2D.hpp>
+#include <DG/Math/Circle2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `AABB2DArray` struct stores a collection of axis-aligned boxes as one array per
+   *        coordinate, rather than one array of boxes, so that @a `ShapeQueries2D` can test
+   *        several boxes at once.
+   */
+  struct AABB2DArray
+  {
+    Collection<Float32> minX, minY, maxX, maxY;
+
+    inline Count getSize () const { return minX.size(); }
+
+    inline AABB2D get (Index index) const
+    {
+      return { { minX[index], minY[index] }, { maxX[index], maxY[index] } };
+    }
+
+    inline void set (Index index, const AABB2D& box)
+    {
+      minX[index] = box.min.x;
+      minY[index] = box.min.y;
+      maxX[index] = box.max.x;
+      maxY[index] = box.max.y;
+    }
+
+    inline void push (const AABB2D& box)
+    {
+      minX.push_back(box.min.x);
+      minY.push_back(box.min.y);
+      maxX.push_back(box.max.x);
+      maxY.push_back(box.max.y);
+    }
+
+    inline void reserve (Count count)
+    {
+      minX.reserve(count);
+      minY.reserve(count);
+      maxX.reserve(count);
+      maxY.reserve(count);
+    }
+
+    inline void clear ()
+    {
+      minX.clear();
+      minY.clear();
+      maxX.clear();
+      maxY.clear();
+    }
+  };
+
+  /**
+   * @brief The @a `Circle2DArray` struct stores a collection of circles as one array per
+   *        component, so that @a `ShapeQueries2D` can test several circles at once.
+   */
+  struct Circle2DArray
+  {
+    Collection<Float32> x, y, radius;
+
+    inline Count getSize () const { return x.size(); }
+
+    inline Circle2D get (Index index) const
+    {
+      return { { x[index], y[index] }, radius[index] };
+    }
+
+    inline void set (Index index, const Circle2D& circle)
+    {
+      x[index] = circle.center.x;
+      y[index] = circle.center.y;
+      radius[index] = circle.radius;
+    }
+
+    inline void push (const Circle2D& circle)
+    {
+      x.push_back(circle.center.x);
+      y.push_back(circle.center.y);
+      radius.push_back(circle.radius);
+    }
+
+    inline void reserve (Count count)
+    {
+      x.reserve(count);
+      y.reserve(count);
+      radius.reserve(count);
+    }
+
+    inline void clear ()
+    {
+      x.clear();
+      y.clear();
+      radius.clear();
+    }
+  };
+
+  /**
+   * @brief The @a `Point2DArray` struct stores a collection of points as one array per
+   *        coordinate, so that @a `ShapeQueries2D` can test several points at once.
+   */
+  struct Point2DArray
+  {
+    Collection<Float32> x, y;
+
+    inline Count getSize () const { return x.size(); }
+
+    inline Vector2f get (Index index) const
+    {
+      return { x[index], y[index] };
+    }
+
+    inline void set (Index index, const Vector2f& point)
+    {
+      x[index] = point.x;
+      y[index] = point.y;
+    }
+
+    inline void push (const Vector2f& point)
+    {
+      x.push_back(point.x);
+      y.push_back(point.y);
+    }
+
+    inline void reserve (Count count)
+    {
+      x.reserve(count);
+      y.reserve(count);
+    }
+
+    inline void clear ()
+    {
+      x.clear();
+      y.clear();
+    }
+  };
+
+}
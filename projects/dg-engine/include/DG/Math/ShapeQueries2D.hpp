@@ -0,0 +1,150 @@
+/** @file DG/Math/ShapeQueries2D.hpp */
+
+#pragma once
+
+#include <DG/Math/OBB2D.hpp>
+#include <DG/Math/Ray2D.hpp>
+#include <DG/Math/ShapeArrays2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `RayHit2D` struct describes a shape hit by a ray cast with @a `ShapeQueries2D`.
+   */
+  struct RayHit2D
+  {
+    /**
+     * @brief The index of the shape which was hit.
+     */
+    Index index = 0;
+
+    /**
+     * @brief The distance along the ray at which the shape was first hit.
+     */
+    Float32 distance = 0.0f;
+  };
+
+  /**
+   * @brief The @a `ShapeQueries2D` class is a static helper class which tests one shape against a
+   *        whole array of shapes, such as to find the objects under the mouse, or within an
+   *        explosion's reach.
+   *
+   *        Where the compiler targets SSE2, four shapes are tested at once; the rest, and every
+   *        shape elsewhere, are tested one at a time with the shapes' own functions, which give
+   *        the same answers. The indices of the shapes which pass are written in ascending order.
+   */
+  class ShapeQueries2D
+  {
+  public:
+
+    /**
+     * @brief   Finds the boxes which overlap the given box.
+     *
+     * @param   query The box to test against.
+     * @param   boxes The boxes to test.
+     * @param   hits  Replaced with the indices of the boxes which overlap the query.
+     *
+     * @return  The number of boxes which overlap the query.
+     */
+    static Count overlapping (const AABB2D& query, const AABB2DArray& boxes,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Finds the boxes which overlap the given turned box.
+     *
+     * @param   query The turned box to test against.
+     * @param   boxes The boxes to test.
+     * @param   hits  Replaced with the indices of the boxes which overlap the query.
+     *
+     * @return  The number of boxes which overlap the query.
+     */
+    static Count overlapping (const OBB2D& query, const AABB2DArray& boxes,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Finds the boxes which overlap the given circle.
+     *
+     * @param   query The circle to test against.
+     * @param   boxes The boxes to test.
+     * @param   hits  Replaced with the indices of the boxes which overlap the query.
+     *
+     * @return  The number of boxes which overlap the query.
+     */
+    static Count overlapping (const Circle2D& query, const AABB2DArray& boxes,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Finds the circles which overlap the given circle.
+     *
+     * @param   query   The circle to test against.
+     * @param   circles The circles to test.
+     * @param   hits    Replaced with the indices of the circles which overlap the query.
+     *
+     * @return  The number of circles which overlap the query.
+     */
+    static Count overlapping (const Circle2D& query, const Circle2DArray& circles,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Finds the boxes which contain the given point, such as to pick the objects under
+     *          the mouse.
+     *
+     * @param   point The point to test against.
+     * @param   boxes The boxes to test.
+     * @param   hits  Replaced with the indices of the boxes which contain the point.
+     *
+     * @return  The number of boxes which contain the point.
+     */
+    static Count containing (const Vector2f& point, const AABB2DArray& boxes,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Finds the points which lie within the given box, such as for a marquee selection.
+     *
+     * @param   rect    The box to test against.
+     * @param   points  The points to test.
+     * @param   hits    Replaced with the indices of the points which lie within the box.
+     *
+     * @return  The number of points which lie within the box.
+     */
+    static Count containedBy (const AABB2D& rect, const Point2DArray& points,
+      Collection<Index>& hits);
+
+    /**
+     * @brief   Casts a ray against every box, finding each box which it hits.
+     *
+     * @param   ray         The ray to cast.
+     * @param   maxDistance The distance along the ray past which boxes are not hit.
+     * @param   boxes       The boxes to cast against.
+     * @param   hits        Replaced with the boxes which the ray hits, in order of their indices.
+     *
+     * @return  The number of boxes which the ray hits.
+     */
+    static Count castRay (const Ray2D& ray, Float32 maxDistance, const AABB2DArray& boxes,
+      Collection<RayHit2D>& hits);
+
+    /**
+     * @brief   Casts a ray against every box, finding the nearest box which it hits. Of boxes hit
+     *          at the same distance, the one with the lowest index is taken.
+     *
+     * @param   ray         The ray to cast.
+     * @param   maxDistance The distance along the ray past which boxes are not hit.
+     * @param   boxes       The boxes to cast against.
+     * @param   nearest     Receives the nearest box which the ray hits, if any.
+     *
+     * @return  @a `true` if the ray hits a box; @a `false` otherwise.
+     */
+    static Bool castRayNearest (const Ray2D& ray, Float32 maxDistance, const AABB2DArray& boxes,
+      RayHit2D& nearest);
+
+    /**
+     * @brief   Retrieves whether or not the queries test several shapes at once on this build.
+     *
+     * @return  @a `true` if the queries use SSE2; @a `false` if they test one shape at a time.
+     */
+    static Bool isVectorized ();
+
+  };
+
+}
@@ -0,0 +1,89 @@
+/** @file DG/Math/Transform2D.hpp */
+
+#pragma once
+
+#include <DG_Pch.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `Transform2D` struct describes an affine transformation in two-dimensional
+   *        space, stored as the three columns of a 2x3 matrix: the images of the X and Y axes,
+   *        and the origin. It does the work of a 2D model matrix in six numbers, rather than the
+   *        sixteen of a @a `Matrix4f`.
+   */
+  struct Transform2D
+  {
+    Vector2f axisX  = { 1.0f, 0.0f };
+    Vector2f axisY  = { 0.0f, 1.0f };
+    Vector2f origin = { 0.0f, 0.0f };
+
+    /**
+     * @brief   Transforms the given point, moving it by the transformation's origin.
+     *
+     * @param   point The point to transform.
+     *
+     * @return  The transformed point.
+     */
+    inline Vector2f transformPoint (const Vector2f& point) const
+    {
+      return origin + axisX * point.x + axisY * point.y;
+    }
+
+    /**
+     * @brief   Transforms the given direction, which is not moved by the transformation's origin.
+     *
+     * @param   vector  The direction to transform.
+     *
+     * @return  The transformed direction.
+     */
+    inline Vector2f transformVector (const Vector2f& vector) const
+    {
+      return axisX * vector.x + axisY * vector.y;
+    }
+
+    /**
+     * @brief   Combines this transformation with the given one, such that the result applies the
+     *          given transformation first, then this one.
+     *
+     * @param   other The transformation to apply first.
+     *
+     * @return  The combined transformation.
+     */
+    Transform2D operator* (const Transform2D& other) const;
+
+    /**
+     * @brief   Retrieves the transformation which undoes this one.
+     *
+     * @return  The inverse transformation; or the identity, if this transformation collapses
+     *          space onto a line or a point, and so cannot be undone.
+     */
+    Transform2D inverse () const;
+
+    /**
+     * @brief   Expands this transformation into a @a `Matrix4f`, such as for a shader.
+     *
+     * @param   depth The Z coordinate to which the matrix moves points.
+     *
+     * @return  The expanded matrix.
+     */
+    Matrix4f toMatrix (Float32 depth = 0.0f) const;
+
+    /**
+     * @brief   Creates a new @a `Transform2D` which scales, then rotates, then moves points; the
+     *          same as @a `translate * rotate * scale` built with @a `Matrix4f`s, but with the
+     *          sine and cosine of the rotation worked out once.
+     *
+     * @param   position  The position to move points to.
+     * @param   rotation  The counter-clockwise rotation, in degrees.
+     * @param   scale     The scale along each axis.
+     *
+     * @return  The newly-created @a `Transform2D`.
+     */
+    static Transform2D fromPositionRotationScale (const Vector2f& position, Float32 rotation,
+      const Vector2f& scale = { 1.0f, 1.0f });
+
+  };
+
+}
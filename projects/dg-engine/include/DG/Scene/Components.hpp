@@ -0,0 +1,70 @@
+/** @file DG/Scene/Components.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Color.hpp>
+#include <DG/Graphics/OrthographicCamera2D.hpp>
+#include <DG/Graphics/SubTexture.hpp>
+#include <DG/Math/Transform2D.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `TransformComponent` struct places an entity in the world.
+   */
+  struct TransformComponent
+  {
+    /**
+     * @brief The entity's transformation. A sprite covers the unit quad which it places.
+     */
+    Transform2D transform;
+
+    /**
+     * @brief The entity's Z coordinate.
+     */
+    Float32 depth = 0.0f;
+  };
+
+  /**
+   * @brief The @a `SpriteRendererComponent` struct describes how an entity is drawn, as a quad
+   *        covering its transformation.
+   */
+  struct SpriteRendererComponent
+  {
+    /**
+     * @brief The sprite's color; or, if it is textured, the tint over its texture.
+     */
+    Color color = Color::White;
+
+    /**
+     * @brief Points to a @a `Texture` drawn over the sprite, if any.
+     */
+    Ref<Texture> texture = nullptr;
+
+    /**
+     * @brief Points to a region of a @a `Texture` drawn over the sprite, such as a frame of a
+     *        sprite sheet. If given, this takes the place of @a `texture`.
+     */
+    Ref<SubTexture> subTexture = nullptr;
+  };
+
+  /**
+   * @brief The @a `CameraComponent` struct turns an entity into a camera. The camera follows the
+   *        position and rotation of the entity's @a `TransformComponent`, if it has one.
+   */
+  struct CameraComponent
+  {
+    /**
+     * @brief The camera, whose viewport size and zoom are set here.
+     */
+    OrthographicCamera2D camera;
+
+    /**
+     * @brief Is this the camera through which the scene is drawn? If several cameras are, the
+     *        first one found is used.
+     */
+    Bool primary = true;
+  };
+
+}
@@ -0,0 +1,129 @@
+/** @file DG/Scene/Entity.hpp */
+
+#pragma once
+
+#include <DG/Scene/Scene.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `Entity` class is a lightweight handle to an entity in a @a `Scene`, through
+   *        which its components are added, retrieved and removed. It is cheap to copy, and does
+   *        not keep the scene alive.
+   */
+  class Entity
+  {
+  public:
+
+    /**
+     * @brief Constructs a null @a `Entity`.
+     */
+    Entity () = default;
+
+    /**
+     * @brief Constructs an @a `Entity` handle.
+     *
+     * @param handle  The entity's handle in the scene's registry.
+     * @param scene   The scene to which the entity belongs.
+     */
+    Entity (entt::entity handle, Scene* scene);
+
+  public: // Components
+
+    /**
+     * @brief   Adds a component to this entity.
+     *
+     * @tparam  T     The type of the component.
+     * @param   args  The arguments with which the component is constructed.
+     *
+     * @return  A reference to the new component.
+     *
+     * @throw   @a `std::invalid_argument` if the entity already has a component of this type.
+     */
+    template <typename T, typename... Args>
+    T& addComponent (Args&&... args)
+    {
+      if (hasComponent<T>() == true) {
+        DG_ENGINE_CRIT("Entity {} already has this component.", getId());
+        throw std::invalid_argument { "Attempt to add a component which the entity already has!" };
+      }
+
+      return m_scene->getRegistry().emplace<T>(m_handle, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief   Retrieves one of this entity's components.
+     *
+     * @tparam  T The type of the component.
+     *
+     * @return  A reference to the component.
+     *
+     * @throw   @a `std::out_of_range` if the entity has no component of this type.
+     */
+    template <typename T>
+    T& getComponent () const
+    {
+      T* component = m_scene->getRegistry().try_get<T>(m_handle);
+      if (component == nullptr) {
+        DG_ENGINE_CRIT("Entity {} has no such component.", getId());
+        throw std::out_of_range { "Attempt to get a component which the entity does not have!" };
+      }
+
+      return *component;
+    }
+
+    /**
+     * @brief   Retrieves whether or not this entity has a component of the given type.
+     *
+     * @tparam  T The type of the component.
+     *
+     * @return  @a `true` if the entity has the component; @a `false` otherwise.
+     */
+    template <typename T>
+    Bool hasComponent () const
+    {
+      return m_scene->getRegistry().all_of<T>(m_handle);
+    }
+
+    /**
+     * @brief   Removes one of this entity's components, if it has one.
+     *
+     * @tparam  T The type of the component.
+     */
+    template <typename T>
+    void removeComponent ()
+    {
+      m_scene->getRegistry().remove<T>(m_handle);
+    }
+
+  public: // Getters
+
+    /**
+     * @brief   Retrieves this entity's ID: the index part of its handle, without its version.
+     *          This is the ID which is drawn into a frame buffer's entity ID attachment.
+     *
+     * @return  The entity's ID; or @a `-1`, if this is a null entity.
+     */
+    Int32 getId () const;
+
+    inline entt::entity getHandle () const { return m_handle; }
+    inline Scene* getScene () const { return m_scene; }
+
+    /**
+     * @brief   Retrieves whether or not this entity refers to a living entity in a scene.
+     */
+    operator Bool () const;
+
+    inline Bool operator== (const Entity& other) const
+    {
+      return m_handle == other.m_handle && m_scene == other.m_scene;
+    }
+
+  private:
+    entt::entity m_handle = entt::null;
+    Scene* m_scene = nullptr;
+
+  };
+
+}
@@ -0,0 +1,107 @@
+/** @file DG/Scene/Scene.hpp */
+
+#pragma once
+
+#include <DG/Graphics/Renderer.hpp>
+#include <DG/Scene/Components.hpp>
+
+namespace dg
+{
+
+  class Entity;
+
+  /**
+   * @brief The @a `Scene` class holds a world of entities and their components, stored in an
+   *        @a `entt::registry`.
+   *
+   *        Entities with both a @a `TransformComponent` and a @a `SpriteRendererComponent` are
+   *        kept in an owning group, which packs both components at the front of their pools, in
+   *        the same order. Drawing the scene walks those pools from front to back, handing them to
+   *        the @a `Renderer` a page at a time, so the sprites are read in the order they are laid
+   *        out in memory.
+   */
+  class Scene
+  {
+  public:
+
+    /**
+     * @brief Constructs a new, empty @a `Scene`.
+     */
+    Scene ();
+
+    /**
+     * @brief Destroys every entity in this @a `Scene`.
+     */
+    ~Scene ();
+
+  public: // Entities
+
+    /**
+     * @brief   Creates a new entity, with no components.
+     *
+     * @return  The new entity.
+     */
+    Entity createEntity ();
+
+    /**
+     * @brief   Destroys the given entity, along with its components.
+     *
+     * @param   entity  The entity to destroy.
+     *
+     * @throw   @a `std::invalid_argument` if the entity does not belong to this scene.
+     */
+    void destroyEntity (Entity entity);
+
+    /**
+     * @brief   Retrieves the entity with the given ID, such as one read back from the entity ID
+     *          attachment of a @a `FrameBuffer` under the mouse.
+     *
+     * @param   id  The entity's ID.
+     *
+     * @return  The entity; or a null entity, if no entity has that ID.
+     */
+    Entity getEntity (Int32 id);
+
+    /**
+     * @brief   Retrieves the first entity with a primary @a `CameraComponent`.
+     *
+     * @return  The camera entity; or a null entity, if there is none.
+     */
+    Entity getPrimaryCamera ();
+
+    /**
+     * @brief   Retrieves the number of entities in this scene.
+     *
+     * @return  The number of entities.
+     */
+    Count getEntityCount () const;
+
+    inline entt::registry& getRegistry () { return m_registry; }
+    inline const entt::registry& getRegistry () const { return m_registry; }
+
+  public: // Rendering
+
+    /**
+     * @brief   Draws the scene's sprites through its primary camera, in a scene of their own. The
+     *          camera is first moved and turned to follow its entity's transformation. Nothing is
+     *          drawn if the scene has no primary camera.
+     *
+     * @param   renderer  The renderer to draw the scene with.
+     */
+    void render (Renderer& renderer);
+
+  public:
+
+    /**
+     * @brief   Creates a new, empty @a `Scene`.
+     *
+     * @return  A pointer to the new scene.
+     */
+    static Ref<Scene> make ();
+
+  private:
+    entt::registry m_registry;
+
+  };
+
+}
@@ -0,0 +1,123 @@
+/** @file DG/Scene/SceneSerializer.hpp */
+
+#pragma once
+
+#include <DG/Scene/Scene.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The file extension given to scene files.
+   */
+  constexpr const char* SCENE_FILE_EXTENSION = ".dgscene";
+
+  /**
+   * @brief The four bytes - "DGSC" - found at the start of every scene file.
+   */
+  constexpr Uint32 SCENE_FILE_MAGIC = 0x43534744;
+
+  /**
+   * @brief The version of the scene file layout written by the @a `SceneSerializer`. Each chunk
+   *        has a version of its own, which changes along with the layout of its records.
+   */
+  constexpr Uint16 SCENE_FILE_VERSION = 1;
+
+  /**
+   * @brief The @a `SceneChunkType` enum enumerates the chunks which a scene file may hold. Chunks
+   *        of a type not listed here are skipped when loading, so that newer files can still be
+   *        read, less the components which this build does not know about.
+   */
+  enum class SceneChunkType : Uint32
+  {
+    Entities      = 1,
+    TextureNames  = 2,
+    SubTextures   = 3,
+    Transforms    = 4,
+    Sprites       = 5,
+    Cameras       = 6
+  };
+
+  /**
+   * @brief The @a `SceneFileHeader` struct is found at the start of every scene file, and is
+   *        followed right away by a table of contents, with a @a `SceneChunkEntry` for each chunk.
+   */
+  struct SceneFileHeader
+  {
+    Uint32 magic = SCENE_FILE_MAGIC;
+    Uint16 version = SCENE_FILE_VERSION;
+    Uint16 chunkCount = 0;
+    Uint32 entityCount = 0;
+    Uint32 inUseCount = 0;
+    Uint64 fileSize = 0;
+    Uint64 reserved = 0;
+  };
+
+  static_assert(sizeof(SceneFileHeader) == 32, "Scene file header must be 32 bytes!");
+
+  /**
+   * @brief The @a `SceneChunkEntry` struct locates one chunk of a scene file.
+   *
+   *        The entity chunk holds the registry's entities, in the order they are packed, with
+   *        those still in use first. A component chunk holds the entities which have the
+   *        component, in the order they are packed in its pool, followed by one record for each
+   *        of them. Both arrays start on a 16-byte boundary, so that they can be read in place.
+   */
+  struct SceneChunkEntry
+  {
+    SceneChunkType type = SceneChunkType::Entities;
+    Uint16 version = 1;
+    Uint16 reserved = 0;
+    Uint32 stride = 0;
+    Uint32 count = 0;
+    Uint64 offset = 0;
+    Uint64 size = 0;
+  };
+
+  static_assert(sizeof(SceneChunkEntry) == 32, "Scene chunk entry must be 32 bytes!");
+
+  /**
+   * @brief The @a `SceneSerializer` class is a static helper class which writes a @a `Scene` to a
+   *        binary scene file, and reads it back.
+   *
+   *        A scene file stores each component pool as contiguous arrays, laid out as they are in
+   *        memory, so that loading maps the file and copies the arrays into the registry, with no
+   *        parsing along the way. Components which hold plain values, such as the
+   *        @a `TransformComponent`, are stored as they are. Those which point to assets are stored
+   *        as fixed-size records, which name their textures through a table shared by the file.
+   *        Entities keep their IDs and versions, so IDs stored elsewhere stay valid.
+   */
+  class SceneSerializer
+  {
+  public:
+
+    /**
+     * @brief   Writes the given scene's entities and components to a scene file. The file is
+     *          written in full before it replaces any existing one.
+     *
+     *          Textures are named by the image file they were loaded from, relative to the working
+     *          directory, so that they are found again through the @a `TextureManager` when the
+     *          scene is loaded. Sprites whose textures were not loaded from a file are written
+     *          without them.
+     *
+     * @param   scene The scene to write.
+     * @param   path  The path to the scene file to write.
+     *
+     * @return  @a `true` if the scene file is written successfully; @a `false` otherwise.
+     */
+    static Bool save (const Scene& scene, const Path& path);
+
+    /**
+     * @brief   Maps the given scene file into memory and loads its entities and components into a
+     *          new scene. Textures are loaded through the @a `TextureManager`.
+     *
+     * @param   path  The path to the scene file to load.
+     *
+     * @return  A pointer to the new scene; or @a `nullptr` if the file could not be mapped, or is
+     *          not a valid scene file.
+     */
+    static Ref<Scene> load (const Path& path);
+
+  };
+
+}
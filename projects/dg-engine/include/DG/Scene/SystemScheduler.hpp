@@ -0,0 +1,355 @@
+/** @file DG/Scene/SystemScheduler.hpp */
+
+#pragma once
+
+#include <DG/Core/Clock.hpp>
+#include <DG/Core/ThreadPool.hpp>
+#include <DG/Scene/Scene.hpp>
+
+namespace dg
+{
+
+  /**
+   * @brief The @a `SystemAccess` struct lists the components which a system reads and writes, so
+   *        that the @a `SystemScheduler` knows which systems may run at the same time.
+   */
+  struct SystemAccess
+  {
+    Collection<entt::id_type> reads;
+    Collection<entt::id_type> writes;
+
+    /**
+     * @brief Makes sure that the pools of the listed components exist, so that systems running on
+     *        other threads never add one to the registry.
+     */
+    Collection<LFunction<void, entt::registry&>> assurePools;
+
+    /**
+     * @brief   Declares that the system reads the given components.
+     *
+     * @tparam  T The types of the components.
+     *
+     * @return  This access list, so that calls can be chained.
+     */
+    template <typename... T>
+    SystemAccess& read ()
+    {
+      (add<T>(reads), ...);
+      return *this;
+    }
+
+    /**
+     * @brief   Declares that the system writes the given components.
+     *
+     * @tparam  T The types of the components.
+     *
+     * @return  This access list, so that calls can be chained.
+     */
+    template <typename... T>
+    SystemAccess& write ()
+    {
+      (add<T>(writes), ...);
+      return *this;
+    }
+
+    /**
+     * @brief   Checks whether a system with this access list must not run at the same time as one
+     *          with the given list: that is, whether either writes a component which the other
+     *          reads or writes.
+     *
+     * @param   other The other system's access list.
+     *
+     * @return  @a `true` if the systems conflict; @a `false` otherwise.
+     */
+    Bool conflictsWith (const SystemAccess& other) const;
+
+  private:
+    template <typename T>
+    void add (Collection<entt::id_type>& ids)
+    {
+      ids.push_back(entt::type_hash<T>::value());
+      assurePools.push_back([] (entt::registry& registry) { registry.storage<T>(); });
+    }
+
+  };
+
+  class SystemContext;
+
+  /**
+   * @brief The @a `SystemSpecification` struct describes a system run by the
+   *        @a `SystemScheduler`.
+   */
+  struct SystemSpecification
+  {
+
+    /**
+     * @brief The system's name, as shown in the scheduler's trace.
+     */
+    String name;
+
+    /**
+     * @brief The components which the system reads and writes.
+     */
+    SystemAccess access;
+
+    /**
+     * @brief Must the system run on the thread which calls @a `SystemScheduler::run`, such as one
+     *        which draws with the @a `Renderer`?
+     */
+    Bool mainThread = false;
+
+    /**
+     * @brief The function which carries out the system's work.
+     */
+    LFunction<void, SystemContext&> function;
+
+  };
+
+  /**
+   * @brief The @a `SystemSchedulerSpecification` struct describes attributes defining the
+   *        @a `SystemScheduler`.
+   */
+  struct SystemSchedulerSpecification
+  {
+
+    /**
+     * @brief The number of worker threads. If zero, one fewer than the number of hardware threads
+     *        is used, with a minimum of one.
+     */
+    Count workerCount = 0;
+
+    /**
+     * @brief The fewest entities which a system's view is split into a chunk of, when it is split
+     *        across the worker threads.
+     */
+    Count minChunkSize = 4096;
+
+    /**
+     * @brief Should the scheduler record when and where each system runs?
+     */
+    Bool tracing = true;
+
+  };
+
+  /**
+   * @brief The @a `SystemTraceEntry` struct records when and where a system, or one chunk of a
+   *        system's view, ran during a frame. Times are in seconds since the frame began.
+   */
+  struct SystemTraceEntry
+  {
+    Index system = 0;
+    Index thread = 0;
+    Bool chunk = false;
+    Float32 readyTime = 0.0f;
+    Float32 startTime = 0.0f;
+    Float32 endTime = 0.0f;
+
+    /**
+     * @brief   Retrieves how long the system waited for a thread after all of the systems it
+     *          depends on had finished. Chunks report zero.
+     *
+     * @return  The time spent waiting, in seconds.
+     */
+    inline Float32 getWaitTime () const { return startTime - readyTime; }
+  };
+
+  /**
+   * @brief The @a `SystemFrameTrace` struct records when and where the systems ran during the last
+   *        frame run by the @a `SystemScheduler`.
+   */
+  struct SystemFrameTrace
+  {
+    /**
+     * @brief The time taken to run the frame, in seconds.
+     */
+    Float32 frameTime = 0.0f;
+
+    /**
+     * @brief The number of threads on which systems or chunks ran. Thread zero is the one which
+     *        called @a `SystemScheduler::run`.
+     */
+    Count threadCount = 0;
+
+    /**
+     * @brief An entry for each system which ran, followed by one for each chunk of a split view.
+     */
+    Collection<SystemTraceEntry> entries;
+  };
+
+  /**
+   * @brief The @a `SystemScheduler` class runs a scene's systems once per frame, running those
+   *        which do not conflict at the same time on a pool of worker threads.
+   *
+   *        Each system lists the components it reads and writes. A system which conflicts with an
+   *        earlier one, by writing what the other reads or writes, or by reading what it writes,
+   *        waits for it to finish; the others start as soon as a thread is free. The resulting
+   *        graph is built when systems are added, and walked afresh each frame. Systems may split
+   *        a large view across the threads with @a `SystemContext::forEach`.
+   */
+  class SystemScheduler
+  {
+  public:
+
+    /**
+     * @brief Constructs the @a `SystemScheduler`, starting its worker threads.
+     *
+     * @param spec  The scheduler's specification.
+     */
+    SystemScheduler (const SystemSchedulerSpecification& spec = {});
+
+    /**
+     * @brief   Adds a system, to be run after any earlier system which it conflicts with.
+     *
+     * @param   spec  The system's specification.
+     *
+     * @return  The system's index.
+     *
+     * @throw   @a `std::invalid_argument` if the system has no function.
+     */
+    Index addSystem (const SystemSpecification& spec);
+
+    /**
+     * @brief Removes every system.
+     */
+    void clear ();
+
+    /**
+     * @brief   Runs every system once, returning when they have all finished. Systems which must
+     *          run on the calling thread are run here; the rest run on the worker threads.
+     *
+     * @param   scene     The scene whose systems are run.
+     * @param   deltaTime The time since the last frame, in seconds.
+     *
+     * @throw   The first exception thrown by a system, once the others have finished.
+     */
+    void run (Scene& scene, Float32 deltaTime);
+
+    /**
+     * @brief   Writes the last frame's trace to a file which can be viewed in a browser's trace
+     *          viewer, such as @a `chrome://tracing`.
+     *
+     * @param   path  The file to write.
+     *
+     * @return  @a `true` if the trace was written; @a `false` otherwise.
+     */
+    Boolean writeTrace (const Path& path) const;
+
+    inline Count getSystemCount () const { return m_systems.size(); }
+    inline Count getWorkerCount () const { return m_pool.getWorkerCount(); }
+    inline const SystemSpecification& getSystem (Index index) const { return m_systems.at(index); }
+    inline const SystemFrameTrace& getTrace () const { return m_trace; }
+
+  private:
+
+    /**
+     * @brief Runs one system, then hands its dependents to a thread once they are ready.
+     */
+    void execute (Index system);
+
+    /**
+     * @brief Hands a system whose dependencies have finished to a thread.
+     */
+    void dispatch (Index system);
+
+    /**
+     * @brief Retrieves the time since the frame began, in seconds.
+     */
+    Float32 now () const;
+
+    /**
+     * @brief Records a trace entry for the calling thread, if tracing is on.
+     */
+    void record (const SystemTraceEntry& entry);
+
+    friend class SystemContext;
+
+  private:
+    SystemSchedulerSpecification        m_spec;
+    Collection<SystemSpecification>     m_systems;
+    Collection<Collection<Index>>       m_dependents;
+    Collection<Count>                   m_dependencyCounts;
+
+    // The state of the frame being run.
+    Scene*                              m_scene = nullptr;
+    Float32                             m_deltaTime = 0.0f;
+    Clock                               m_frameClock;
+    Collection<Count>                   m_remaining;
+    Collection<Float32>                 m_readyTimes;
+    std::deque<Index>                   m_mainQueue;
+    Count                               m_finishedCount = 0;
+    std::exception_ptr                  m_error = nullptr;
+    std::mutex                          m_mutex;
+    std::condition_variable             m_condition;
+
+    SystemFrameTrace                    m_trace;
+    Collection<std::thread::id>         m_threads;
+    std::mutex                          m_traceMutex;
+
+    // Declared last, so that the worker threads are stopped before anything they use is gone.
+    ThreadPool                          m_pool;
+
+  };
+
+  /**
+   * @brief The @a `SystemContext` class is handed to each system as it runs, giving it the scene,
+   *        the frame's time step, and a way to split its work across the worker threads.
+   */
+  class SystemContext
+  {
+  public:
+    SystemContext (SystemScheduler& scheduler, Index system);
+
+    inline Scene& getScene () const { return *m_scheduler.m_scene; }
+    inline entt::registry& getRegistry () const { return m_scheduler.m_scene->getRegistry(); }
+    inline Float32 getDeltaTime () const { return m_scheduler.m_deltaTime; }
+
+    /**
+     * @brief   Calls the given function for every entity with all of the given components,
+     *          splitting them into chunks which run across the worker threads, as well as the
+     *          calling one. Returns once every chunk has finished. The function must only touch
+     *          the entity it is given, and components which the system has declared.
+     *
+     * @tparam  T The types of the components to iterate over. None may be empty.
+     *
+     * @param   function  The function to call, with each entity and references to its components.
+     */
+    template <typename... T, typename F>
+    void forEach (F&& function)
+    {
+      auto view = getRegistry().template view<T...>();
+      const auto* handle = view.handle();
+      if (handle == nullptr) {
+        return;
+      }
+
+      const entt::entity* entities = handle->data();
+      parallelFor(handle->size(), [&] (Index begin, Index end)
+      {
+        for (Index i = begin; i < end; ++i) {
+          const entt::entity entity = entities[i];
+          if (view.contains(entity) == true) {
+            function(entity, view.template get<T>(entity)...);
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief   Splits the range @a `[0, count)` into chunks, and calls the given function for each
+     *          chunk across the worker threads, as well as the calling one. Returns once every
+     *          chunk has finished.
+     *
+     * @param   count     The number of items in the range.
+     * @param   function  The function to call with the start and end of each chunk.
+     *
+     * @throw   The first exception thrown by a chunk, once the others have finished.
+     */
+    void parallelFor (Count count, const LFunction<void, Index, Index>& function);
+
+  private:
+    SystemScheduler& m_scheduler;
+    Index m_system = 0;
+
+  };
+
+}
@@ -0,0 +1,16 @@
+/** @file DG_ImGuiConfig.hpp */
+
+#ifndef DG_IMGUI_CONFIG_HPP
+#define DG_IMGUI_CONFIG_HPP
+
+// This file is included by Dear ImGui's `imconfig.h`, in place of changes to it, through the
+// `IMGUI_USER_CONFIG` macro set in `premake5.lua`.
+
+// Give each thread its own current context. With a render thread, the engine draws the GUI there
+// with a context of its own, while the main thread builds the next frame with the main context.
+// The variable is defined in `DG/Core/GuiContext.cpp`.
+struct ImGuiContext;
+extern thread_local ImGuiContext* DgImGuiCurrentContext;
+#define GImGui DgImGuiCurrentContext
+
+#endif
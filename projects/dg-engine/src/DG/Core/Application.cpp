@@ -1,10 +1,15 @@
 /** @file DG/Core/Application.cpp */
 
 #include <DG/Graphics/ColorPalette.hpp>
+#include <DG/Graphics/DynamicResolution.hpp>
+#include <DG/Graphics/FrameCapture.hpp>
+#include <DG/Graphics/PixelReadback.hpp>
+#include <DG/Graphics/RenderTargetPool.hpp>
 #include <DG/Graphics/Shader.hpp>
 #include <DG/Graphics/Texture.hpp>
 
 #include <DG/Events/EventBus.hpp>
+#include <DG/Core/AssetLoader.hpp>
 #include <DG/Core/Clock.hpp>
 #include <DG/Graphics/RenderInterface.hpp>
 #include <DG/Core/Application.hpp>
@@ -30,10 +35,53 @@ namespace dg
       EventBus::initialize(*this);                    // Initialize the event bus.
       m_layerStack = makeScope<LayerStack>();         // Initialize the layer stack.
       m_window = Window::make(spec.windowSpec);       // Initialize the window.
-      m_renderer = Renderer::make(spec.rendererSpec); // Initialize the renderer.
 
-      // Initialize GUI if desired.
-      if (spec.guiSpec.enabled == true) {
+      // If a render thread is requested, hand the window's graphics context over to it, and have
+      // it present each frame. The main thread only records commands from here on out.
+      RendererSpecification rendererSpec = spec.rendererSpec;
+      if (rendererSpec.thread.enabled == true) {
+        auto& thread = rendererSpec.thread;
+        if (thread.attachContext == nullptr) {
+          thread.attachContext = [this] () { m_window->makeContextCurrent(); };
+        }
+        if (thread.detachContext == nullptr) {
+          thread.detachContext = [this] () { m_window->releaseContext(); };
+        }
+        if (thread.present == nullptr) {
+          thread.present = [this] () { m_window->present(); };
+        }
+
+        m_window->releaseContext();
+      }
+
+      m_renderer = Renderer::make(rendererSpec);      // Initialize the renderer.
+      AssetLoader::initialize(spec.assetWorkerCount); // Initialize the asset loader.
+
+      FrameBufferSpecification targetSpec;
+      targetSpec.size = m_window->getSize();
+      targetSpec.attachmentSpec = {
+        FrameBufferTextureFormat::ColorRGBA8,
+        FrameBufferTextureFormat::ColorR32,
+        FrameBufferTextureFormat::Depth
+      };
+
+      // A headless window has no visible back buffer, so render into a frame buffer instead. If
+      // the 2D scene's resolution is to adapt, render it into a frame buffer sized to the scaled
+      // resolution, and upscale that into the window at the end of each frame.
+      if (m_window->isHeadless() == true) {
+        m_headlessTarget = FrameBuffer::make(targetSpec);
+        m_renderer->useFrameBuffer2D(m_headlessTarget);
+      } else if (rendererSpec.resolution.enabled == true) {
+        m_sceneTarget = FrameBuffer::make(targetSpec);
+        m_renderer->useFrameBuffer2D(m_sceneTarget);
+      }
+
+      // Initialize GUI if desired. It is driven by GLFW, so a headless window created without
+      // GLFW cannot have one.
+      if (spec.guiSpec.enabled == true && m_window->getPointer() == nullptr) {
+        DG_ENGINE_WARN("The GUI needs a GLFW window, which this headless window has not got; "
+          "disabling it.");
+      } else if (spec.guiSpec.enabled == true) {
         m_guiContext = GuiContext::make(spec.guiSpec);
       }
 
@@ -45,12 +93,16 @@ namespace dg
 
   Application::~Application ()
   {
+    AssetLoader::shutdown();
     ColorPaletteManager::clear();
     TextureManager::clear();
     ShaderManager::clear();
 
     m_guiContext.reset();
+    m_headlessTarget.reset();
+    m_sceneTarget.reset();
     m_renderer.reset();
+    RenderInterface::shutdown();
     m_window.reset();
     m_layerStack.reset();
     s_instance = nullptr;
@@ -83,6 +135,15 @@ namespace dg
     return *s_instance->m_renderer;
   }
 
+  const Ref<FrameBuffer>& Application::getHeadlessTarget ()
+  {
+    if (s_instance == nullptr) {
+      throw std::runtime_error { "Client application instance does not exist!" };
+    }
+
+    return s_instance->m_headlessTarget;
+  }
+
   Result Application::start ()
   {
     // Early out with an error if something went wrong constructing the application.
@@ -166,6 +227,32 @@ namespace dg
   void Application::update ()
   {
 
+    // Finish any assets which have been loaded in the background.
+    AssetLoader::update();
+
+    // Upload this frame's share of any pending texture data.
+    TextureUploadQueue::process();
+
+    // Evict textures which have not been drawn lately, if they are over budget.
+    TextureResidency::update();
+
+    // Hand pixel readbacks whose data has arrived to their callbacks.
+    PixelReadback::update();
+
+    // Hand captured frames whose pixels have arrived to the frame capture's writer.
+    FrameCapture::update();
+
+    // Destroy render targets which have sat idle for too long.
+    RenderTargetPool::update();
+
+    // Adapt the 2D scene's resolution to the time its last frames took.
+    DynamicResolution::update();
+
+    // Size the 2D scene's frame buffer to the adapted resolution, before any scene begins.
+    if (m_sceneTarget != nullptr) {
+      DynamicResolution::apply(*m_sceneTarget, m_window->getSize());
+    }
+
     // Clear the renderer.
     RenderInterface::clear();
 
@@ -174,6 +261,13 @@ namespace dg
       layer->update();
     }
 
+    // Upscale the 2D scene into the window, so that the GUI is drawn over it.
+    if (m_sceneTarget != nullptr) {
+      FrameBuffer::unbind();
+      RenderInterface::setViewport(m_window->getSize());
+      m_sceneTarget->blitToWindow(0, { 0, 0 }, m_window->getSize());
+    }
+
     if (m_guiContext != nullptr) {
       m_guiContext->begin();
       for (auto layer : *m_layerStack) {
@@ -182,8 +276,14 @@ namespace dg
       m_guiContext->end();
     }
 
-    // Update the window.
-    m_window->update();
+    // Update the window. With a render thread, the frame's commands are handed off to it, to be
+    // carried out and presented while the next frame is updated.
+    if (RenderInterface::isThreaded() == true) {
+      m_window->pollEvents();
+      RenderInterface::getBackend().endFrame();
+    } else {
+      m_window->update();
+    }
 
   }
 
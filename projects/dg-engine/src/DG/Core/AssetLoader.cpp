@@ -0,0 +1,164 @@
+/** @file DG/Core/AssetLoader.cpp */
+
+#include <DG/Core/FileIo.hpp>
+#include <DG/Graphics/ColorPalette.hpp>
+#include <DG/Graphics/Shader.hpp>
+#include <DG/Graphics/Texture.hpp>
+#include <DG/Core/AssetLoader.hpp>
+
+namespace dg
+{
+
+  Scope<ThreadPool> AssetLoader::s_pool = nullptr;
+  Collection<AssetLoader::Job> AssetLoader::s_jobs;
+  AssetLoadProgress AssetLoader::s_progress;
+
+  void AssetLoader::initialize (Count workerCount)
+  {
+    shutdown();
+
+    s_pool = makeScope<ThreadPool>(workerCount);
+    DG_ENGINE_INFO("Asset loader started with {} worker threads.", s_pool->getWorkerCount());
+  }
+
+  void AssetLoader::shutdown ()
+  {
+    // Wait for the running loads to finish before throwing their jobs out, since their finalize
+    // functions may hold the assets they are loading into.
+    s_pool.reset();
+    s_jobs.clear();
+    s_progress = {};
+  }
+
+  void AssetLoader::submit (const String& key, LFunction<Bool> load, LFunction<Bool> finalize)
+  {
+    if (load == nullptr || finalize == nullptr) {
+      throw std::invalid_argument { "Attempted 'submit' of asset load with null function!" };
+    }
+
+    // Start counting afresh if the last batch of loads has finished.
+    if (s_jobs.empty() == true) {
+      s_progress = {};
+    }
+    s_progress.requested++;
+
+    Job job { key, {}, std::move(finalize) };
+    if (s_pool == nullptr) {
+      std::promise<Bool> promise;
+      try {
+        promise.set_value(load());
+      } catch (...) {
+        promise.set_exception(std::current_exception());
+      }
+      job.loaded = promise.get_future();
+      finish(job);
+      return;
+    }
+
+    job.loaded = s_pool->submit(std::move(load));
+    s_jobs.push_back(std::move(job));
+  }
+
+  void AssetLoader::update ()
+  {
+    // Finalizing one job may submit another, so take the finished jobs out first.
+    Collection<Job> finished;
+    for (auto iter = s_jobs.begin(); iter != s_jobs.end(); ) {
+      if (iter->loaded.wait_for(std::chrono::seconds { 0 }) == std::future_status::ready) {
+        finished.push_back(std::move(*iter));
+        iter = s_jobs.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+
+    for (auto& job : finished) {
+      finish(job);
+    }
+  }
+
+  void AssetLoader::wait (const String& key)
+  {
+    auto iter = std::find_if(s_jobs.begin(), s_jobs.end(),
+      [&key] (const Job& job) { return job.key == key; });
+    if (iter == s_jobs.end()) {
+      return;
+    }
+
+    Job job = std::move(*iter);
+    s_jobs.erase(iter);
+    finish(job);
+  }
+
+  void AssetLoader::waitAll ()
+  {
+    while (s_jobs.empty() == false) {
+      Job job = std::move(s_jobs.front());
+      s_jobs.erase(s_jobs.begin());
+      finish(job);
+    }
+  }
+
+  Bool AssetLoader::isLoading (const String& key)
+  {
+    return std::any_of(s_jobs.begin(), s_jobs.end(),
+      [&key] (const Job& job) { return job.key == key; });
+  }
+
+  const AssetLoadProgress& AssetLoader::getProgress ()
+  {
+    return s_progress;
+  }
+
+  Bool AssetLoader::loadManifest (const Path& path)
+  {
+    return FileIo::loadTextFile(
+      path.string(),
+      [&] (StringView line, Index number)
+      {
+        // Trim the line, skipping it if it is blank or a comment.
+        auto first = line.find_first_not_of(" \t\r");
+        if (first == StringView::npos || line[first] == '#') { return true; }
+        line = line.substr(first, line.find_last_not_of(" \t\r") - first + 1);
+
+        auto split = line.find_first_of(" \t");
+        if (split == StringView::npos) {
+          DG_ENGINE_ERROR("Asset manifest '{}', line {}: no filename given.", path.string(),
+            number);
+          return false;
+        }
+
+        StringView type = line.substr(0, split);
+        String filename { line.substr(line.find_first_not_of(" \t", split)) };
+        if (type == "texture")      { TextureManager::loadAsync(filename); }
+        else if (type == "shader")  { ShaderManager::loadAsync(filename); }
+        else if (type == "palette") { ColorPaletteManager::loadAsync(filename); }
+        else {
+          DG_ENGINE_ERROR("Asset manifest '{}', line {}: unknown asset type '{}'.", path.string(),
+            number, type);
+          return false;
+        }
+
+        return true;
+      }
+    );
+  }
+
+  void AssetLoader::finish (Job& job)
+  {
+    Bool result = false;
+    try {
+      result = job.loaded.get() == true && job.finalize() == true;
+    } catch (const std::exception& ex) {
+      DG_ENGINE_ERROR("Exception loading asset '{}': {}", job.key, ex.what());
+    }
+
+    if (result == true) {
+      s_progress.completed++;
+    } else {
+      DG_ENGINE_ERROR("Could not load asset '{}'.", job.key);
+      s_progress.failed++;
+    }
+  }
+
+}
@@ -10,6 +10,15 @@ namespace dg
     return fs::absolute(path).lexically_normal();
   }
 
+  Path FileIo::getRelative (const Path& path)
+  {
+    const Path absolute = getAbsolute(path);
+
+    std::error_code error;
+    const Path relative = fs::relative(absolute, error);
+    return (error || relative.empty() == true) ? absolute : relative;
+  }
+
   Bool FileIo::loadTextFile (const String& filename, const LineFunction& lineFunction)
   {
     if (filename.empty()) {
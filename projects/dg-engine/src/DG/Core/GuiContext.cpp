@@ -5,19 +5,49 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
+#include <DG/Graphics/RenderInterface.hpp>
 #include <DG/Core/Application.hpp>
 #include <DG/Core/GuiContext.hpp>
 
+// Each thread has its own current ImGui context. See `DG_ImGuiConfig.hpp`.
+thread_local ImGuiContext* DgImGuiCurrentContext = nullptr;
+
 namespace dg
 {
 
+  namespace Private
+  {
+
+    static Ref<ImDrawData> cloneDrawData (const ImDrawData* drawData)
+    {
+      // The draw lists are rebuilt every frame, so the render thread needs its own copy of them.
+      Ref<ImDrawData> clone {
+        new ImDrawData { *drawData },
+        [] (ImDrawData* data)
+        {
+          for (ImDrawList* list : data->CmdLists) {
+            IM_DELETE(list);
+          }
+          delete data;
+        }
+      };
+
+      for (ImDrawList*& list : clone->CmdLists) {
+        list = list->CloneOutput();
+      }
+
+      return clone;
+    }
+
+  }
+
   GuiContext::GuiContext (const GuiContextSpecification& spec) :
     m_docking { spec.docking },
     m_viewport { spec.viewport }
   {
     // Set up the Dear ImGui context...
     IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+    m_context = ImGui::CreateContext();
 
     // Set up the ImGui input events...
     auto& io = ImGui::GetIO();
@@ -29,6 +59,13 @@ namespace dg
       io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
     }
 
+    // Platform windows each need their own context made current, which the render thread cannot
+    // do on the main thread's behalf.
+    if (m_viewport == true && RenderInterface::isThreaded() == true) {
+      DG_ENGINE_WARN("GUI viewports are not supported with a render thread; disabling them.");
+      m_viewport = false;
+    }
+
     if (m_viewport == true) {
       io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
     }
@@ -41,14 +78,43 @@ namespace dg
       Application::getWindow().getPointer(), 
       true
     );
-    ImGui_ImplOpenGL3_Init("#version 450 core");
+
+    // With a render thread, the OpenGL backend lives on that thread, in a context of its own which
+    // shares the main context's fonts, so that drawing a frame there never touches the context
+    // which the main thread is building the next frame with. The font texture is built here,
+    // while the main thread waits.
+    if (RenderInterface::isThreaded() == true) {
+      io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+      m_renderContext = ImGui::CreateContext(io.Fonts);
+
+      auto& backend = RenderInterface::getBackend();
+      backend.submit([context = m_renderContext] () {
+        ImGui::SetCurrentContext(context);
+        ImGui_ImplOpenGL3_Init("#version 450 core");
+        ImGui_ImplOpenGL3_NewFrame();
+      });
+      backend.flush();
+    } else {
+      ImGui_ImplOpenGL3_Init("#version 450 core");
+    }
   }
 
   GuiContext::~GuiContext ()
   {
-    ImGui_ImplOpenGL3_Shutdown();
+    if (RenderInterface::isThreaded() == true) {
+      auto& backend = RenderInterface::getBackend();
+      backend.submit([context = m_renderContext] () {
+        ImGui::SetCurrentContext(context);
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui::DestroyContext(context);
+      });
+      backend.flush();
+    } else {
+      ImGui_ImplOpenGL3_Shutdown();
+    }
+
     ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
+    ImGui::DestroyContext(m_context);
   }
 
   Scope<GuiContext> GuiContext::make (const GuiContextSpecification& spec)
@@ -62,7 +128,10 @@ namespace dg
 
   void GuiContext::begin () const
   {
-    ImGui_ImplOpenGL3_NewFrame();
+    if (RenderInterface::isThreaded() == false) {
+      ImGui_ImplOpenGL3_NewFrame();
+    }
+
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
   }
@@ -70,6 +139,29 @@ namespace dg
   void GuiContext::end () const
   {
     ImGui::Render();
+
+    if (RenderInterface::isThreaded() == true) {
+      Ref<ImDrawData> drawData = Private::cloneDrawData(ImGui::GetDrawData());
+      RenderInterface::getBackend().submit([drawData, context = m_renderContext] () {
+        ImGui::SetCurrentContext(context);
+        ImGui_ImplOpenGL3_NewFrame();
+
+        // Texture IDs handed to the GUI are stand-in handles, which must be resolved here.
+        const auto& backend = RenderInterface::getBackend();
+        for (ImDrawList* list : drawData->CmdLists) {
+          for (ImDrawCmd& command : list->CmdBuffer) {
+            auto handle = static_cast<Uint32>(reinterpret_cast<std::uintptr_t>(command.TextureId));
+            command.TextureId = reinterpret_cast<ImTextureID>(
+              static_cast<std::uintptr_t>(backend.resolveHandle(handle))
+            );
+          }
+        }
+
+        ImGui_ImplOpenGL3_RenderDrawData(drawData.get());
+      });
+      return;
+    }
+
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
     if (m_viewport == true) {
@@ -8,15 +8,20 @@ namespace dg
 
   #define DG_WINPTR Application::getWindow().getPointer()
 
+  // Headless windows created without GLFW have no keys, cursor or mouse buttons to report.
+
   Bool Input::isKeyDown (const Key key)
   {
-    return glfwGetKey(DG_WINPTR, static_cast<int>(key)) == GLFW_PRESS;
+    GLFWwindow* window = DG_WINPTR;
+    return window != nullptr && glfwGetKey(window, static_cast<int>(key)) == GLFW_PRESS;
   }
 
   Vector2f Input::getCursorPos ()
   {
     double xpos = 0, ypos = 0;
-    glfwGetCursorPos(DG_WINPTR, &xpos, &ypos);
+    if (GLFWwindow* window = DG_WINPTR; window != nullptr) {
+      glfwGetCursorPos(window, &xpos, &ypos);
+    }
     return {
       static_cast<Float32>(xpos),
       static_cast<Float32>(ypos)
@@ -26,7 +31,9 @@ namespace dg
   Vector2i Input::getCursorIntegerPos ()
   {
     double xpos = 0, ypos = 0;
-    glfwGetCursorPos(DG_WINPTR, &xpos, &ypos);
+    if (GLFWwindow* window = DG_WINPTR; window != nullptr) {
+      glfwGetCursorPos(window, &xpos, &ypos);
+    }
     return {
       static_cast<Int32>(xpos),
       static_cast<Int32>(ypos)
@@ -35,7 +42,9 @@ namespace dg
 
   Bool Input::isMouseButtonDown (const MouseButton button)
   {
-    return glfwGetMouseButton(DG_WINPTR, static_cast<int>(button)) == GLFW_PRESS;
+    GLFWwindow* window = DG_WINPTR;
+    return window != nullptr &&
+      glfwGetMouseButton(window, static_cast<int>(button)) == GLFW_PRESS;
   }
 
   Bool Input::isGamepadConnected (Index index)
@@ -0,0 +1,116 @@
+/** @file DG/Core/MappedFile.cpp */
+
+#if defined(DG_LINUX)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <DG/Core/MappedFile.hpp>
+
+namespace dg
+{
+
+  MappedFile::~MappedFile ()
+  {
+    close();
+  }
+
+  Ref<MappedFile> MappedFile::make (const Path& path)
+  {
+    auto file = makeRef<MappedFile>();
+    if (file->open(path) == false) {
+      return nullptr;
+    }
+
+    return file;
+  }
+
+  Bool MappedFile::open (const Path& path)
+  {
+    close();
+
+    #if defined(DG_LINUX)
+
+      int descriptor = ::open(path.c_str(), O_RDONLY);
+      if (descriptor < 0) {
+        DG_ENGINE_ERROR("Could not open file '{}' for mapping.", path.string());
+        return false;
+      }
+
+      struct stat status;
+      if (fstat(descriptor, &status) != 0) {
+        DG_ENGINE_ERROR("Could not read the size of file '{}'.", path.string());
+        ::close(descriptor);
+        return false;
+      }
+
+      // Empty files cannot be mapped, but are still valid.
+      m_size = static_cast<Size>(status.st_size);
+      if (m_size > 0) {
+        void* address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address == MAP_FAILED) {
+          DG_ENGINE_ERROR("Could not map file '{}'.", path.string());
+          ::close(descriptor);
+          m_size = 0;
+          return false;
+        }
+
+        // The whole file is about to be read, so have the operating system start reading it in.
+        madvise(address, m_size, MADV_WILLNEED);
+        m_data = static_cast<const Uint8*>(address);
+      }
+
+      // The mapping keeps its own reference to the file.
+      ::close(descriptor);
+      m_open = true;
+      return true;
+
+    #else
+
+      std::fstream file { path, std::ios::in | std::ios::binary };
+      if (file.is_open() == false) {
+        DG_ENGINE_ERROR("Could not open file '{}' for reading.", path.string());
+        return false;
+      }
+
+      m_buffer.assign(std::istreambuf_iterator<char> { file }, {});
+      m_data = m_buffer.data();
+      m_size = m_buffer.size();
+      m_open = true;
+      return true;
+
+    #endif
+  }
+
+  void MappedFile::close ()
+  {
+    #if defined(DG_LINUX)
+      if (m_data != nullptr) {
+        munmap(const_cast<Uint8*>(m_data), m_size);
+      }
+    #endif
+
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+  }
+
+  const Uint8* MappedFile::getData () const
+  {
+    return m_data;
+  }
+
+  Size MappedFile::getSize () const
+  {
+    return m_size;
+  }
+
+  Bool MappedFile::isOpen () const
+  {
+    return m_open;
+  }
+
+}
@@ -0,0 +1,79 @@
+/** @file DG/Core/ThreadPool.cpp */
+
+#include <DG/Core/ThreadPool.hpp>
+
+namespace dg
+{
+
+  ThreadPool::ThreadPool (Count workerCount)
+  {
+    if (workerCount == 0) {
+      Count hardwareCount = std::thread::hardware_concurrency();
+      workerCount = (hardwareCount > 1) ? hardwareCount - 1 : 1;
+    }
+
+    m_workers.reserve(workerCount);
+    for (Index i = 0; i < workerCount; ++i) {
+      m_workers.emplace_back([this] () { run(); });
+    }
+  }
+
+  ThreadPool::~ThreadPool ()
+  {
+    {
+      std::lock_guard lock { m_mutex };
+      m_stopping = true;
+      m_tasks.clear();
+    }
+
+    m_condition.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  Count ThreadPool::getWorkerCount () const
+  {
+    return m_workers.size();
+  }
+
+  Count ThreadPool::getQueuedCount () const
+  {
+    std::lock_guard lock { m_mutex };
+    return m_tasks.size();
+  }
+
+  void ThreadPool::enqueue (LFunction<void> task)
+  {
+    {
+      std::lock_guard lock { m_mutex };
+      if (m_stopping == true) {
+        throw std::runtime_error { "Attempted 'submit' to stopped thread pool!" };
+      }
+
+      m_tasks.push_back(std::move(task));
+    }
+
+    m_condition.notify_one();
+  }
+
+  void ThreadPool::run ()
+  {
+    while (true) {
+      LFunction<void> task;
+
+      {
+        std::unique_lock lock { m_mutex };
+        m_condition.wait(lock, [this] () { return m_stopping == true || m_tasks.empty() == false; });
+        if (m_stopping == true) { return; }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+
+      // Packaged tasks hand any exception to their future.
+      task();
+    }
+  }
+
+}
@@ -1,5 +1,10 @@
 /** @file DG/Core/Window.cpp */
 
+#if defined(DG_LINUX)
+  #include <EGL/egl.h>
+  #include <EGL/eglext.h>
+#endif
+
 #include <DG/Events/EventListener.hpp>
 #include <DG/Core/Window.hpp>
 
@@ -123,14 +128,128 @@ namespace dg
       DG_GET_WIN->emitEvent<ScrollInputEvent>(yoffset, xoffset);
     }
 
+    /**
+     * @brief Resolves the given @a `WindowContextApi` to the proper GLFW context creation API hint.
+     * 
+     * @param api The context API to resolve.
+     * 
+     * @return  The resolved GLFW hint value. 
+     */
+    static int resolveContextApi (WindowContextApi api)
+    {
+      switch (api) {
+        case WindowContextApi::Egl:     return GLFW_EGL_CONTEXT_API;
+        case WindowContextApi::OsMesa:  return GLFW_OSMESA_CONTEXT_API;
+        default:                        return GLFW_NATIVE_CONTEXT_API;
+      }
+    }
+
+  #if defined(DG_LINUX)
+
+    /**
+     * @brief Creates an OpenGL core context through EGL, on Mesa's surfaceless platform, and makes
+     *        it current. The surfaceless platform needs neither a display server nor a surface,
+     *        which GLFW 3.3 cannot do without; it connects to X even for EGL contexts.
+     *
+     * @param display Receives the EGL display, or @a `EGL_NO_DISPLAY` on failure.
+     * @param context Receives the EGL context, or @a `EGL_NO_CONTEXT` on failure.
+     *
+     * @return  @a `true` if the context was created and made current; @a `false` otherwise.
+     */
+    static Bool createSurfacelessContext (EGLDisplay& display, EGLContext& context)
+    {
+      display = EGL_NO_DISPLAY;
+      context = EGL_NO_CONTEXT;
+
+      auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+      if (getPlatformDisplay == nullptr) {
+        return false;
+      }
+
+      EGLDisplay surfaceless = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+        EGL_DEFAULT_DISPLAY, nullptr);
+      if (
+        surfaceless == EGL_NO_DISPLAY ||
+        eglInitialize(surfaceless, nullptr, nullptr) == EGL_FALSE
+      ) {
+        return false;
+      }
+
+      // The context is never drawn to directly, so it needs no configuration if none is offered.
+      const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+      EGLConfig config = nullptr;
+      EGLint configCount = 0;
+      if (
+        eglBindAPI(EGL_OPENGL_API) == EGL_FALSE ||
+        eglChooseConfig(surfaceless, configAttributes, &config, 1, &configCount) == EGL_FALSE
+      ) {
+        eglTerminate(surfaceless);
+        return false;
+      }
+
+      // Mesa's software rasterizer (llvmpipe) may only expose an OpenGL 4.5 core context.
+      for (EGLint minor : { 6, 5 }) {
+        const EGLint contextAttributes[] = {
+          EGL_CONTEXT_MAJOR_VERSION, 4,
+          EGL_CONTEXT_MINOR_VERSION, minor,
+          EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+          EGL_NONE
+        };
+
+        context = eglCreateContext(surfaceless, (configCount > 0) ? config : nullptr,
+          EGL_NO_CONTEXT, contextAttributes);
+        if (context != EGL_NO_CONTEXT) {
+          break;
+        }
+      }
+
+      if (
+        context == EGL_NO_CONTEXT ||
+        eglMakeCurrent(surfaceless, EGL_NO_SURFACE, EGL_NO_SURFACE, context) == EGL_FALSE
+      ) {
+        if (context != EGL_NO_CONTEXT) {
+          eglDestroyContext(surfaceless, context);
+          context = EGL_NO_CONTEXT;
+        }
+        eglTerminate(surfaceless);
+        return false;
+      }
+
+      display = surfaceless;
+      return true;
+    }
+
+  #endif
+
   }
 
   Window::Window (const WindowSpecification& spec) :
     m_title         { spec.title },
     m_size          { spec.size },
-    m_vertical_sync { spec.vertical_sync }
+    m_vertical_sync { spec.vertical_sync },
+    m_headless      { spec.headless }
   {
 
+    // Mesa reads this variable when the context is created, so it needs to be set before the
+    // driver is loaded. A value the user has set already is left alone.
+    #if defined(DG_LINUX)
+      if (spec.softwareRendering == true) {
+        setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+      }
+
+      // Headless EGL contexts are created without GLFW where possible, so that no display server
+      // is needed. Such windows have no GLFW window, and so raise no input events.
+      if (m_headless == true && spec.contextApi == WindowContextApi::Egl) {
+        if (Private::createSurfacelessContext(m_eglDisplay, m_eglContext) == true) {
+          return;
+        }
+
+        DG_ENGINE_WARN("Could not create a surfaceless EGL context. Falling back to GLFW, which "
+          "needs a display server.");
+      }
+    #endif
+
     // If there are no windows currently open, then we can assume that GLFW has not been
     // initialized.
     if (Private::s_windowCount == 0) {
@@ -153,15 +272,31 @@ namespace dg
 
     }
 
+    // Headless windows are never shown. Their context may also be created through EGL or OSMesa
+    // so that no display server is needed to render.
+    glfwWindowHint(GLFW_VISIBLE, m_headless == true ? GLFW_FALSE : GLFW_TRUE);
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, Private::resolveContextApi(spec.contextApi));
+
     // Create and set up the window.
     m_glfwWindow = glfwCreateWindow(static_cast<int>(m_size.x), static_cast<int>(m_size.y),
       m_title.c_str(), nullptr, nullptr);
+
+    // Mesa's software rasterizer (llvmpipe) may only expose an OpenGL 4.5 core context, so try
+    // again with that version before giving up.
+    if (m_glfwWindow == nullptr) {
+      DG_ENGINE_WARN("Could not create an OpenGL 4.6 context. Retrying with OpenGL 4.5.");
+      glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+      m_glfwWindow = glfwCreateWindow(static_cast<int>(m_size.x), static_cast<int>(m_size.y),
+        m_title.c_str(), nullptr, nullptr);
+      glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    }
+
     if (m_glfwWindow == nullptr) {
       throw std::runtime_error { "Error creating GLFW window!" };
     } else {
       glfwMakeContextCurrent(m_glfwWindow);
       glfwSetWindowUserPointer(m_glfwWindow, this);
-      glfwSwapInterval(m_vertical_sync == true ? 1 : 0);
+      glfwSwapInterval(m_vertical_sync == true && m_headless == false ? 1 : 0);
     }
 
     // Set the window's input callbacks.
@@ -179,6 +314,15 @@ namespace dg
 
   Window::~Window ()
   {
+    #if defined(DG_LINUX)
+      if (m_eglContext != nullptr) {
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(m_eglDisplay, m_eglContext);
+        eglTerminate(m_eglDisplay);
+        return;
+      }
+    #endif
+
     // Destroy the window.
     if (m_glfwWindow != nullptr) {
       glfwSetWindowUserPointer(m_glfwWindow, nullptr);
@@ -198,8 +342,47 @@ namespace dg
 
   void Window::update () const
   {
-    glfwPollEvents();
-    glfwSwapBuffers(m_glfwWindow);
+    pollEvents();
+    present();
+  }
+
+  void Window::pollEvents () const
+  {
+    if (m_glfwWindow != nullptr) {
+      glfwPollEvents();
+    }
+  }
+
+  void Window::present () const
+  {
+    // Headless windows render into an off-screen frame buffer, so there is nothing to present.
+    if (m_headless == false) {
+      glfwSwapBuffers(m_glfwWindow);
+    }
+  }
+
+  void Window::makeContextCurrent () const
+  {
+    #if defined(DG_LINUX)
+      if (m_eglContext != nullptr) {
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_eglContext);
+        return;
+      }
+    #endif
+
+    glfwMakeContextCurrent(m_glfwWindow);
+  }
+
+  void Window::releaseContext () const
+  {
+    #if defined(DG_LINUX)
+      if (m_eglContext != nullptr) {
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        return;
+      }
+    #endif
+
+    glfwMakeContextCurrent(nullptr);
   }
 
   GLFWwindow* Window::getPointer () const
@@ -207,4 +390,14 @@ namespace dg
     return m_glfwWindow;
   }
 
+  const Vector2u& Window::getSize () const
+  {
+    return m_size;
+  }
+
+  Bool Window::isHeadless () const
+  {
+    return m_headless;
+  }
+
 }
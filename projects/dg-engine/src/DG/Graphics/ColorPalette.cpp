@@ -1,5 +1,6 @@
 /** @file DG/Graphics/ColorPalette.cpp */
 
+#include <DG/Core/AssetLoader.hpp>
 #include <DG/Core/FileIo.hpp>
 #include <DG/Core/FileLexer.hpp>
 #include <DG/Graphics/ColorPalette.hpp>
@@ -246,13 +247,26 @@ namespace dg
       throw std::invalid_argument { "Attempted 'getOrEmplace' with a blank filename string!" };
     }
 
-    // Check to see if the palette asset is present. If so, then return it.
+    // Check to see if the palette asset is present. If so, then return it, first finishing its
+    // load if it is still loading in the background.
     auto iter = s_assets.find(filename);
-    if (iter != s_assets.end()) { return iter->second; }
+    if (iter != s_assets.end()) {
+      if (AssetLoader::isLoading(filename) == false) { return iter->second; }
+
+      Ref<ColorPalette> palette = iter->second;
+      AssetLoader::wait(filename);
+      if (palette->isEmpty() == true) {
+        s_assets.erase(filename);
+        DG_ENGINE_CRIT("Could not load palette asset file '{}'!", filename);
+        throw std::runtime_error { "Could not load palette asset file!" };
+      }
+
+      return palette;
+    }
 
     // Create the palette. Ensure that it is valid.
     Ref<ColorPalette> palette = ColorPalette::make(FileIo::getAbsolute(filename));
-    if (palette->isEmpty() == false) {
+    if (palette->isEmpty() == true) {
       DG_ENGINE_CRIT("Could not load palette asset file '{}'!", filename);
       throw std::runtime_error { "Could not load palette asset file!" };
     }
@@ -262,6 +276,38 @@ namespace dg
     return palette;
   }
 
+  Ref<ColorPalette> ColorPaletteManager::loadAsync (const String& filename)
+  {
+    // Ensure that the relative filename string is provided.
+    if (filename.empty()) {
+      throw std::invalid_argument { "Attempted 'loadAsync' with a blank filename string!" };
+    }
+
+    // Check to see if the palette asset is present. If so, then return it.
+    auto iter = s_assets.find(filename);
+    if (iter != s_assets.end()) { return iter->second; }
+
+    // Map an empty palette now. The file is parsed into a separate palette on a worker thread,
+    // whose colors are moved into the mapped palette on the main thread.
+    Ref<ColorPalette> palette = ColorPalette::make();
+    Ref<ColorPalette> loaded = ColorPalette::make();
+    AssetLoader::submit(
+      filename,
+      [loaded, path = FileIo::getAbsolute(filename)] ()
+      {
+        return loaded->loadFromFile(path);
+      },
+      [palette, loaded] ()
+      {
+        *palette = std::move(*loaded);
+        return palette->isEmpty() == false;
+      }
+    );
+
+    s_assets.emplace(filename, palette);
+    return palette;
+  }
+
   Boolean ColorPaletteManager::contains (const String& filename)
   {
     // Ensure that the relative filename string is provided.
@@ -0,0 +1,182 @@
+/** @file DG/Graphics/DynamicResolution.cpp */
+
+#include <DG/Graphics/DynamicResolution.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // The number of timer queries which may be in flight at once. If the backend falls this far
+    // behind, scenes go unmeasured until it catches up.
+    static constexpr Count MAX_TIMINGS = 8;
+
+    // The number of nanoseconds in a second.
+    static constexpr Float32 NANOSECONDS = 1.0e9f;
+
+  }
+
+  DynamicResolutionSpecification DynamicResolution::s_spec;
+  DynamicResolutionStats DynamicResolution::s_stats;
+  std::deque<DynamicResolution::Timing> DynamicResolution::s_timings;
+  Clock DynamicResolution::s_clock;
+  Index DynamicResolution::s_frame = 0;
+  Index DynamicResolution::s_sampleFrame = 0;
+  Float32 DynamicResolution::s_sampleTime = 0.0f;
+  Count DynamicResolution::s_settleFrames = 0;
+  Bool DynamicResolution::s_measuring = false;
+
+  void DynamicResolution::initialize (const DynamicResolutionSpecification& spec)
+  {
+    shutdown();
+
+    s_spec = spec;
+    s_spec.minScale = std::clamp(spec.minScale, 0.0f, 1.0f);
+    s_spec.maxScale = std::clamp(spec.maxScale, s_spec.minScale, 1.0f);
+    s_stats.scale = s_spec.maxScale;
+    s_clock.restart();
+  }
+
+  void DynamicResolution::shutdown ()
+  {
+    // Results still in flight are of no use now, so their queries are destroyed unread.
+    if (s_timings.empty() == false) {
+      auto& backend = RenderInterface::getBackend();
+      if (s_measuring == true) {
+        backend.endTimerQuery();
+      }
+
+      for (const auto& timing : s_timings) {
+        backend.destroyTimerQuery(timing.handle);
+      }
+      s_timings.clear();
+    }
+
+    s_spec = {};
+    s_stats = {};
+    s_frame = 0;
+    s_sampleFrame = 0;
+    s_sampleTime = 0.0f;
+    s_settleFrames = 0;
+    s_measuring = false;
+  }
+
+  void DynamicResolution::beginTiming ()
+  {
+    if (s_spec.enabled == false || s_timings.size() >= Private::MAX_TIMINGS) {
+      return;
+    }
+
+    s_timings.push_back({ RenderInterface::getBackend().beginTimerQuery(), s_frame });
+    s_measuring = true;
+  }
+
+  void DynamicResolution::endTiming ()
+  {
+    if (s_measuring == false) {
+      return;
+    }
+
+    RenderInterface::getBackend().endTimerQuery();
+    s_measuring = false;
+  }
+
+  void DynamicResolution::update ()
+  {
+    smooth(s_stats.frameTime, s_clock.restart());
+    s_frame++;
+    if (s_spec.enabled == false) {
+      return;
+    }
+
+    // Add up the time taken by each frame's scenes. A frame's total is known once a query from a
+    // later frame has finished.
+    auto& backend = RenderInterface::getBackend();
+    while (s_timings.empty() == false) {
+      const Timing timing = s_timings.front();
+      Uint64 nanoseconds = 0;
+      QueryStatus status = backend.pollTimerQuery(timing.handle, nanoseconds);
+      if (status == QueryStatus::Pending) {
+        break;
+      }
+
+      s_timings.pop_front();
+      if (status == QueryStatus::Failed) {
+        continue;
+      }
+
+      if (timing.frame != s_sampleFrame) {
+        if (s_sampleTime > 0.0f) {
+          smooth(s_stats.gpuTime, s_sampleTime);
+        }
+        s_sampleFrame = timing.frame;
+        s_sampleTime = 0.0f;
+      }
+      s_sampleTime += nanoseconds / Private::NANOSECONDS;
+    }
+
+    if (s_settleFrames > 0) {
+      s_settleFrames--;
+      return;
+    }
+
+    const Float32 time = (s_stats.gpuTime > 0.0f) ? s_stats.gpuTime : s_stats.frameTime;
+    if (time <= 0.0f) {
+      return;
+    }
+
+    // The time taken grows with the number of pixels drawn, which is the square of the scale.
+    const Float32 target = s_spec.frameBudget * (1.0f - s_spec.headroom);
+    const Float32 step = std::max(s_spec.scaleStep, 0.01f);
+    Float32 scale = s_stats.scale;
+    if (time > s_spec.frameBudget) {
+      const Float32 wanted = s_stats.scale * std::sqrt(target / time);
+      scale = std::min(s_stats.scale - step, std::floor(wanted / step) * step);
+    } else {
+      const Float32 growth = (s_stats.scale + step) / s_stats.scale;
+      if (time * growth * growth < target) {
+        scale = s_stats.scale + step;
+      }
+    }
+
+    scale = std::clamp(scale, s_spec.minScale, s_spec.maxScale);
+    if (scale != s_stats.scale) {
+      s_stats.scale = scale;
+      s_stats.changeCount++;
+      s_settleFrames = s_spec.settleFrames;
+    }
+  }
+
+  Bool DynamicResolution::apply (FrameBuffer& target, const Vector2u& outputSize)
+  {
+    return target.setSize(getScaledSize(outputSize));
+  }
+
+  Vector2u DynamicResolution::getScaledSize (const Vector2u& outputSize)
+  {
+    return glm::max(Vector2u { glm::round(Vector2f { outputSize } * s_stats.scale) },
+      Vector2u { 1, 1 });
+  }
+
+  Float32 DynamicResolution::getScale ()
+  {
+    return s_stats.scale;
+  }
+
+  const DynamicResolutionStats& DynamicResolution::getStats ()
+  {
+    return s_stats;
+  }
+
+  void DynamicResolution::smooth (Float32& smoothed, Float32 measured)
+  {
+    if (smoothed <= 0.0f) {
+      smoothed = measured;
+    } else {
+      smoothed += (measured - smoothed) * std::clamp(s_spec.smoothing, 0.0f, 1.0f);
+    }
+  }
+
+}
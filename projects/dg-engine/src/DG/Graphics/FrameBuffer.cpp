@@ -65,77 +65,73 @@ namespace dg
 
     static void generateTextures (Uint32* handles, const Count count)
     {
-      glGenTextures(count, handles);
+      for (Index i = 0; i < count; ++i) {
+        handles[i] = RenderInterface::getBackend().createTexture();
+      }
+    }
+
+    static void destroyTextures (const Uint32* handles, const Count count)
+    {
+      for (Index i = 0; i < count; ++i) {
+        if (handles[i] != 0) {
+          RenderInterface::getBackend().destroyTexture(handles[i]);
+        }
+      }
     }
 
     static void bindTexture (Bool isMultisampled, Uint32 handle)
     {
-      glBindTexture(resolveTextureTarget(isMultisampled), handle);
+      RenderInterface::getBackend().bindTexture(resolveTextureTarget(isMultisampled), handle);
     }
 
-    static void attachColorTexture (Uint32 handle, const FrameBufferSpecification& framebufferSpec,
-      const FrameBufferTextureSpecification& textureSpec, const Index index)
+    static void allocateTexture (Uint32 handle, const FrameBufferSpecification& framebufferSpec,
+      const FrameBufferTextureSpecification& textureSpec, const Vector2u& capacity)
     {
 
       // Deduce the proper GL type enums from the texture format.
       GLenum internalFormat = 0, pixelFormat = 0, dataType = 0;
       resolveTextureFormat(textureSpec.textureFormat, internalFormat, pixelFormat, dataType);
 
-      // Determine if the frame buffer is multisampled.
-      Bool isMultisampled = framebufferSpec.sampleCount > 1;
-
       // Create the texture according to the number of samples.
-      if (isMultisampled == true) {
-        glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, framebufferSpec.sampleCount, 
-          internalFormat, framebufferSpec.size.x, framebufferSpec.size.y, GL_FALSE);
+      auto& backend = RenderInterface::getBackend();
+      if (framebufferSpec.sampleCount > 1) {
+        backend.allocateTexture2DMultisample(handle, framebufferSpec.sampleCount, internalFormat,
+          capacity);
       } else {
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, framebufferSpec.size.x, 
-          framebufferSpec.size.y, 0, pixelFormat, dataType, nullptr);
+        backend.allocateTexture2D(handle, internalFormat, capacity, pixelFormat, dataType,
+          nullptr);
 
         // Set the texture's filtering and wrapping parameters.
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
       }
 
-      // Attach the color texture.
-      glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, 
-        resolveTextureTarget(isMultisampled), handle, 0);
-
     }
 
-    static void attachDepthTexture (Uint32 handle, const FrameBufferSpecification& framebufferSpec,
-      const FrameBufferTextureSpecification& textureSpec)
+    static void attachColorTexture (Uint32 handle, const FrameBufferSpecification& framebufferSpec,
+      const FrameBufferTextureSpecification& textureSpec, const Vector2u& capacity,
+      const Index index)
     {
 
-      // Deduce the proper GL type enums from the texture format.
-      GLenum internalFormat = 0, pixelFormat = 0, dataType = 0;
-      resolveTextureFormat(textureSpec.textureFormat, internalFormat, pixelFormat, dataType);
+      // Create, then attach, the color texture.
+      allocateTexture(handle, framebufferSpec, textureSpec, capacity);
+      RenderInterface::getBackend().attachFramebufferTexture(GL_COLOR_ATTACHMENT0 + index,
+        resolveTextureTarget(framebufferSpec.sampleCount > 1), handle);
 
-      // Determine if the frame buffer is multisampled.
-      Bool isMultisampled = framebufferSpec.sampleCount > 1;
-
-      // Create the texture according to the number of samples.
-      if (isMultisampled == true) {
-        glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, framebufferSpec.sampleCount, 
-          internalFormat, framebufferSpec.size.x, framebufferSpec.size.y, GL_FALSE);
-      } else {
-        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, framebufferSpec.size.x, 
-          framebufferSpec.size.y, 0, pixelFormat, dataType, nullptr);
+    }
 
-        // Set the texture's filtering and wrapping parameters.
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-      }
+    static void attachDepthTexture (Uint32 handle, const FrameBufferSpecification& framebufferSpec,
+      const FrameBufferTextureSpecification& textureSpec, const Vector2u& capacity)
+    {
 
-      // Attach the depth texture.
-      glFramebufferTexture2D(GL_FRAMEBUFFER, resolveAttachPoint(textureSpec.textureFormat), 
-        resolveTextureTarget(isMultisampled), handle, 0);
+      // Create, then attach, the depth texture.
+      allocateTexture(handle, framebufferSpec, textureSpec, capacity);
+      RenderInterface::getBackend().attachFramebufferTexture(
+        resolveAttachPoint(textureSpec.textureFormat),
+        resolveTextureTarget(framebufferSpec.sampleCount > 1), handle);
 
     }
 
@@ -156,7 +152,8 @@ namespace dg
 
   /** Frame Buffer Class **************************************************************************/
 
-  FrameBuffer::FrameBuffer (const FrameBufferSpecification& spec)
+  FrameBuffer::FrameBuffer (const FrameBufferSpecification& spec) :
+    m_spec { spec }
   {
     // Sort out the framebuffer's attachment texture formats.
     for (const auto& attachment : m_spec.attachmentSpec.attachments) {
@@ -172,9 +169,9 @@ namespace dg
 
   FrameBuffer::~FrameBuffer ()
   {
-    glDeleteFramebuffers(1, &m_handle);
-    glDeleteTextures(m_colorHandles.size(), m_colorHandles.data());
-    glDeleteTextures(1, &m_depthHandle);
+    RenderInterface::getBackend().destroyFramebuffer(m_handle);
+    Private::destroyTextures(m_colorHandles.data(), m_colorHandles.size());
+    Private::destroyTextures(&m_depthHandle, 1);
 
     m_colorHandles.clear();
     m_depthHandle = 0;
@@ -189,22 +186,90 @@ namespace dg
   void FrameBuffer::bind (const FrameBufferTarget target) const
   {
     if (target == FrameBufferTarget::Drawing || target == FrameBufferTarget::Both) {
-      glBindFramebuffer(target == FrameBufferTarget::Both ? GL_FRAMEBUFFER : GL_DRAW_FRAMEBUFFER,
-        m_handle);
+      RenderInterface::getBackend().bindFramebuffer(
+        target == FrameBufferTarget::Both ? GL_FRAMEBUFFER : GL_DRAW_FRAMEBUFFER, m_handle);
       
       RenderInterface::setViewport(m_spec.size);
       RenderInterface::clear();
     } else {
-      glBindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+      RenderInterface::getBackend().bindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+    }
+  }
+
+  void FrameBuffer::beginPass (const RenderPassDescriptor& pass)
+  {
+    // Bind without the clear which `bind` makes, since the pass decides what is cleared.
+    auto& backend = RenderInterface::getBackend();
+    backend.bindFramebuffer(GL_DRAW_FRAMEBUFFER, m_handle);
+    RenderInterface::setViewport(m_spec.size);
+
+    // Clear the attachments which ask for it, one at a time, each with a value suited to its
+    // format. Those whose contents are not needed are invalidated together.
+    GLenum invalidated[FRAMEBUFFER_COLOR_ATTACHMENT_COUNT + 1];
+    Count invalidatedCount = 0;
+
+    for (Index i = 0; i < m_colorHandles.size(); ++i) {
+      RenderPassColorAttachment attachment;
+      if (i < pass.colorAttachments.size()) {
+        attachment = pass.colorAttachments[i];
+      } else {
+        attachment.clearColor = RenderInterface::getClearColor();
+      }
+
+      if (attachment.load == RenderPassLoadOp::DontCare) {
+        invalidated[invalidatedCount++] = GL_COLOR_ATTACHMENT0 + i;
+      } else if (attachment.load == RenderPassLoadOp::Clear) {
+        if (m_colorAttachmentSpecs[i].textureFormat == FrameBufferTextureFormat::ColorR32) {
+          backend.clearFramebufferInteger(m_handle, i, Vector4i { attachment.clearInteger });
+        } else {
+          backend.clearFramebufferColor(m_handle, i, attachment.clearColor);
+        }
+      }
+    }
+
+    if (m_depthHandle != 0) {
+      const auto& attachment = pass.depthAttachment;
+      if (attachment.load == RenderPassLoadOp::DontCare) {
+        invalidated[invalidatedCount++] = GL_DEPTH_STENCIL_ATTACHMENT;
+      } else if (attachment.load == RenderPassLoadOp::Clear) {
+        backend.clearFramebufferDepthStencil(m_handle, attachment.clearDepth,
+          attachment.clearStencil);
+      }
+    }
+
+    if (invalidatedCount > 0) {
+      backend.invalidateFramebuffer(m_handle, invalidated, invalidatedCount);
+    }
+  }
+
+  void FrameBuffer::endPass (const RenderPassDescriptor& pass)
+  {
+    GLenum invalidated[FRAMEBUFFER_COLOR_ATTACHMENT_COUNT + 1];
+    Count invalidatedCount = 0;
+
+    for (Index i = 0; i < m_colorHandles.size() && i < pass.colorAttachments.size(); ++i) {
+      if (pass.colorAttachments[i].store == RenderPassStoreOp::Discard) {
+        invalidated[invalidatedCount++] = GL_COLOR_ATTACHMENT0 + i;
+      }
+    }
+
+    if (m_depthHandle != 0 && pass.depthAttachment.store == RenderPassStoreOp::Discard) {
+      invalidated[invalidatedCount++] = GL_DEPTH_STENCIL_ATTACHMENT;
+    }
+
+    if (invalidatedCount > 0) {
+      RenderInterface::getBackend().invalidateFramebuffer(m_handle, invalidated,
+        invalidatedCount);
     }
   }
 
   void FrameBuffer::unbind (const FrameBufferTarget target)
   {
+    auto& backend = RenderInterface::getBackend();
     switch (target) {
-      case FrameBufferTarget::Reading: glBindFramebuffer(GL_READ_FRAMEBUFFER, 0); break;
-      case FrameBufferTarget::Drawing: glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); break;
-      case FrameBufferTarget::Both:    glBindFramebuffer(GL_FRAMEBUFFER, 0); break;
+      case FrameBufferTarget::Reading: backend.bindFramebuffer(GL_READ_FRAMEBUFFER, 0); break;
+      case FrameBufferTarget::Drawing: backend.bindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); break;
+      case FrameBufferTarget::Both:    backend.bindFramebuffer(GL_FRAMEBUFFER, 0); break;
     }
   }
 
@@ -220,7 +285,8 @@ namespace dg
     GLenum internalFormat = 0, pixelFormat = 0, dataType = 0;
     Private::resolveTextureFormat(spec.textureFormat, internalFormat, pixelFormat, dataType);
 
-    glClearTexImage(m_colorHandles[index], 0, pixelFormat, dataType, &clearData);
+    RenderInterface::getBackend().clearTexture(m_colorHandles[index], pixelFormat, dataType,
+      &clearData);
   }
 
   Int32 FrameBuffer::readPixel (const Index index, Int32 x, Int32 y)
@@ -243,17 +309,18 @@ namespace dg
       pixelFormat, pixelDataType);
 
     // Set this framebuffer as the active `GL_READ_FRAMEBUFFER`.
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+    auto& backend = RenderInterface::getBackend();
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
 
     // Read the requested color attachment.
-    glReadBuffer(GL_COLOR_ATTACHMENT0 + index);
+    backend.setReadBuffer(GL_COLOR_ATTACHMENT0 + index);
 
     // Read in the pixel data.
     Int32 pixelData = 0;
-    glReadPixels(x, y, 1, 1, pixelFormat, pixelDataType, &pixelData);
+    backend.readPixels({ x, y }, { 1, 1 }, pixelFormat, pixelDataType, &pixelData);
     
     // Un-set the read framebuffer.
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
 
     return pixelData;
   }
@@ -263,6 +330,102 @@ namespace dg
     return readPixel(index, static_cast<Int32>(x), static_cast<Int32>(y));
   }
 
+  Ref<PixelReadback> FrameBuffer::readPixelAsync (const Index index, Int32 x, Int32 y,
+    const PixelReadbackCallback& callback)
+  {
+    return readPixelsAsync(index, { x, y }, { 1, 1 }, callback);
+  }
+
+  Ref<PixelReadback> FrameBuffer::readPixelsAsync (const Index index, const Vector2i& position,
+    const Vector2u& size, const PixelReadbackCallback& callback)
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_CRIT("GL Framebuffer color attachment index {} is out of range!", index);
+      throw std::out_of_range { 
+        "Attempt to read pixels from framebuffer at attachment index out of range!" 
+      };
+    }
+
+    // Clip the rectangle to the framebuffer. If nothing is left, the readback is ready right away.
+    Vector2i minimum = glm::max(position, Vector2i { 0, 0 });
+    Vector2i maximum = glm::min(position + Vector2i { size }, Vector2i { m_spec.size });
+    Ref<PixelReadback> readback = nullptr;
+    if (minimum.x >= maximum.x || minimum.y >= maximum.y) {
+      readback = makeRef<PixelReadback>(minimum, Vector2u { 0, 0 }, 0);
+    } else {
+
+      // We will need the pixel format and data type.
+      GLenum pixelFormat = 0, pixelDataType = 0, unusedInternalFormat = 0;
+      Private::resolveTextureFormat(m_colorAttachmentSpecs[index].textureFormat,
+        unusedInternalFormat, pixelFormat, pixelDataType);
+
+      // Queue up the transfer from the requested color attachment.
+      const Vector2u clippedSize { maximum - minimum };
+      auto& backend = RenderInterface::getBackend();
+      backend.bindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+      backend.setReadBuffer(GL_COLOR_ATTACHMENT0 + index);
+      Uint32 handle = backend.beginReadback(minimum, clippedSize, pixelFormat, pixelDataType);
+      backend.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+      readback = makeRef<PixelReadback>(minimum, clippedSize, handle);
+
+    }
+
+    if (callback != nullptr) {
+      PixelReadback::watch(readback, callback);
+    }
+
+    return readback;
+  }
+
+  void FrameBuffer::readColorAttachment (const Index index, Collection<Uint8>& pixels)
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_CRIT("GL Framebuffer color attachment index {} is out of range!", index);
+      throw std::out_of_range { 
+        "Attempt to read pixels from framebuffer at attachment index out of range!" 
+      };
+    }
+
+    // We will need the pixel format and data type. Both of the supported color formats use four
+    // bytes per pixel.
+    GLenum pixelFormat = 0, pixelDataType = 0, unusedInternalFormat = 0;
+    Private::resolveTextureFormat(m_colorAttachmentSpecs[index].textureFormat, unusedInternalFormat,
+      pixelFormat, pixelDataType);
+    pixels.resize(static_cast<Size>(m_spec.size.x) * m_spec.size.y * 4);
+
+    // Read the whole color attachment in one transfer.
+    auto& backend = RenderInterface::getBackend();
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, m_handle);
+    backend.setReadBuffer(GL_COLOR_ATTACHMENT0 + index);
+    backend.setPixelStore(GL_PACK_ALIGNMENT, 1);
+    backend.readPixels({ 0, 0 }, m_spec.size, pixelFormat, pixelDataType, pixels.data());
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+  }
+
+  void FrameBuffer::blit (const Index index, FrameBuffer& destination,
+    const Index destinationIndex, const Bool linear) const
+  {
+    if (destinationIndex >= destination.m_colorHandles.size()) {
+      DG_ENGINE_CRIT("GL Framebuffer color attachment index {} is out of range!", destinationIndex);
+      throw std::out_of_range { "Attempt to blit into framebuffer at index out of range!" };
+    }
+
+    blitInto(index, destination.m_handle, destinationIndex, { 0, 0 }, destination.m_spec.size,
+      linear);
+  }
+
+  void FrameBuffer::blitToWindow (const Index index, const Vector2i& position,
+    const Vector2u& size, const Bool linear) const
+  {
+    blitInto(index, 0, 0, position, size, linear);
+  }
+
+  Uint32 FrameBuffer::getHandle () const
+  {
+    return m_handle;
+  }
+
   Uint32 FrameBuffer::getColorHandle (const Index index) const
   {
     if (index >= m_colorHandles.size()) {
@@ -288,26 +451,53 @@ namespace dg
     return (void*) (intptr_t) m_colorHandles.at(index);
   }
 
+  void FrameBuffer::blitInto (const Index index, Uint32 destination, const Index destinationIndex,
+    const Vector2i& position, const Vector2u& size, const Bool linear) const
+  {
+    if (index >= m_colorHandles.size()) {
+      DG_ENGINE_CRIT("GL Framebuffer color attachment index {} is out of range!", index);
+      throw std::out_of_range { "Attempt to blit from framebuffer at index out of range!" };
+    }
+
+    // Multisampled attachments can be resolved by a blit, but not scaled.
+    if (m_spec.sampleCount > 1 && size != m_spec.size) {
+      DG_ENGINE_CRIT("Cannot scale a multisampled framebuffer from {}x{} to {}x{}!",
+        m_spec.size.x, m_spec.size.y, size.x, size.y);
+      throw std::invalid_argument { "Attempt to scale a multisampled framebuffer!" };
+    }
+
+    // Only the part of the attachment which is drawn into is copied.
+    RenderInterface::getBackend().blitFramebuffer(m_handle, index, { 0, 0 }, m_spec.size,
+      destination, destinationIndex, position, size, linear);
+  }
+
   void FrameBuffer::build ()
   {
 
     // If there is a frame buffer built already, then delete that buffer and its attachments, first.
     if (m_handle != 0) {
-      glDeleteFramebuffers(1, &m_handle);
-      glDeleteTextures(m_colorHandles.size(), m_colorHandles.data());
-      glDeleteTextures(1, &m_depthHandle);
+      RenderInterface::getBackend().destroyFramebuffer(m_handle);
+      Private::destroyTextures(m_colorHandles.data(), m_colorHandles.size());
+      Private::destroyTextures(&m_depthHandle, 1);
 
       m_colorHandles.clear();
       m_depthHandle = 0;
       m_handle = 0;
     }
 
+    // Allocate the attachments with some headroom, if asked for, so that growing a little later
+    // does not mean rebuilding again.
+    const Float32 scale = 1.0f + std::max(m_spec.headroom, 0.0f);
+    m_capacity.x = static_cast<Uint32>(std::ceil(m_spec.size.x * scale));
+    m_capacity.y = static_cast<Uint32>(std::ceil(m_spec.size.y * scale));
+
     // A framebuffer is "multisampled" if its sample count is greater than one.
     Bool isMultisampled = m_spec.sampleCount > 1;
 
     // Generate, then bind, the new frame buffer.
-    glGenFramebuffers(1, &m_handle);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_handle);
+    auto& backend = RenderInterface::getBackend();
+    m_handle = backend.createFramebuffer();
+    backend.bindFramebuffer(GL_FRAMEBUFFER, m_handle);
 
     // Check to see if there are color attachments to attach to this framebuffer.
     if (m_colorAttachmentSpecs.empty() == false) {
@@ -322,7 +512,8 @@ namespace dg
 
         // Bind, then attach, the color attachment texture.
         Private::bindTexture(isMultisampled, m_colorHandles[i]);
-        Private::attachColorTexture(m_colorHandles[i], m_spec, m_colorAttachmentSpecs[i], i);
+        Private::attachColorTexture(m_colorHandles[i], m_spec, m_colorAttachmentSpecs[i],
+          m_capacity, i);
 
       }
 
@@ -334,7 +525,7 @@ namespace dg
       // Create, bind, then attach the depth texture.
       Private::generateTextures(&m_depthHandle, 1);
       Private::bindTexture(isMultisampled, m_depthHandle);
-      Private::attachDepthTexture(m_depthHandle, m_spec, m_depthAttachmentSpec);
+      Private::attachDepthTexture(m_depthHandle, m_spec, m_depthAttachmentSpec, m_capacity);
 
     }
 
@@ -349,7 +540,7 @@ namespace dg
 
       // Create an array of the symbolic constants pointing to the color attachment textures to be 
       // drawn.
-      Uint32 colorAttachmentBuffers[FRAMEBUFFER_COLOR_ATTACHMENT_COUNT] = {
+      GLenum colorAttachmentBuffers[FRAMEBUFFER_COLOR_ATTACHMENT_COUNT] = {
         GL_COLOR_ATTACHMENT0,
         GL_COLOR_ATTACHMENT1,
         GL_COLOR_ATTACHMENT2,
@@ -358,19 +549,19 @@ namespace dg
 
       // Map the color attachments in our framebuffer to the above-defined color attachment buffers 
       // array.
-      glDrawBuffers(m_colorHandles.size(), colorAttachmentBuffers);
+      backend.setDrawBuffers(colorAttachmentBuffers, m_colorHandles.size());
     } else if (m_colorHandles.empty()) {
       // Only a depth buffer is being presented.
-      glDrawBuffer(GL_NONE);
+      backend.setDrawBuffers(nullptr, 0);
     }
 
     // Ensure that the framebuffer is complete and is ready to be used.
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    if (backend.isFramebufferComplete() == false) {
       throw std::runtime_error { "Unable to build a complete framebuffer!" };
     }
 
     // Building done, unbind the framebuffer.
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    backend.bindFramebuffer(GL_FRAMEBUFFER, 0);
 
   }
 
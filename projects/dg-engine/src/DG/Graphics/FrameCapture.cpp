@@ -0,0 +1,401 @@
+/** @file DG/Graphics/FrameCapture.cpp */
+
+#include <DG/Graphics/FrameCapture.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static Uint32 computeCrc32 (const Uint8* data, Size length, Uint32 crc = 0)
+    {
+      static const auto TABLE = [] ()
+      {
+        Collection<Uint32> table(256);
+        for (Uint32 i = 0; i < 256; ++i) {
+          Uint32 value = i;
+          for (Index bit = 0; bit < 8; ++bit) {
+            value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+          }
+          table[i] = value;
+        }
+        return table;
+      }();
+
+      crc = ~crc;
+      for (Size i = 0; i < length; ++i) {
+        crc = TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+      }
+      return ~crc;
+    }
+
+    static void appendBigEndian (Collection<Uint8>& output, Uint32 value)
+    {
+      output.push_back(static_cast<Uint8>(value >> 24));
+      output.push_back(static_cast<Uint8>(value >> 16));
+      output.push_back(static_cast<Uint8>(value >> 8));
+      output.push_back(static_cast<Uint8>(value));
+    }
+
+    static void appendPngChunk (Collection<Uint8>& output, const char* type,
+      const Uint8* data, Size length)
+    {
+      appendBigEndian(output, static_cast<Uint32>(length));
+      const Size typeOffset = output.size();
+      output.insert(output.end(), type, type + 4);
+      output.insert(output.end(), data, data + length);
+      appendBigEndian(output, computeCrc32(output.data() + typeOffset, length + 4));
+    }
+
+    /**
+     * @brief Encodes an RGBA image, top row first, as a PNG file. The image data is stored rather
+     *        than compressed, since the writer thread must keep up with the frame rate.
+     */
+    static void encodePng (const Vector2u& size, const Uint8* pixels, Collection<Uint8>& output)
+    {
+      // Deflate's stored blocks hold at most this many bytes each.
+      static constexpr Size MAX_BLOCK_SIZE = 65535;
+      static constexpr Uint8 SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+      const Size rowSize = static_cast<Size>(size.x) * 4;
+      const Size scanlineSize = static_cast<Size>(size.y) * (rowSize + 1);
+
+      // Each scanline starts with its filter type, which is always "none" here.
+      Collection<Uint8> scanlines;
+      scanlines.reserve(scanlineSize);
+      for (Index y = 0; y < size.y; ++y) {
+        scanlines.push_back(0);
+        scanlines.insert(scanlines.end(), pixels + y * rowSize, pixels + (y + 1) * rowSize);
+      }
+
+      Collection<Uint8> stream = { 0x78, 0x01 };
+      stream.reserve(scanlineSize + scanlineSize / MAX_BLOCK_SIZE * 5 + 16);
+      Uint32 adlerA = 1, adlerB = 0;
+      for (Size offset = 0; offset < scanlineSize; offset += MAX_BLOCK_SIZE) {
+        const Size length = std::min(MAX_BLOCK_SIZE, scanlineSize - offset);
+        stream.push_back((offset + length >= scanlineSize) ? 1 : 0);
+        stream.push_back(static_cast<Uint8>(length));
+        stream.push_back(static_cast<Uint8>(length >> 8));
+        stream.push_back(static_cast<Uint8>(~length));
+        stream.push_back(static_cast<Uint8>(~length >> 8));
+        stream.insert(stream.end(), scanlines.begin() + offset,
+          scanlines.begin() + offset + length);
+
+        for (Size i = offset; i < offset + length; ++i) {
+          adlerA = (adlerA + scanlines[i]) % 65521;
+          adlerB = (adlerB + adlerA) % 65521;
+        }
+      }
+      appendBigEndian(stream, (adlerB << 16) | adlerA);
+
+      // Width, height, 8 bits per channel, RGBA, and the default compression, filter and
+      // interlace methods.
+      Collection<Uint8> header;
+      appendBigEndian(header, size.x);
+      appendBigEndian(header, size.y);
+      header.insert(header.end(), { 8, 6, 0, 0, 0 });
+
+      output.clear();
+      output.insert(output.end(), std::begin(SIGNATURE), std::end(SIGNATURE));
+      appendPngChunk(output, "IHDR", header.data(), header.size());
+      appendPngChunk(output, "IDAT", stream.data(), stream.size());
+      appendPngChunk(output, "IEND", nullptr, 0);
+    }
+
+    /**
+     * @brief Converts an RGBA image to full-range BT.601 YUV, with one plane each for Y, U and V
+     *        and no chroma subsampling, as in a Y4M file's "C444" color space.
+     */
+    static void convertToYuv (const Vector2u& size, const Uint8* pixels, Collection<Uint8>& output)
+    {
+      const Size pixelCount = static_cast<Size>(size.x) * size.y;
+      output.resize(pixelCount * 3);
+
+      Uint8* y = output.data();
+      Uint8* u = y + pixelCount;
+      Uint8* v = u + pixelCount;
+      for (Size i = 0; i < pixelCount; ++i) {
+        const Int32 r = pixels[i * 4 + 0];
+        const Int32 g = pixels[i * 4 + 1];
+        const Int32 b = pixels[i * 4 + 2];
+        y[i] = static_cast<Uint8>(std::clamp((77 * r + 150 * g + 29 * b + 128) >> 8, 0, 255));
+        u[i] = static_cast<Uint8>(std::clamp(((-43 * r - 85 * g + 128 * b + 128) >> 8) + 128,
+          0, 255));
+        v[i] = static_cast<Uint8>(std::clamp(((128 * r - 107 * g - 21 * b + 128) >> 8) + 128,
+          0, 255));
+      }
+    }
+
+  }
+
+  FrameCaptureSpecification FrameCapture::s_spec;
+  FrameCaptureStats FrameCapture::s_stats;
+  Vector2u FrameCapture::s_size = { 0, 0 };
+  std::deque<FrameCapture::InFlightFrame> FrameCapture::s_inFlight;
+  Ref<FrameCapture::Writer> FrameCapture::s_writer = nullptr;
+  Scope<ThreadPool> FrameCapture::s_thread = nullptr;
+
+  Boolean FrameCapture::start (const FrameCaptureSpecification& spec)
+  {
+    stop();
+
+    auto writer = makeRef<Writer>();
+    writer->spec = spec;
+    if (spec.format == FrameCaptureFormat::PNG) {
+      std::error_code error;
+      fs::create_directories(spec.path, error);
+      if (error) {
+        DG_ENGINE_ERROR("Could not create frame capture directory '{}' - {}", spec.path.string(),
+          error.message());
+        return false;
+      }
+    } else {
+      writer->stream.open(spec.path, std::ios::binary | std::ios::trunc);
+      if (writer->stream.is_open() == false) {
+        DG_ENGINE_ERROR("Could not open frame capture file '{}' for writing.", spec.path.string());
+        return false;
+      }
+    }
+
+    s_spec = spec;
+    s_spec.maxInFlightFrames = std::max<Count>(spec.maxInFlightFrames, 1);
+    s_spec.maxQueuedFrames = std::max<Count>(spec.maxQueuedFrames, 1);
+    s_stats = {};
+    s_size = { 0, 0 };
+    s_writer = writer;
+    s_thread = makeScope<ThreadPool>(1);
+
+    DG_ENGINE_INFO("Started recording frames to '{}'.", spec.path.string());
+    return true;
+  }
+
+  void FrameCapture::stop ()
+  {
+    if (s_thread == nullptr) {
+      return;
+    }
+
+    // Frames still in transfer are dropped, so that stopping never waits on the graphics card.
+    auto& backend = RenderInterface::getBackend();
+    for (const auto& frame : s_inFlight) {
+      backend.destroyReadback(frame.handle);
+      s_stats.droppedCount++;
+    }
+    s_inFlight.clear();
+
+    // The writer thread runs its tasks in order, so once this one has run, every frame queued
+    // before it has been written.
+    auto writer = s_writer;
+    s_thread->submit([writer] () { writer->stream.close(); }).wait();
+    s_thread = nullptr;
+
+    s_stats.writtenCount = writer->writtenCount.load();
+    s_stats.failedCount = writer->failedCount.load();
+    s_stats.byteCount = writer->byteCount.load();
+    s_writer = nullptr;
+
+    DG_ENGINE_INFO("Stopped recording frames to '{}' ({} captured, {} written, {} dropped).",
+      s_spec.path.string(), s_stats.capturedCount, s_stats.writtenCount, s_stats.droppedCount);
+  }
+
+  void FrameCapture::shutdown ()
+  {
+    stop();
+  }
+
+  void FrameCapture::capture (const FrameBuffer& target)
+  {
+    if (s_thread == nullptr) {
+      return;
+    }
+
+    // Find the format of the color attachment being captured.
+    Index colorIndex = 0;
+    FrameBufferTextureFormat format = FrameBufferTextureFormat::None;
+    for (const auto& attachment : target.getSpecification().attachmentSpec.attachments) {
+      if (attachment.isDepthTextureFormat() == false && colorIndex++ == s_spec.attachment) {
+        format = attachment.textureFormat;
+        break;
+      }
+    }
+
+    if (format == FrameBufferTextureFormat::None) {
+      DG_ENGINE_CRIT("GL Framebuffer color attachment index {} is out of range!",
+        s_spec.attachment);
+      throw std::out_of_range { "Attempted 'capture' at attachment index out of range!" };
+    } else if (format != FrameBufferTextureFormat::ColorRGBA8) {
+      DG_ENGINE_CRIT("Frame capture attachment {} is not a 'ColorRGBA8' attachment!",
+        s_spec.attachment);
+      throw std::invalid_argument { "Attempted 'capture' of a non-RGBA8 attachment!" };
+    }
+
+    const Index frame = s_stats.capturedCount++;
+    const Vector2u& size = target.getSize();
+
+    // A raw or Y4M recording's frames must all be the same size as the first.
+    if (s_spec.format != FrameCaptureFormat::PNG) {
+      if (s_size == Vector2u { 0, 0 }) {
+        s_size = size;
+      } else if (size != s_size) {
+        s_stats.droppedCount++;
+        return;
+      }
+    }
+
+    if (s_inFlight.size() >= s_spec.maxInFlightFrames) {
+      s_stats.droppedCount++;
+      return;
+    }
+
+    // Re-use a pixel buffer which the writer thread has finished with, if there is one.
+    InFlightFrame inFlight;
+    inFlight.frame = frame;
+    inFlight.size = size;
+    {
+      std::lock_guard lock { s_writer->freeMutex };
+      if (s_writer->freePixels.empty() == false) {
+        inFlight.pixels = std::move(s_writer->freePixels.back());
+        s_writer->freePixels.pop_back();
+      }
+    }
+    inFlight.pixels.resize(static_cast<Size>(size.x) * size.y * 4);
+
+    auto& backend = RenderInterface::getBackend();
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, target.getHandle());
+    backend.setReadBuffer(GL_COLOR_ATTACHMENT0 + s_spec.attachment);
+    inFlight.handle = backend.beginReadback({ 0, 0 }, size, GL_RGBA, GL_UNSIGNED_BYTE);
+    backend.bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    s_inFlight.push_back(std::move(inFlight));
+  }
+
+  void FrameCapture::update ()
+  {
+    if (s_thread == nullptr) {
+      return;
+    }
+
+    // Frames are handed over in the order they were captured, so stop at the first which has not
+    // yet arrived.
+    auto& backend = RenderInterface::getBackend();
+    auto writer = s_writer;
+    while (s_inFlight.empty() == false) {
+      auto& front = s_inFlight.front();
+      ReadbackStatus status = backend.pollReadback(front.handle, front.pixels.data());
+      if (status == ReadbackStatus::Pending) {
+        break;
+      }
+
+      InFlightFrame frame = std::move(front);
+      s_inFlight.pop_front();
+
+      if (status == ReadbackStatus::Failed || writer->queuedCount >= s_spec.maxQueuedFrames) {
+        if (status == ReadbackStatus::Failed) {
+          writer->failedCount++;
+        } else {
+          s_stats.droppedCount++;
+        }
+
+        std::lock_guard lock { writer->freeMutex };
+        writer->freePixels.push_back(std::move(frame.pixels));
+        continue;
+      }
+
+      writer->queuedCount++;
+      s_thread->submit([writer, frame = std::move(frame)] () mutable
+      {
+        write(*writer, frame.frame, frame.size, frame.pixels);
+        {
+          std::lock_guard lock { writer->freeMutex };
+          writer->freePixels.push_back(std::move(frame.pixels));
+        }
+        writer->queuedCount--;
+      });
+    }
+
+    s_stats.writtenCount = writer->writtenCount.load();
+    s_stats.failedCount = writer->failedCount.load();
+    s_stats.byteCount = writer->byteCount.load();
+  }
+
+  Boolean FrameCapture::isRecording ()
+  {
+    return s_thread != nullptr;
+  }
+
+  const FrameCaptureStats& FrameCapture::getStats ()
+  {
+    return s_stats;
+  }
+
+  void FrameCapture::write (Writer& writer, Index frame, const Vector2u& size,
+    Collection<Uint8>& pixels)
+  {
+    // The pixels arrive bottom row first, so flip them.
+    const Size rowSize = static_cast<Size>(size.x) * 4;
+    for (Index top = 0, bottom = size.y - 1; top < bottom; ++top, --bottom) {
+      std::swap_ranges(pixels.begin() + top * rowSize, pixels.begin() + (top + 1) * rowSize,
+        pixels.begin() + bottom * rowSize);
+    }
+
+    Collection<Uint8> output;
+    Size byteCount = 0;
+    Bool written = false;
+    switch (writer.spec.format)
+    {
+      case FrameCaptureFormat::Raw:
+        writer.stream.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+        byteCount = pixels.size();
+        written = writer.stream.good();
+        break;
+
+      case FrameCaptureFormat::Y4M:
+      {
+        String header = "";
+        if (writer.headerWritten == false) {
+          header = "YUV4MPEG2 W" + std::to_string(size.x) + " H" + std::to_string(size.y) +
+            " F" + std::to_string(writer.spec.frameRate) + ":1 Ip A1:1 C444 XCOLORRANGE=FULL\n";
+          writer.headerWritten = true;
+        }
+        header += "FRAME\n";
+
+        Private::convertToYuv(size, pixels.data(), output);
+        writer.stream.write(header.data(), header.size());
+        writer.stream.write(reinterpret_cast<const char*>(output.data()), output.size());
+        byteCount = header.size() + output.size();
+        written = writer.stream.good();
+        break;
+      }
+
+      case FrameCaptureFormat::PNG:
+      {
+        Private::encodePng(size, pixels.data(), output);
+        String number = std::to_string(frame);
+        if (number.size() < 6) {
+          number.insert(0, 6 - number.size(), '0');
+        }
+
+        const Path path = writer.spec.path / formatString("frame_{}.png", number);
+        std::ofstream file { path, std::ios::binary | std::ios::trunc };
+        file.write(reinterpret_cast<const char*>(output.data()), output.size());
+        byteCount = output.size();
+        written = file.good();
+        break;
+      }
+    }
+
+    if (written == false) {
+      if (writer.failedCount++ == 0) {
+        DG_ENGINE_ERROR("Could not write captured frame {} to '{}'.", frame,
+          writer.spec.path.string());
+      }
+      return;
+    }
+
+    writer.writtenCount++;
+    writer.byteCount += byteCount;
+  }
+
+}
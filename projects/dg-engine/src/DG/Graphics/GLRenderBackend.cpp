@@ -0,0 +1,765 @@
+/** @file DG/Graphics/GLRenderBackend.cpp */
+
+#include <DG/Graphics/GLRenderBackend.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    /**
+     * @brief Starts compiling a single shader stage from the given source code. Its status is
+     *        checked by @a `checkShaderStage`.
+     *
+     * @param type      The type of shader stage, such as @a `GL_VERTEX_SHADER`.
+     * @param source    The shader stage's source code.
+     *
+     * @return  The handle of the shader stage.
+     */
+    static Uint32 beginShaderStage (GLenum type, const String& source)
+    {
+      const char* code = source.c_str();
+      Uint32 shader = glCreateShader(type);
+      glShaderSource(shader, 1, &code, nullptr);
+      glCompileShader(shader);
+      return shader;
+    }
+
+    /**
+     * @brief Checks the compilation status of a single shader stage, logging any errors or
+     *        warnings.
+     *
+     * @param shader    The handle of the shader stage.
+     * @param name      The name of the shader stage, for logging purposes.
+     *
+     * @return  @a `true` if the shader stage compiled successfully; @a `false` otherwise.
+     */
+    static Boolean checkShaderStage (Uint32 shader, const char* name)
+    {
+      // The length of the status info log string.
+      static constexpr Int32 INFO_LOG_LENGTH = 512;
+
+      // Keep track of a status code and an info log.
+      Int32 status = 0;
+      char infoLog[INFO_LOG_LENGTH];
+
+      glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+      glGetShaderInfoLog(shader, INFO_LOG_LENGTH, nullptr, infoLog);
+      if (status != GL_TRUE) {
+        DG_ENGINE_ERROR("Error compiling GLSL {} shader: {}", name, infoLog);
+        return false;
+      } else if (infoLog[0] != '\0') {
+        DG_ENGINE_WARN("GLSL {} shader compiled with warning: {}", name, infoLog);
+      }
+
+      return true;
+    }
+
+  }
+
+  RenderBackendType GLRenderBackend::getType () const
+  {
+    return RenderBackendType::OpenGL;
+  }
+
+  void GLRenderBackend::initialize ()
+  {
+    // Core profile contexts, such as those created by Mesa, need GLEW to query every entry point.
+    glewExperimental = GL_TRUE;
+
+    // GLEW reports a missing GLX display when the context was created through EGL or OSMesa.
+    // That is expected for headless windows, and the core entry points are still loaded.
+    GLenum result = glewInit();
+    if (result == GLEW_ERROR_NO_GLX_DISPLAY) {
+      DG_ENGINE_WARN("No GLX display found. Continuing with a display-less OpenGL context.");
+    } else if (result != GLEW_OK) {
+      DG_ENGINE_CRIT("Error initializing GLEW - {}: {}!", result, glewGetErrorString(result));
+      throw std::runtime_error { "Error initializing GLEW!" };
+    }
+
+    // Let the driver build shader programs on as many threads as it likes, if it can.
+    if (GLEW_KHR_parallel_shader_compile == GL_TRUE) {
+      glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+      m_parallelCompile = true;
+    } else if (GLEW_ARB_parallel_shader_compile == GL_TRUE) {
+      glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+      m_parallelCompile = true;
+    }
+  }
+
+  /** State and Draw Calls ************************************************************************/
+
+  void GLRenderBackend::setViewport (const Vector2i& position, const Vector2u& size)
+  {
+    glViewport(position.x, position.y, size.x, size.y);
+  }
+
+  void GLRenderBackend::setClearColor (const Color& color)
+  {
+    glClearColor(color.red, color.green, color.blue, color.alpha);
+  }
+
+  void GLRenderBackend::clear ()
+  {
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  }
+
+  void GLRenderBackend::setPixelStore (GLenum name, Int32 value)
+  {
+    glPixelStorei(name, value);
+  }
+
+  void GLRenderBackend::drawIndexed (GLenum primitive, Count indexCount, GLenum indexType)
+  {
+    glDrawElements(primitive, indexCount, indexType, nullptr);
+  }
+
+  /** Buffers *************************************************************************************/
+
+  Uint32 GLRenderBackend::createBuffer ()
+  {
+    Uint32 handle = 0;
+    glGenBuffers(1, &handle);
+    return handle;
+  }
+
+  void GLRenderBackend::destroyBuffer (Uint32 handle)
+  {
+    glDeleteBuffers(1, &handle);
+  }
+
+  void GLRenderBackend::bindBuffer (GLenum target, Uint32 handle)
+  {
+    glBindBuffer(target, handle);
+  }
+
+  void GLRenderBackend::allocateBuffer (GLenum target, Uint32 handle, const void* data,
+    Size size, GLenum usage)
+  {
+    glBindBuffer(target, handle);
+    glBufferData(target, size, data, usage);
+  }
+
+  void GLRenderBackend::uploadBuffer (GLenum target, Uint32 handle, const void* data, Size size,
+    Size offset)
+  {
+    glBindBuffer(target, handle);
+    glBufferSubData(target, offset, size, data);
+  }
+
+  /** Vertex Arrays *******************************************************************************/
+
+  Uint32 GLRenderBackend::createVertexArray ()
+  {
+    Uint32 handle = 0;
+    glGenVertexArrays(1, &handle);
+    return handle;
+  }
+
+  void GLRenderBackend::destroyVertexArray (Uint32 handle)
+  {
+    glDeleteVertexArrays(1, &handle);
+  }
+
+  void GLRenderBackend::bindVertexArray (Uint32 handle)
+  {
+    glBindVertexArray(handle);
+  }
+
+  void GLRenderBackend::setVertexAttribute (Index index, Count elementCount, GLenum type,
+    Bool normalized, Size stride, Size offset)
+  {
+    glVertexAttribPointer(index, elementCount, type, normalized ? GL_TRUE : GL_FALSE, stride,
+      (const void*) offset);
+    glEnableVertexAttribArray(index);
+  }
+
+  /** Textures ************************************************************************************/
+
+  Uint32 GLRenderBackend::createTexture ()
+  {
+    Uint32 handle = 0;
+    glGenTextures(1, &handle);
+    return handle;
+  }
+
+  void GLRenderBackend::destroyTexture (Uint32 handle)
+  {
+    glDeleteTextures(1, &handle);
+  }
+
+  void GLRenderBackend::bindTexture (GLenum target, Uint32 handle, Index slot)
+  {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(target, handle);
+  }
+
+  void GLRenderBackend::setTextureParameter (GLenum target, Uint32 handle, GLenum name,
+    Int32 value)
+  {
+    glBindTexture(target, handle);
+    glTexParameteri(target, name, value);
+  }
+
+  void GLRenderBackend::allocateTexture2D (Uint32 handle, GLenum internalFormat,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void* data)
+  {
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, size.x, size.y, 0, pixelFormat, dataType,
+      data);
+  }
+
+  void GLRenderBackend::allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount,
+    GLenum internalFormat, const Vector2u& size)
+  {
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, handle);
+    glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, sampleCount, internalFormat, size.x,
+      size.y, GL_FALSE);
+  }
+
+  void GLRenderBackend::allocateTextureStorage2D (Uint32 handle, Count levelCount,
+    GLenum internalFormat, const Vector2u& size)
+  {
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glTexStorage2D(GL_TEXTURE_2D, levelCount, internalFormat, size.x, size.y);
+  }
+
+  Bool GLRenderBackend::isTextureFormatSupported (GLenum internalFormat)
+  {
+    switch (internalFormat) {
+      case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+      case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+      case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+        return GLEW_EXT_texture_compression_s3tc == GL_TRUE;
+      case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        return GLEW_VERSION_4_2 == GL_TRUE || GLEW_ARB_texture_compression_bptc == GL_TRUE;
+      default:
+        return true;
+    }
+  }
+
+  void GLRenderBackend::uploadTexture2D (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void* data, Index level)
+  {
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glTexSubImage2D(GL_TEXTURE_2D, level, offset.x, offset.y, size.x, size.y, pixelFormat,
+      dataType, data);
+  }
+
+  void GLRenderBackend::uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, Uint32 buffer, Size bufferOffset,
+    Index level)
+  {
+    // While a pixel unpack buffer is bound, the data pointer is an offset into that buffer. Un-bind
+    // it afterwards, so later uploads from client memory are not mistaken for offsets.
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glTexSubImage2D(GL_TEXTURE_2D, level, offset.x, offset.y, size.x, size.y, pixelFormat,
+      dataType, reinterpret_cast<const void*>(bufferOffset));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
+
+  void GLRenderBackend::uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum compressedFormat, const void* data, Size byteCount, Index level)
+  {
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, level, offset.x, offset.y, size.x, size.y,
+      compressedFormat, byteCount, data);
+  }
+
+  void GLRenderBackend::generateTextureMipmaps (Uint32 handle)
+  {
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glGenerateMipmap(GL_TEXTURE_2D);
+  }
+
+  void GLRenderBackend::clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+    const void* data)
+  {
+    glClearTexImage(handle, 0, pixelFormat, dataType, data);
+  }
+
+  /** Frame Buffers *******************************************************************************/
+
+  Uint32 GLRenderBackend::createFramebuffer ()
+  {
+    Uint32 handle = 0;
+    glGenFramebuffers(1, &handle);
+    return handle;
+  }
+
+  void GLRenderBackend::destroyFramebuffer (Uint32 handle)
+  {
+    glDeleteFramebuffers(1, &handle);
+  }
+
+  void GLRenderBackend::bindFramebuffer (GLenum target, Uint32 handle)
+  {
+    glBindFramebuffer(target, handle);
+  }
+
+  void GLRenderBackend::attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+    Uint32 texture)
+  {
+    glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, textureTarget, texture, 0);
+  }
+
+  void GLRenderBackend::setDrawBuffers (const GLenum* buffers, Count count)
+  {
+    if (buffers == nullptr || count == 0) {
+      glDrawBuffer(GL_NONE);
+    } else {
+      glDrawBuffers(count, buffers);
+    }
+  }
+
+  void GLRenderBackend::setReadBuffer (GLenum buffer)
+  {
+    glReadBuffer(buffer);
+  }
+
+  void GLRenderBackend::clearFramebufferColor (Uint32 framebuffer, Index index,
+    const Vector4f& color)
+  {
+    // GLEW declares the value as non-const, though it is only read.
+    Vector4f value = color;
+    glClearNamedFramebufferfv(framebuffer, GL_COLOR, static_cast<GLint>(index), &value[0]);
+  }
+
+  void GLRenderBackend::clearFramebufferInteger (Uint32 framebuffer, Index index,
+    const Vector4i& value)
+  {
+    glClearNamedFramebufferiv(framebuffer, GL_COLOR, static_cast<GLint>(index), &value[0]);
+  }
+
+  void GLRenderBackend::clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+    Int32 stencil)
+  {
+    glClearNamedFramebufferfi(framebuffer, GL_DEPTH_STENCIL, 0, depth, stencil);
+  }
+
+  void GLRenderBackend::invalidateFramebuffer (Uint32 framebuffer, const GLenum* attachments,
+    Count count)
+  {
+    glInvalidateNamedFramebufferData(framebuffer, static_cast<GLsizei>(count), attachments);
+  }
+
+  void GLRenderBackend::blitFramebuffer (Uint32 source, Index sourceIndex,
+    const Vector2i& sourcePosition, const Vector2u& sourceSize, Uint32 destination,
+    Index destinationIndex, const Vector2i& destinationPosition, const Vector2u& destinationSize,
+    Bool linear)
+  {
+    // The number of draw buffers which a framebuffer may have, at most, in this engine.
+    static constexpr GLsizei DRAW_BUFFER_COUNT = 4;
+
+    glNamedFramebufferReadBuffer(source, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(sourceIndex));
+
+    // A blit writes into every draw buffer, so narrow the destination's down to the one attachment
+    // being copied into, then put them back.
+    GLenum drawBuffers[DRAW_BUFFER_COUNT] = { GL_NONE, GL_NONE, GL_NONE, GL_NONE };
+    if (destination != 0) {
+      for (GLsizei i = 0; i < DRAW_BUFFER_COUNT; ++i) {
+        GLint buffer = GL_NONE;
+        glGetNamedFramebufferParameteriv(destination, GL_DRAW_BUFFER0 + i, &buffer);
+        drawBuffers[i] = static_cast<GLenum>(buffer);
+      }
+
+      glNamedFramebufferDrawBuffer(destination,
+        GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(destinationIndex));
+    }
+
+    const Vector2i sourceEnd = sourcePosition + Vector2i { sourceSize };
+    const Vector2i destinationEnd = destinationPosition + Vector2i { destinationSize };
+    glBlitNamedFramebuffer(source, destination,
+      sourcePosition.x, sourcePosition.y, sourceEnd.x, sourceEnd.y,
+      destinationPosition.x, destinationPosition.y, destinationEnd.x, destinationEnd.y,
+      GL_COLOR_BUFFER_BIT, (linear == true) ? GL_LINEAR : GL_NEAREST);
+
+    if (destination != 0) {
+      glNamedFramebufferDrawBuffers(destination, DRAW_BUFFER_COUNT, drawBuffers);
+    }
+  }
+
+  Bool GLRenderBackend::isFramebufferComplete ()
+  {
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+  }
+
+  void GLRenderBackend::readPixels (const Vector2i& position, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType, void* data)
+  {
+    glReadPixels(position.x, position.y, size.x, size.y, pixelFormat, dataType, data);
+  }
+
+  Uint32 GLRenderBackend::beginReadback (const Vector2i& position, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType)
+  {
+    PendingReadback readback;
+    readback.byteCount = getImageByteCount(size, pixelFormat, dataType);
+
+    // Reuse the smallest free pack buffer which is large enough, if there is one.
+    auto iter = m_freePackBuffers.end();
+    for (auto it = m_freePackBuffers.begin(); it != m_freePackBuffers.end(); ++it) {
+      if (
+        it->capacity >= readback.byteCount &&
+        (iter == m_freePackBuffers.end() || it->capacity < iter->capacity)
+      ) {
+        iter = it;
+      }
+    }
+
+    if (iter != m_freePackBuffers.end()) {
+      readback.buffer = *iter;
+      m_freePackBuffers.erase(iter);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer.handle);
+    } else {
+      glGenBuffers(1, &readback.buffer.handle);
+      readback.buffer.capacity = readback.byteCount;
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer.handle);
+      glBufferData(GL_PIXEL_PACK_BUFFER, readback.byteCount, nullptr, GL_STREAM_READ);
+    }
+
+    // With a pack buffer bound, the read is queued up like any other command, and the data
+    // pointer is an offset into the buffer. The fence tells when the transfer is done.
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(position.x, position.y, size.x, size.y, pixelFormat, dataType, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    Uint32 handle = m_nextReadback++;
+    m_pendingReadbacks.emplace(handle, readback);
+    return handle;
+  }
+
+  ReadbackStatus GLRenderBackend::pollReadback (Uint32 handle, void* data, Bool wait)
+  {
+    // How long to wait for a fence, at most, in nanoseconds.
+    static constexpr GLuint64 WAIT_TIMEOUT = 1'000'000'000;
+
+    auto iter = m_pendingReadbacks.find(handle);
+    if (iter == m_pendingReadbacks.end()) {
+      return ReadbackStatus::Failed;
+    }
+
+    // Flush the fence to the graphics card, so that it is sure to signal eventually.
+    PendingReadback& readback = iter->second;
+    GLenum result = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+      (wait == true) ? WAIT_TIMEOUT : 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+      return ReadbackStatus::Pending;
+    }
+
+    ReadbackStatus status = ReadbackStatus::Failed;
+    if (result == GL_WAIT_FAILED) {
+      DG_ENGINE_ERROR("Error waiting on pixel readback {}.", handle);
+    } else {
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer.handle);
+      glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, readback.byteCount, data);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      status = ReadbackStatus::Complete;
+    }
+
+    destroyReadback(handle);
+    return status;
+  }
+
+  void GLRenderBackend::destroyReadback (Uint32 handle)
+  {
+    auto iter = m_pendingReadbacks.find(handle);
+    if (iter == m_pendingReadbacks.end()) {
+      return;
+    }
+
+    glDeleteSync(iter->second.fence);
+    m_freePackBuffers.push_back(iter->second.buffer);
+    m_pendingReadbacks.erase(iter);
+  }
+
+  /** Timer Queries *******************************************************************************/
+
+  Uint32 GLRenderBackend::beginTimerQuery ()
+  {
+    Uint32 query = 0;
+    if (m_freeQueries.empty() == false) {
+      query = m_freeQueries.back();
+      m_freeQueries.pop_back();
+    } else {
+      glGenQueries(1, &query);
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, query);
+
+    Uint32 handle = m_nextQuery++;
+    m_pendingQueries.emplace(handle, query);
+    return handle;
+  }
+
+  void GLRenderBackend::endTimerQuery ()
+  {
+    glEndQuery(GL_TIME_ELAPSED);
+  }
+
+  QueryStatus GLRenderBackend::pollTimerQuery (Uint32 handle, Uint64& nanoseconds)
+  {
+    auto iter = m_pendingQueries.find(handle);
+    if (iter == m_pendingQueries.end()) {
+      return QueryStatus::Failed;
+    }
+
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(iter->second, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) {
+      return QueryStatus::Pending;
+    }
+
+    GLuint64 result = 0;
+    glGetQueryObjectui64v(iter->second, GL_QUERY_RESULT, &result);
+    nanoseconds = result;
+
+    m_freeQueries.push_back(iter->second);
+    m_pendingQueries.erase(iter);
+    return QueryStatus::Complete;
+  }
+
+  void GLRenderBackend::destroyTimerQuery (Uint32 handle)
+  {
+    auto iter = m_pendingQueries.find(handle);
+    if (iter == m_pendingQueries.end()) {
+      return;
+    }
+
+    glDeleteQueries(1, &iter->second);
+    m_pendingQueries.erase(iter);
+  }
+
+  /** Fences **************************************************************************************/
+
+  Uint32 GLRenderBackend::insertFence ()
+  {
+    Uint32 handle = m_nextFence++;
+    m_pendingFences.emplace(handle, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    return handle;
+  }
+
+  Bool GLRenderBackend::pollFence (Uint32 handle, Bool wait)
+  {
+    // How long to wait for a fence, at most, in nanoseconds.
+    static constexpr GLuint64 WAIT_TIMEOUT = 1'000'000'000;
+
+    auto iter = m_pendingFences.find(handle);
+    if (iter == m_pendingFences.end()) {
+      return true;
+    }
+
+    // Flush the fence to the graphics card, so that it is sure to signal eventually.
+    GLenum result = glClientWaitSync(iter->second, GL_SYNC_FLUSH_COMMANDS_BIT,
+      (wait == true) ? WAIT_TIMEOUT : 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+      return false;
+    } else if (result == GL_WAIT_FAILED) {
+      DG_ENGINE_ERROR("Error waiting on fence {}.", handle);
+    }
+
+    destroyFence(handle);
+    return true;
+  }
+
+  void GLRenderBackend::destroyFence (Uint32 handle)
+  {
+    auto iter = m_pendingFences.find(handle);
+    if (iter == m_pendingFences.end()) {
+      return;
+    }
+
+    glDeleteSync(iter->second);
+    m_pendingFences.erase(iter);
+  }
+
+  /** Shader Programs *****************************************************************************/
+
+  Uint32 GLRenderBackend::createProgram (const String& vertexCode, const String& fragmentCode)
+  {
+    Uint32 shaderProgram = beginProgram(vertexCode, fragmentCode);
+    return (pollProgram(shaderProgram, true) == ProgramStatus::Linked) ? shaderProgram : 0;
+  }
+
+  Uint32 GLRenderBackend::beginProgram (const String& vertexCode, const String& fragmentCode)
+  {
+    // Start compiling the vertex and fragment shader stages. Their status is checked only once
+    // the program has been linked, so that the driver is not made to finish them early.
+    PendingProgram pending;
+    pending.vertexShader = Private::beginShaderStage(GL_VERTEX_SHADER, vertexCode);
+    pending.fragmentShader = Private::beginShaderStage(GL_FRAGMENT_SHADER, fragmentCode);
+
+    // Next, create the shader program and attach the shader stages to it.
+    Uint32 shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, pending.vertexShader);
+    glAttachShader(shaderProgram, pending.fragmentShader);
+
+    // Keep the linked binary around, in case it is asked for by the shader cache.
+    glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+    // Start linking the program.
+    glLinkProgram(shaderProgram);
+    m_pendingPrograms.emplace(shaderProgram, pending);
+    return shaderProgram;
+  }
+
+  ProgramStatus GLRenderBackend::pollProgram (Uint32 handle, Bool wait)
+  {
+    // The length of the status info log string.
+    static constexpr Int32 INFO_LOG_LENGTH = 512;
+
+    auto iter = m_pendingPrograms.find(handle);
+    if (iter == m_pendingPrograms.end()) {
+      return (handle != 0) ? ProgramStatus::Linked : ProgramStatus::Failed;
+    }
+
+    // Without parallel compilation, asking for the link status waits for the build to finish, so
+    // the build is reported as pending until the caller is willing to wait.
+    if (wait == false) {
+      if (m_parallelCompile == false) {
+        return ProgramStatus::Pending;
+      }
+
+      Int32 completed = GL_FALSE;
+      glGetProgramiv(handle, GL_COMPLETION_STATUS_KHR, &completed);
+      if (completed == GL_FALSE) {
+        return ProgramStatus::Pending;
+      }
+    }
+
+    const PendingProgram pending = iter->second;
+    m_pendingPrograms.erase(iter);
+
+    // Check the link status. If linking failed, find out which stage, if any, failed to compile.
+    Int32 status = 0;
+    char infoLog[INFO_LOG_LENGTH];
+    glGetProgramiv(handle, GL_LINK_STATUS, &status);
+    glGetProgramInfoLog(handle, INFO_LOG_LENGTH, nullptr, infoLog);
+
+    Boolean linked = (status == GL_TRUE);
+    if (linked == false) {
+      if (
+        Private::checkShaderStage(pending.vertexShader, "vertex") == true &&
+        Private::checkShaderStage(pending.fragmentShader, "fragment") == true
+      ) {
+        DG_ENGINE_ERROR("Error linking GLSL shader program: {}", infoLog);
+      }
+    } else if (infoLog[0] != '\0') {
+      DG_ENGINE_WARN("GLSL shader program linked with warning: {}", infoLog);
+    }
+
+    // Delete the shader objects now.
+    glDeleteShader(pending.vertexShader);
+    glDeleteShader(pending.fragmentShader);
+
+    if (linked == false) {
+      glDeleteProgram(handle);
+      return ProgramStatus::Failed;
+    }
+
+    return ProgramStatus::Linked;
+  }
+
+  Uint32 GLRenderBackend::createProgramFromBinary (GLenum format, const void* data,
+    Size byteCount)
+  {
+    Uint32 shaderProgram = glCreateProgram();
+    glProgramBinary(shaderProgram, format, data, static_cast<GLsizei>(byteCount));
+
+    // A binary the driver cannot use leaves the program unlinked.
+    Int32 status = 0;
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+      glDeleteProgram(shaderProgram);
+      return 0;
+    }
+
+    return shaderProgram;
+  }
+
+  Bool GLRenderBackend::getProgramBinary (Uint32 handle, GLenum& format,
+    Collection<Uint8>& binary)
+  {
+    Int32 length = 0;
+    glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+      return false;
+    }
+
+    binary.resize(static_cast<Size>(length));
+    glGetProgramBinary(handle, length, &length, &format, binary.data());
+    binary.resize(static_cast<Size>(length));
+    return length > 0;
+  }
+
+  String GLRenderBackend::getDeviceName ()
+  {
+    const auto* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+    const auto* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const auto* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    return formatString("{} / {} / {}",
+      (vendor != nullptr) ? vendor : "",
+      (renderer != nullptr) ? renderer : "",
+      (version != nullptr) ? version : "");
+  }
+
+  void GLRenderBackend::destroyProgram (Uint32 handle)
+  {
+    // A program destroyed before its build was checked still owns its shader stages.
+    auto iter = m_pendingPrograms.find(handle);
+    if (iter != m_pendingPrograms.end()) {
+      glDeleteShader(iter->second.vertexShader);
+      glDeleteShader(iter->second.fragmentShader);
+      m_pendingPrograms.erase(iter);
+    }
+
+    glDeleteProgram(handle);
+  }
+
+  void GLRenderBackend::useProgram (Uint32 handle)
+  {
+    glUseProgram(handle);
+  }
+
+  void GLRenderBackend::setUniform (Uint32 program, const String& name, ShaderUniformType type,
+    const void* value)
+  {
+    glUseProgram(program);
+    Int32 location = glGetUniformLocation(program, name.c_str());
+    if (location == -1) { return; }
+
+    auto f = static_cast<const Float32*>(value);
+    auto d = static_cast<const Float64*>(value);
+    auto i = static_cast<const Int32*>(value);
+    auto u = static_cast<const Uint32*>(value);
+
+    switch (type) {
+      case ShaderUniformType::Float:      glUniform1f(location, f[0]); break;
+      case ShaderUniformType::Float2:     glUniform2f(location, f[0], f[1]); break;
+      case ShaderUniformType::Float3:     glUniform3f(location, f[0], f[1], f[2]); break;
+      case ShaderUniformType::Float4:     glUniform4f(location, f[0], f[1], f[2], f[3]); break;
+      case ShaderUniformType::Float2x2:   glUniformMatrix2fv(location, 1, GL_FALSE, f); break;
+      case ShaderUniformType::Float3x3:   glUniformMatrix3fv(location, 1, GL_FALSE, f); break;
+      case ShaderUniformType::Float4x4:   glUniformMatrix4fv(location, 1, GL_FALSE, f); break;
+      case ShaderUniformType::Double:     glUniform1d(location, d[0]); break;
+      case ShaderUniformType::Double2:    glUniform2d(location, d[0], d[1]); break;
+      case ShaderUniformType::Double3:    glUniform3d(location, d[0], d[1], d[2]); break;
+      case ShaderUniformType::Double4:    glUniform4d(location, d[0], d[1], d[2], d[3]); break;
+      case ShaderUniformType::Double2x2:  glUniformMatrix2dv(location, 1, GL_FALSE, d); break;
+      case ShaderUniformType::Double3x3:  glUniformMatrix3dv(location, 1, GL_FALSE, d); break;
+      case ShaderUniformType::Double4x4:  glUniformMatrix4dv(location, 1, GL_FALSE, d); break;
+      case ShaderUniformType::Int:        glUniform1i(location, i[0]); break;
+      case ShaderUniformType::Int2:       glUniform2i(location, i[0], i[1]); break;
+      case ShaderUniformType::Int3:       glUniform3i(location, i[0], i[1], i[2]); break;
+      case ShaderUniformType::Int4:       glUniform4i(location, i[0], i[1], i[2], i[3]); break;
+      case ShaderUniformType::Uint:       glUniform1ui(location, u[0]); break;
+      case ShaderUniformType::Uint2:      glUniform2ui(location, u[0], u[1]); break;
+      case ShaderUniformType::Uint3:      glUniform3ui(location, u[0], u[1], u[2]); break;
+      case ShaderUniformType::Uint4:      glUniform4ui(location, u[0], u[1], u[2], u[3]); break;
+    }
+  }
+
+}
@@ -1,6 +1,7 @@
 /** @file DG/Graphics/GraphicsBuffers.cpp */
 
 #include <DG/Graphics/GraphicsBuffers.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
 
 namespace dg
 {
@@ -10,12 +11,12 @@ namespace dg
   VertexBuffer::VertexBuffer (Bool dynamic) :
     m_dynamic { dynamic }
   {
-    glGenBuffers(1, &m_handle);
+    m_handle = RenderInterface::getBackend().createBuffer();
   }
 
   VertexBuffer::~VertexBuffer ()
   {
-    glDeleteBuffers(1, &m_handle);
+    RenderInterface::getBackend().destroyBuffer(m_handle);
   }
 
   Ref<VertexBuffer> VertexBuffer::make (Bool dynamic)
@@ -25,12 +26,12 @@ namespace dg
 
   void VertexBuffer::bind () const
   {
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
+    RenderInterface::getBackend().bindBuffer(GL_ARRAY_BUFFER, m_handle);
   }
 
   void VertexBuffer::unbind ()
   {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    RenderInterface::getBackend().bindBuffer(GL_ARRAY_BUFFER, 0);
   }
 
   Boolean VertexBuffer::isDynamic () const
@@ -61,8 +62,8 @@ namespace dg
     }
 
     // Bind the buffer, then allocate the vertex data.
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
-    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    RenderInterface::getBackend().allocateBuffer(GL_ARRAY_BUFFER, m_handle, nullptr, size,
+      GL_DYNAMIC_DRAW);
 
     // Set the buffer size.
     m_bufferSize = size;   
@@ -86,8 +87,8 @@ namespace dg
     }
 
     // Bind the buffer, then allocate and upload the vertex data.
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
-    glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    RenderInterface::getBackend().allocateBuffer(GL_ARRAY_BUFFER, m_handle, data, size,
+      GL_STATIC_DRAW);
 
     // Set the buffer size.
     m_bufferSize = size;    
@@ -113,8 +114,7 @@ namespace dg
     }
 
     // Bind the buffer, then upload the vertex data.
-    glBindBuffer(GL_ARRAY_BUFFER, m_handle);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);    
+    RenderInterface::getBackend().uploadBuffer(GL_ARRAY_BUFFER, m_handle, data, size);
   }
 
   /** Index Buffer ********************************************************************************/
@@ -122,12 +122,12 @@ namespace dg
   IndexBuffer::IndexBuffer (Bool dynamic) :
     m_dynamic { dynamic }
   {
-    glGenBuffers(1, &m_handle);
+    m_handle = RenderInterface::getBackend().createBuffer();
   }
 
   IndexBuffer::~IndexBuffer ()
   {
-    glDeleteBuffers(1, &m_handle);
+    RenderInterface::getBackend().destroyBuffer(m_handle);
   }
 
   Ref<IndexBuffer> IndexBuffer::make (Bool dynamic)
@@ -137,12 +137,12 @@ namespace dg
 
   void IndexBuffer::bind () const
   {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
+    RenderInterface::getBackend().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
   }
 
   void IndexBuffer::unbind ()
   {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    RenderInterface::getBackend().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
   }
 
   Boolean IndexBuffer::isDynamic () const
@@ -190,8 +190,8 @@ namespace dg
     }
 
     // Bind the buffer, then allocate the index data.
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    RenderInterface::getBackend().allocateBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle, nullptr, size,
+      GL_DYNAMIC_DRAW);
 
     // Set the buffer size.
     m_bufferSize = size;   
@@ -222,8 +222,8 @@ namespace dg
     }
 
     // Bind the buffer, then allocate and upload the index data.
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    RenderInterface::getBackend().allocateBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle, data, size,
+      GL_STATIC_DRAW);
 
     // Set the buffer size.
     m_bufferSize = size;    
@@ -256,8 +256,7 @@ namespace dg
     }
 
     // Bind the buffer, then upload the index data.
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, data);    
+    RenderInterface::getBackend().uploadBuffer(GL_ELEMENT_ARRAY_BUFFER, m_handle, data, size);
   }
 
 }
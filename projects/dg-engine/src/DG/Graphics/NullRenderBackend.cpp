@@ -0,0 +1,415 @@
+/** @file DG/Graphics/NullRenderBackend.cpp */
+
+#include <DG/Graphics/NullRenderBackend.hpp>
+
+namespace dg
+{
+
+  RenderBackendType NullRenderBackend::getType () const
+  {
+    return RenderBackendType::Null;
+  }
+
+  void NullRenderBackend::initialize ()
+  {
+    DG_ENGINE_INFO("Using the null render backend. No commands will reach the graphics card.");
+  }
+
+  /** State and Draw Calls ************************************************************************/
+
+  void NullRenderBackend::setViewport (const Vector2i&, const Vector2u&)
+  {
+  }
+
+  void NullRenderBackend::setClearColor (const Color&)
+  {
+  }
+
+  void NullRenderBackend::clear ()
+  {
+    record(RenderCommandType::Clear);
+  }
+
+  void NullRenderBackend::setPixelStore (GLenum, Int32)
+  {
+  }
+
+  void NullRenderBackend::drawIndexed (GLenum, Count indexCount, GLenum)
+  {
+    record(RenderCommandType::DrawIndexed, 0, indexCount);
+  }
+
+  /** Buffers *************************************************************************************/
+
+  Uint32 NullRenderBackend::createBuffer ()
+  {
+    return nextHandle();
+  }
+
+  void NullRenderBackend::destroyBuffer (Uint32)
+  {
+  }
+
+  void NullRenderBackend::bindBuffer (GLenum, Uint32)
+  {
+  }
+
+  void NullRenderBackend::allocateBuffer (GLenum, Uint32 handle, const void* data,
+    Size size, GLenum)
+  {
+    if (data != nullptr) {
+      record(RenderCommandType::UploadBuffer, handle, 0, size);
+    }
+  }
+
+  void NullRenderBackend::uploadBuffer (GLenum, Uint32 handle, const void*,
+    Size size, Size)
+  {
+    record(RenderCommandType::UploadBuffer, handle, 0, size);
+  }
+
+  /** Vertex Arrays *******************************************************************************/
+
+  Uint32 NullRenderBackend::createVertexArray ()
+  {
+    return nextHandle();
+  }
+
+  void NullRenderBackend::destroyVertexArray (Uint32)
+  {
+  }
+
+  void NullRenderBackend::bindVertexArray (Uint32)
+  {
+  }
+
+  void NullRenderBackend::setVertexAttribute (Index, Count, GLenum,
+    Bool, Size, Size)
+  {
+  }
+
+  /** Textures ************************************************************************************/
+
+  Uint32 NullRenderBackend::createTexture ()
+  {
+    return nextHandle();
+  }
+
+  void NullRenderBackend::destroyTexture (Uint32)
+  {
+  }
+
+  void NullRenderBackend::bindTexture (GLenum, Uint32 handle, Index slot)
+  {
+    record(RenderCommandType::BindTexture, handle, slot);
+  }
+
+  void NullRenderBackend::setTextureParameter (GLenum, Uint32, GLenum,
+    Int32)
+  {
+  }
+
+  void NullRenderBackend::allocateTexture2D (Uint32 handle, GLenum,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void* data)
+  {
+    if (data != nullptr) {
+      record(RenderCommandType::UploadTexture, handle, 0,
+        getImageByteCount(size, pixelFormat, dataType));
+    }
+  }
+
+  void NullRenderBackend::allocateTexture2DMultisample (Uint32, Uint32,
+    GLenum, const Vector2u&)
+  {
+  }
+
+  void NullRenderBackend::allocateTextureStorage2D (Uint32, Count,
+    GLenum, const Vector2u&)
+  {
+  }
+
+  Bool NullRenderBackend::isTextureFormatSupported (GLenum)
+  {
+    return true;
+  }
+
+  void NullRenderBackend::uploadTexture2D (Uint32 handle, const Vector2u&,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void*, Index)
+  {
+    record(RenderCommandType::UploadTexture, handle, 0,
+      getImageByteCount(size, pixelFormat, dataType));
+  }
+
+  void NullRenderBackend::uploadTexture2DFromBuffer (Uint32 handle, const Vector2u&,
+    const Vector2u&, GLenum, GLenum, Uint32, Size,
+    Index)
+  {
+    // The pixels were counted when they were staged into the buffer.
+    record(RenderCommandType::UploadTexture, handle);
+  }
+
+  void NullRenderBackend::uploadCompressedTexture2D (Uint32 handle, const Vector2u&,
+    const Vector2u&, GLenum, const void*, Size byteCount, Index)
+  {
+    record(RenderCommandType::UploadTexture, handle, 0, byteCount);
+  }
+
+  void NullRenderBackend::generateTextureMipmaps (Uint32)
+  {
+  }
+
+  void NullRenderBackend::clearTexture (Uint32, GLenum, GLenum,
+    const void*)
+  {
+  }
+
+  /** Frame Buffers *******************************************************************************/
+
+  Uint32 NullRenderBackend::createFramebuffer ()
+  {
+    return nextHandle();
+  }
+
+  void NullRenderBackend::destroyFramebuffer (Uint32)
+  {
+  }
+
+  void NullRenderBackend::bindFramebuffer (GLenum, Uint32 handle)
+  {
+    record(RenderCommandType::BindFramebuffer, handle);
+  }
+
+  void NullRenderBackend::attachFramebufferTexture (GLenum, GLenum,
+    Uint32)
+  {
+  }
+
+  void NullRenderBackend::setDrawBuffers (const GLenum*, Count)
+  {
+  }
+
+  void NullRenderBackend::setReadBuffer (GLenum)
+  {
+  }
+
+  void NullRenderBackend::clearFramebufferColor (Uint32 framebuffer, Index,
+    const Vector4f&)
+  {
+    record(RenderCommandType::Clear, framebuffer);
+  }
+
+  void NullRenderBackend::clearFramebufferInteger (Uint32 framebuffer, Index,
+    const Vector4i&)
+  {
+    record(RenderCommandType::Clear, framebuffer);
+  }
+
+  void NullRenderBackend::clearFramebufferDepthStencil (Uint32 framebuffer, Float32,
+    Int32)
+  {
+    record(RenderCommandType::Clear, framebuffer);
+  }
+
+  void NullRenderBackend::invalidateFramebuffer (Uint32 framebuffer, const GLenum*,
+    Count count)
+  {
+    record(RenderCommandType::InvalidateFramebuffer, framebuffer, count);
+  }
+
+  void NullRenderBackend::blitFramebuffer (Uint32, Index,
+    const Vector2i&, const Vector2u&, Uint32 destination,
+    Index, const Vector2i&, const Vector2u&,
+    Bool)
+  {
+    record(RenderCommandType::BlitFramebuffer, destination);
+  }
+
+  Bool NullRenderBackend::isFramebufferComplete ()
+  {
+    return true;
+  }
+
+  void NullRenderBackend::readPixels (const Vector2i&, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType, void* data)
+  {
+    // Nothing was ever drawn, so hand back zeroed pixels.
+    Size byteCount = getImageByteCount(size, pixelFormat, dataType);
+    if (data != nullptr) {
+      std::memset(data, 0, byteCount);
+    }
+
+    record(RenderCommandType::ReadPixels, 0, 0, byteCount);
+  }
+
+  Uint32 NullRenderBackend::beginReadback (const Vector2i&, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType)
+  {
+    Uint32 handle = nextHandle();
+    Size byteCount = getImageByteCount(size, pixelFormat, dataType);
+    m_readbackByteCounts.emplace(handle, byteCount);
+
+    record(RenderCommandType::ReadPixels, handle, 0, byteCount);
+    return handle;
+  }
+
+  ReadbackStatus NullRenderBackend::pollReadback (Uint32 handle, void* data, Bool)
+  {
+    auto iter = m_readbackByteCounts.find(handle);
+    if (iter == m_readbackByteCounts.end()) {
+      return ReadbackStatus::Failed;
+    }
+
+    // As with reading right away, hand back zeroed pixels.
+    if (data != nullptr) {
+      std::memset(data, 0, iter->second);
+    }
+
+    m_readbackByteCounts.erase(iter);
+    return ReadbackStatus::Complete;
+  }
+
+  void NullRenderBackend::destroyReadback (Uint32 handle)
+  {
+    m_readbackByteCounts.erase(handle);
+  }
+
+  /** Timer Queries *******************************************************************************/
+
+  Uint32 NullRenderBackend::beginTimerQuery ()
+  {
+    return nextHandle();
+  }
+
+  void NullRenderBackend::endTimerQuery ()
+  {
+  }
+
+  QueryStatus NullRenderBackend::pollTimerQuery (Uint32, Uint64& nanoseconds)
+  {
+    // Nothing is ever drawn, so nothing takes any time.
+    nanoseconds = 0;
+    return QueryStatus::Complete;
+  }
+
+  void NullRenderBackend::destroyTimerQuery (Uint32)
+  {
+  }
+
+  /** Fences **************************************************************************************/
+
+  Uint32 NullRenderBackend::insertFence ()
+  {
+    return nextHandle();
+  }
+
+  Bool NullRenderBackend::pollFence (Uint32, Bool)
+  {
+    // With nothing to carry out, every fence has signaled as soon as it is inserted.
+    return true;
+  }
+
+  void NullRenderBackend::destroyFence (Uint32)
+  {
+  }
+
+  /** Shader Programs *****************************************************************************/
+
+  Uint32 NullRenderBackend::createProgram (const String&, const String&)
+  {
+    return nextHandle();
+  }
+
+  Uint32 NullRenderBackend::beginProgram (const String&, const String&)
+  {
+    return nextHandle();
+  }
+
+  ProgramStatus NullRenderBackend::pollProgram (Uint32 handle, Bool)
+  {
+    return (handle != 0) ? ProgramStatus::Linked : ProgramStatus::Failed;
+  }
+
+  Uint32 NullRenderBackend::createProgramFromBinary (GLenum, const void*,
+    Size)
+  {
+    // There is no driver to accept a binary, so programs are always built from source.
+    return 0;
+  }
+
+  Bool NullRenderBackend::getProgramBinary (Uint32, GLenum&,
+    Collection<Uint8>&)
+  {
+    return false;
+  }
+
+  String NullRenderBackend::getDeviceName ()
+  {
+    return "Null";
+  }
+
+  void NullRenderBackend::destroyProgram (Uint32)
+  {
+  }
+
+  void NullRenderBackend::useProgram (Uint32 handle)
+  {
+    record(RenderCommandType::UseProgram, handle);
+  }
+
+  void NullRenderBackend::setUniform (Uint32 program, const String&,
+    ShaderUniformType, const void*)
+  {
+    record(RenderCommandType::SetUniform, program);
+  }
+
+  /** Recorded Commands ***************************************************************************/
+
+  void NullRenderBackend::setRecording (Bool recording)
+  {
+    m_recording = recording;
+  }
+
+  Bool NullRenderBackend::isRecording () const
+  {
+    return m_recording;
+  }
+
+  const Collection<RenderCommand>& NullRenderBackend::getCommands () const
+  {
+    return m_commands;
+  }
+
+  Count NullRenderBackend::countCommands (const RenderCommandType type) const
+  {
+    return std::count_if(m_commands.begin(), m_commands.end(),
+      [type] (const RenderCommand& command) { return command.type == type; });
+  }
+
+  Size NullRenderBackend::getUploadedByteCount () const
+  {
+    return m_uploadedByteCount;
+  }
+
+  void NullRenderBackend::clearCommands ()
+  {
+    m_commands.clear();
+    m_uploadedByteCount = 0;
+  }
+
+  void NullRenderBackend::record (const RenderCommandType type, Uint32 handle, Count count,
+    Size byteCount)
+  {
+    if (m_recording == true) {
+      m_commands.push_back({ type, handle, count, byteCount });
+    }
+    if (type == RenderCommandType::UploadBuffer || type == RenderCommandType::UploadTexture) {
+      m_uploadedByteCount += byteCount;
+    }
+  }
+
+  Uint32 NullRenderBackend::nextHandle ()
+  {
+    return m_nextHandle++;
+  }
+
+}
@@ -0,0 +1,136 @@
+/** @file DG/Graphics/OrthographicCamera2D.cpp */
+
+#include <DG/Core/Logging.hpp>
+#include <DG/Graphics/OrthographicCamera2D.hpp>
+
+namespace dg
+{
+
+  OrthographicCamera2D::OrthographicCamera2D (const Vector2f& viewportSize)
+  {
+    setViewportSize(viewportSize);
+  }
+
+  /** Setters *************************************************************************************/
+
+  void OrthographicCamera2D::setPosition (const Vector2f& position)
+  {
+    if (position != m_position) {
+      m_position = position;
+      m_dirty = true;
+    }
+  }
+
+  void OrthographicCamera2D::setRotation (Float32 rotation)
+  {
+    if (rotation != m_rotation) {
+      m_rotation = rotation;
+      m_dirty = true;
+    }
+  }
+
+  void OrthographicCamera2D::setZoom (Float32 zoom)
+  {
+    if (std::isfinite(zoom) == false || zoom <= 0.0f) {
+      DG_ENGINE_CRIT("Camera zoom must be a finite number greater than zero; got {}.", zoom);
+      throw std::invalid_argument { "Camera zoom must be a finite number greater than zero!" };
+    }
+
+    if (zoom != m_zoom) {
+      m_zoom = zoom;
+      m_dirty = true;
+    }
+  }
+
+  void OrthographicCamera2D::setViewportSize (const Vector2f& viewportSize)
+  {
+    if (
+      std::isfinite(viewportSize.x) == false || viewportSize.x <= 0.0f ||
+      std::isfinite(viewportSize.y) == false || viewportSize.y <= 0.0f
+    ) {
+      DG_ENGINE_CRIT("Camera viewport size must be finite and greater than zero; got {}x{}.",
+        viewportSize.x, viewportSize.y);
+      throw std::invalid_argument { "Camera viewport size must be finite and greater than zero!" };
+    }
+
+    if (viewportSize != m_viewportSize) {
+      m_viewportSize = viewportSize;
+      m_dirty = true;
+    }
+  }
+
+  void OrthographicCamera2D::setDepthRange (Float32 nearPlane, Float32 farPlane)
+  {
+    if (nearPlane != m_nearPlane || farPlane != m_farPlane) {
+      m_nearPlane = nearPlane;
+      m_farPlane = farPlane;
+      m_dirty = true;
+    }
+  }
+
+  /** Getters *************************************************************************************/
+
+  const Matrix4f& OrthographicCamera2D::getView () const
+  {
+    recalculate();
+    return m_view;
+  }
+
+  const Matrix4f& OrthographicCamera2D::getProjection () const
+  {
+    recalculate();
+    return m_projection;
+  }
+
+  const Matrix4f& OrthographicCamera2D::getViewProjection () const
+  {
+    recalculate();
+    return m_viewProjection;
+  }
+
+  const AABB2D& OrthographicCamera2D::getBounds () const
+  {
+    recalculate();
+    return m_bounds;
+  }
+
+  /** Private Functions ***************************************************************************/
+
+  void OrthographicCamera2D::recalculate () const
+  {
+    if (m_dirty == false) {
+      return;
+    }
+
+    const Float32 radians = glm::radians(m_rotation);
+    const Float32 sine = std::sin(radians);
+    const Float32 cosine = std::cos(radians);
+    const Vector2f halfExtent = m_viewportSize * (0.5f / m_zoom);
+
+    // The view matrix is the inverse of the camera's own placement: turn the world the other way
+    // about the camera, after moving the camera to the origin. It is built directly, rather than by
+    // inverting the placement.
+    m_view = Matrix4f { 1.0f };
+    m_view[0] = {  cosine, -sine, 0.0f, 0.0f };
+    m_view[1] = {  sine, cosine, 0.0f, 0.0f };
+    m_view[3] = {
+      -(cosine * m_position.x + sine * m_position.y),
+      sine * m_position.x - cosine * m_position.y,
+      0.0f, 1.0f
+    };
+
+    m_projection = glm::ortho(-halfExtent.x, halfExtent.x, -halfExtent.y, halfExtent.y,
+      m_nearPlane, m_farPlane);
+    m_viewProjection = m_projection * m_view;
+
+    // The bounds are the box around the view turned by the camera's rotation.
+    const Vector2f boundsExtent {
+      std::abs(cosine) * halfExtent.x + std::abs(sine) * halfExtent.y,
+      std::abs(sine) * halfExtent.x + std::abs(cosine) * halfExtent.y
+    };
+    m_bounds = { m_position - boundsExtent, m_position + boundsExtent };
+
+    m_dirty = false;
+  }
+
+}
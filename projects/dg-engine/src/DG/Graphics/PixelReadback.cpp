@@ -0,0 +1,136 @@
+/** @file DG/Graphics/PixelReadback.cpp */
+
+#include <DG/Graphics/PixelReadback.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
+
+namespace dg
+{
+
+  Collection<PixelReadback::Watch> PixelReadback::s_watches;
+
+  PixelReadback::PixelReadback (const Vector2i& position, const Vector2u& size, Uint32 handle) :
+    m_position  { position },
+    m_size      { size },
+    m_handle    { handle },
+    m_ready     { handle == 0 }
+  {
+
+  }
+
+  PixelReadback::~PixelReadback ()
+  {
+    if (m_handle != 0) {
+      RenderInterface::getBackend().destroyReadback(m_handle);
+    }
+  }
+
+  void PixelReadback::update ()
+  {
+    // A callback may watch another readback, so those are polled from the next frame on.
+    Collection<Watch> watches;
+    watches.swap(s_watches);
+
+    for (auto& watch : watches) {
+      if (watch.readback->poll() == true) {
+        watch.callback(*watch.readback);
+      } else {
+        s_watches.push_back(std::move(watch));
+      }
+    }
+  }
+
+  void PixelReadback::shutdown ()
+  {
+    s_watches.clear();
+  }
+
+  void PixelReadback::watch (const Ref<PixelReadback>& readback,
+    const PixelReadbackCallback& callback)
+  {
+    if (readback == nullptr || callback == nullptr) {
+      throw std::invalid_argument { "Attempted 'watch' with null readback or callback!" };
+    }
+
+    s_watches.push_back({ readback, callback });
+  }
+
+  Boolean PixelReadback::poll (Bool wait)
+  {
+    if (m_ready == true || m_handle == 0) {
+      return m_ready;
+    }
+
+    // The pixels are written straight into the values, which are sized once, on the first poll,
+    // and only filled in once the transfer is complete.
+    if (m_values.empty() == true) {
+      m_values.resize(static_cast<Size>(m_size.x) * m_size.y);
+    }
+
+    ReadbackStatus status = RenderInterface::getBackend().pollReadback(m_handle, m_values.data(),
+      wait);
+    if (status == ReadbackStatus::Pending) {
+      return false;
+    }
+
+    // A failed transfer still counts as finished, so that callbacks are not left waiting on it;
+    // its pixels read as -1, as those outside the rectangle do.
+    m_handle = 0;
+    m_ready = true;
+    if (status != ReadbackStatus::Complete) {
+      m_values.assign(m_values.size(), -1);
+    }
+
+    return true;
+  }
+
+  Boolean PixelReadback::isReady () const
+  {
+    return m_ready;
+  }
+
+  Int32 PixelReadback::getValue (Int32 x, Int32 y) const
+  {
+    x -= m_position.x;
+    y -= m_position.y;
+    if (
+      m_ready == false || x < 0 || y < 0 ||
+      static_cast<Uint32>(x) >= m_size.x || static_cast<Uint32>(y) >= m_size.y
+    ) {
+      return -1;
+    }
+
+    return m_values[static_cast<Index>(y) * m_size.x + x];
+  }
+
+  const Collection<Int32>& PixelReadback::getValues () const
+  {
+    static const Collection<Int32> s_none;
+    return (m_ready == true) ? m_values : s_none;
+  }
+
+  Collection<Int32> PixelReadback::getDistinctValues (Int32 ignored) const
+  {
+    Collection<Int32> values;
+    values.reserve(getValues().size());
+    for (Int32 value : getValues()) {
+      if (value != ignored) {
+        values.push_back(value);
+      }
+    }
+
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+  }
+
+  const Vector2i& PixelReadback::getPosition () const
+  {
+    return m_position;
+  }
+
+  const Vector2u& PixelReadback::getSize () const
+  {
+    return m_size;
+  }
+
+}
@@ -0,0 +1,64 @@
+/** @file DG/Graphics/RenderBackend.cpp */
+
+#include <DG/Graphics/RenderBackend.hpp>
+
+namespace dg
+{
+
+  void RenderBackend::submit (const LFunction<void>& function)
+  {
+    function();
+  }
+
+  void RenderBackend::flush ()
+  {
+
+  }
+
+  void RenderBackend::endFrame ()
+  {
+
+  }
+
+  Uint32 RenderBackend::resolveHandle (Uint32 handle) const
+  {
+    return handle;
+  }
+
+  Size RenderBackend::getImageByteCount (const Vector2u& size, GLenum pixelFormat,
+    GLenum dataType, const Size alignment)
+  {
+    Size channels = 4;
+    switch (pixelFormat) {
+      case GL_RED:
+      case GL_RED_INTEGER:
+      case GL_DEPTH_COMPONENT:  channels = 1; break;
+      case GL_RG:
+      case GL_RG_INTEGER:       channels = 2; break;
+      case GL_RGB:
+      case GL_RGB_INTEGER:      channels = 3; break;
+      default:                  channels = 4; break;
+    }
+
+    // Packed types hold every channel of a pixel in one value.
+    Size bytes = 1;
+    switch (dataType) {
+      case GL_SHORT:
+      case GL_UNSIGNED_SHORT:     bytes = 2; break;
+      case GL_INT:
+      case GL_UNSIGNED_INT:
+      case GL_FLOAT:              bytes = 4; break;
+      case GL_UNSIGNED_INT_24_8:  bytes = 4; channels = 1; break;
+      default:                    bytes = 1; break;
+    }
+
+    // Each row of pixels starts on a multiple of the alignment.
+    Size rowSize = static_cast<Size>(size.x) * channels * bytes;
+    if (alignment > 1) {
+      rowSize = (rowSize + alignment - 1) / alignment * alignment;
+    }
+
+    return rowSize * size.y;
+  }
+
+}
@@ -0,0 +1,88 @@
+/** @file DG/Graphics/RenderCommandQueue.cpp */
+
+#include <DG/Graphics/RenderCommandQueue.hpp>
+
+namespace dg
+{
+
+  RenderCommandQueue::~RenderCommandQueue ()
+  {
+    clear();
+  }
+
+  void* RenderCommandQueue::copy (const void* data, const Size size)
+  {
+    if (data == nullptr) { return nullptr; }
+
+    void* memory = allocate(size == 0 ? 1 : size, alignof(std::max_align_t));
+    std::memcpy(memory, data, size);
+    return memory;
+  }
+
+  void RenderCommandQueue::execute ()
+  {
+    Index i = 0;
+    try {
+      for ( ; i < m_commands.size(); ++i) {
+        m_commands[i].invoke(m_commands[i].object, true);
+      }
+    } catch (...) {
+      // The command which threw has already destroyed itself. Destroy the commands after it, then
+      // pass the exception on.
+      reset(i + 1);
+      throw;
+    }
+
+    reset(m_commands.size());
+  }
+
+  void RenderCommandQueue::clear ()
+  {
+    reset(0);
+  }
+
+  Count RenderCommandQueue::getCommandCount () const
+  {
+    return m_commands.size();
+  }
+
+  void* RenderCommandQueue::allocate (const Size size, const Size alignment)
+  {
+    // Look for room in the current block, moving on to the next block if there is none.
+    while (m_blockIndex < m_blocks.size()) {
+      auto& block = m_blocks[m_blockIndex];
+      Size offset = (block.used + alignment - 1) & ~(alignment - 1);
+      if (offset + size <= block.size) {
+        block.used = offset + size;
+        return block.data.get() + offset;
+      }
+
+      m_blockIndex++;
+    }
+
+    // No block has room, so add a new one. Blocks are allocated with `new[]`, which aligns them
+    // for any fundamental type.
+    Size blockSize = std::max(size, BLOCK_SIZE);
+    auto& block = m_blocks.emplace_back();
+    block.data = makeScope<Uint8[]>(blockSize);
+    block.size = blockSize;
+    block.used = size;
+    m_blockIndex = m_blocks.size() - 1;
+    return block.data.get();
+  }
+
+  void RenderCommandQueue::reset (Index first)
+  {
+    // Destroy any commands which were not run.
+    for (Index i = first; i < m_commands.size(); ++i) {
+      m_commands[i].invoke(m_commands[i].object, false);
+    }
+
+    m_commands.clear();
+    for (auto& block : m_blocks) {
+      block.used = 0;
+    }
+    m_blockIndex = 0;
+  }
+
+}
@@ -0,0 +1,292 @@
+/** @file DG/Graphics/RenderGraph.cpp */
+
+#include <DG/Graphics/RenderGraph.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static Size getTargetByteCount (const FrameBufferSpecification& spec)
+    {
+      // Every attachment format uses four bytes per pixel, per sample.
+      return static_cast<Size>(spec.size.x) * spec.size.y * 4 *
+        spec.attachmentSpec.attachments.size() * std::max(spec.sampleCount, 1u);
+    }
+
+    static Bool loadsAnything (const RenderPassDescriptor& pass)
+    {
+      if (pass.depthAttachment.load == RenderPassLoadOp::Load) {
+        return true;
+      }
+
+      return std::any_of(pass.colorAttachments.begin(), pass.colorAttachments.end(),
+        [] (const RenderPassColorAttachment& attachment)
+        {
+          return attachment.load == RenderPassLoadOp::Load;
+        });
+    }
+
+  }
+
+  /** Render Graph Builder ************************************************************************/
+
+  RenderGraphBuilder::RenderGraphBuilder (RenderGraph& graph, Index passIndex) :
+    m_graph     { graph },
+    m_passIndex { passIndex }
+  {
+
+  }
+
+  RenderGraphResource RenderGraphBuilder::create (const String& name,
+    const FrameBufferSpecification& spec)
+  {
+    if (spec.size.x == 0 || spec.size.y == 0) {
+      DG_ENGINE_CRIT("Render graph target '{}' has zero size!", name);
+      throw std::invalid_argument { "Attempted 'create' with zero render target size!" };
+    }
+
+    m_graph.m_resources.push_back({ name, spec, nullptr, false, 0 });
+    m_graph.m_compiled = false;
+    return m_graph.m_resources.size() - 1;
+  }
+
+  void RenderGraphBuilder::read (RenderGraphResource resource)
+  {
+    auto& declared = m_graph.getResource(resource, "read");
+    if (declared.imported == false && declared.writerCount == 0) {
+      DG_ENGINE_CRIT("Render graph pass '{}' reads target '{}' before any pass draws into it!",
+        m_graph.m_passes[m_passIndex].name, declared.name);
+      throw std::runtime_error { "Render graph target read before it is drawn into!" };
+    }
+
+    m_graph.m_passes[m_passIndex].reads.push_back(resource);
+  }
+
+  void RenderGraphBuilder::write (RenderGraphResource resource, const RenderPassDescriptor& pass)
+  {
+    auto& declared = m_graph.getResource(resource, "write");
+    auto& declaring = m_graph.m_passes[m_passIndex];
+    if (declaring.writes == true) {
+      DG_ENGINE_CRIT("Render graph pass '{}' already draws into target '{}'!", declaring.name,
+        m_graph.m_resources[declaring.target].name);
+      throw std::invalid_argument { "Render graph pass draws into more than one target!" };
+    }
+
+    declaring.target = resource;
+    declaring.writes = true;
+    declaring.pass = pass;
+    declared.writerCount++;
+  }
+
+  void RenderGraphBuilder::setSideEffect ()
+  {
+    m_graph.m_passes[m_passIndex].sideEffect = true;
+  }
+
+  /** Render Graph Context ************************************************************************/
+
+  RenderGraphContext::RenderGraphContext (const RenderGraph& graph) :
+    m_graph { graph }
+  {
+
+  }
+
+  const Ref<FrameBuffer>& RenderGraphContext::getTarget (RenderGraphResource resource) const
+  {
+    if (resource >= m_graph.m_resources.size()) {
+      DG_ENGINE_CRIT("Render graph target {} does not exist!", resource);
+      throw std::invalid_argument { "Attempted 'getTarget' with unknown render graph target!" };
+    }
+
+    const auto& declared = m_graph.m_resources[resource];
+    if (declared.target == nullptr) {
+      DG_ENGINE_CRIT("Render graph target '{}' is not alive during this pass!", declared.name);
+      throw std::runtime_error { "Render graph target is not alive during this pass!" };
+    }
+
+    return declared.target;
+  }
+
+  /** Render Graph ********************************************************************************/
+
+  RenderGraphResource RenderGraph::importTarget (const String& name,
+    const Ref<FrameBuffer>& target)
+  {
+    if (target == nullptr) {
+      throw std::invalid_argument { "Attempted 'importTarget' with null frame buffer!" };
+    }
+
+    m_resources.push_back({ name, target->getSpecification(), target, true, 0 });
+    m_compiled = false;
+    return m_resources.size() - 1;
+  }
+
+  void RenderGraph::addPass (const String& name, const RenderGraphSetupFunction& setup,
+    const RenderGraphExecuteFunction& execute)
+  {
+    Pass& pass = m_passes.emplace_back();
+    pass.name = name;
+    pass.execute = execute;
+    m_compiled = false;
+
+    if (setup != nullptr) {
+      RenderGraphBuilder builder { *this, m_passes.size() - 1 };
+      setup(builder);
+    }
+  }
+
+  void RenderGraph::compile ()
+  {
+    m_steps.clear();
+    m_stats = {};
+    m_stats.passCount = m_passes.size();
+
+    // Walk the passes backwards, keeping those whose output is needed, and noting what they read
+    // as needed in turn. A pass which loads none of its target's contents means that the earlier
+    // passes drawing into that target are not needed on its account.
+    Collection<Bool> needed(m_resources.size(), false);
+    Collection<Bool> kept(m_passes.size(), false);
+    for (Index i = m_passes.size(); i-- > 0; ) {
+      const auto& pass = m_passes[i];
+      kept[i] = pass.sideEffect == true || (pass.writes == true &&
+        (m_resources[pass.target].imported == true || needed[pass.target] == true));
+      if (kept[i] == false) {
+        m_stats.culledPassCount++;
+        continue;
+      }
+
+      if (pass.writes == true) {
+        needed[pass.target] = Private::loadsAnything(pass.pass);
+      }
+
+      for (RenderGraphResource resource : pass.reads) {
+        needed[resource] = true;
+      }
+    }
+
+    // Work out the first and last step in which each transient target is used.
+    constexpr Index UNUSED = static_cast<Index>(-1);
+    Collection<Index> firstUse(m_resources.size(), UNUSED);
+    Collection<Index> lastUse(m_resources.size(), UNUSED);
+    for (Index i = 0; i < m_passes.size(); ++i) {
+      if (kept[i] == false) {
+        continue;
+      }
+
+      const Index step = m_steps.size();
+      m_steps.emplace_back().passIndex = i;
+
+      const auto& pass = m_passes[i];
+      auto use = [&] (RenderGraphResource resource)
+      {
+        if (m_resources[resource].imported == true) { return; }
+        if (firstUse[resource] == UNUSED) { firstUse[resource] = step; }
+        lastUse[resource] = step;
+      };
+
+      for (RenderGraphResource resource : pass.reads) { use(resource); }
+      if (pass.writes == true) { use(pass.target); }
+    }
+
+    for (RenderGraphResource resource = 0; resource < m_resources.size(); ++resource) {
+      if (firstUse[resource] == UNUSED) {
+        continue;
+      }
+
+      m_steps[firstUse[resource]].acquires.push_back(resource);
+      m_steps[lastUse[resource]].releases.push_back(resource);
+      m_stats.transientCount++;
+      m_stats.transientByteCount += Private::getTargetByteCount(m_resources[resource].spec);
+    }
+
+    // Tally the memory held by the transient targets alive at each step, to find the peak.
+    Size liveByteCount = 0;
+    for (const auto& step : m_steps) {
+      for (RenderGraphResource resource : step.acquires) {
+        liveByteCount += Private::getTargetByteCount(m_resources[resource].spec);
+      }
+
+      m_stats.peakTransientByteCount = std::max(m_stats.peakTransientByteCount, liveByteCount);
+      for (RenderGraphResource resource : step.releases) {
+        liveByteCount -= Private::getTargetByteCount(m_resources[resource].spec);
+      }
+    }
+
+    m_compiled = true;
+  }
+
+  void RenderGraph::execute ()
+  {
+    if (m_compiled == false) {
+      compile();
+    }
+
+    RenderGraphContext context { *this };
+    for (const auto& step : m_steps) {
+      for (RenderGraphResource resource : step.acquires) {
+        m_resources[resource].target = RenderTargetPool::acquire(m_resources[resource].spec);
+      }
+
+      const auto& pass = m_passes[step.passIndex];
+      if (pass.writes == true) {
+        m_resources[pass.target].target->beginPass(pass.pass);
+      }
+
+      if (pass.execute != nullptr) {
+        pass.execute(context);
+      }
+
+      if (pass.writes == true) {
+        m_resources[pass.target].target->endPass(pass.pass);
+        FrameBuffer::unbind();
+      }
+
+      for (RenderGraphResource resource : step.releases) {
+        RenderTargetPool::release(m_resources[resource].target);
+        m_resources[resource].target = nullptr;
+      }
+    }
+  }
+
+  void RenderGraph::clear ()
+  {
+    m_resources.clear();
+    m_passes.clear();
+    m_steps.clear();
+    m_compiled = false;
+  }
+
+  Collection<String> RenderGraph::getExecutionOrder () const
+  {
+    Collection<String> names;
+    if (m_compiled == false) {
+      return names;
+    }
+
+    for (const auto& step : m_steps) {
+      names.push_back(m_passes[step.passIndex].name);
+    }
+
+    return names;
+  }
+
+  const RenderGraphStats& RenderGraph::getStats () const
+  {
+    return m_stats;
+  }
+
+  RenderGraph::Resource& RenderGraph::getResource (RenderGraphResource resource,
+    const char* function)
+  {
+    if (resource >= m_resources.size()) {
+      DG_ENGINE_CRIT("Attempted '{}' with render graph target {}, which does not exist!", function,
+        resource);
+      throw std::invalid_argument { "Render graph target does not exist!" };
+    }
+
+    return m_resources[resource];
+  }
+
+}
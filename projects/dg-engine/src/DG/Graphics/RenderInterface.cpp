@@ -1,34 +1,74 @@
 /** @file DG/Graphics/RenderInterface.cpp */
 
+#include <DG/Graphics/GLRenderBackend.hpp>
+#include <DG/Graphics/NullRenderBackend.hpp>
 #include <DG/Graphics/RenderInterface.hpp>
 
 namespace dg
 {
 
   RenderPrimitiveType RenderInterface::s_primitiveType = RenderPrimitiveType::Triangles;
+  Scope<RenderBackend> RenderInterface::s_backend = nullptr;
+  Bool RenderInterface::s_threaded = false;
+  Color RenderInterface::s_clearColor = { 0.0f, 0.0f, 0.0f, 0.0f };
 
-  void RenderInterface::initialize ()
+  void RenderInterface::initialize (const RenderBackendType type,
+    const RenderThreadSpecification& thread)
   {
-    GLenum result = glewInit();
-    if (result != GLEW_OK) {
-      DG_ENGINE_CRIT("Error initializing GLEW - {}: {}!", result, glewGetErrorString(result));
-      throw std::runtime_error { "Error initializing GLEW!" };
+    switch (type)
+    {
+      case RenderBackendType::Null:   s_backend = makeScope<NullRenderBackend>(); break;
+      default:                        s_backend = makeScope<GLRenderBackend>(); break;
+    }
+
+    s_threaded = thread.enabled;
+    if (s_threaded == true) {
+      s_backend = makeScope<ThreadedRenderBackend>(std::move(s_backend), thread);
+    }
+
+    s_backend->initialize();
+  }
+
+  void RenderInterface::shutdown ()
+  {
+    s_backend.reset();
+    s_threaded = false;
+  }
+
+  RenderBackend& RenderInterface::getBackend ()
+  {
+    if (s_backend == nullptr) {
+      DG_ENGINE_CRIT("Attempted to access the render backend before it was initialized!");
+      throw std::runtime_error { "Render backend is not initialized!" };
     }
+
+    return *s_backend;
+  }
+
+  Bool RenderInterface::isThreaded ()
+  {
+    return s_threaded;
   }
 
   void RenderInterface::setViewport (const Vector2u& size)
   {
-    glViewport(0, 0, size.x, size.y);
+    getBackend().setViewport({ 0, 0 }, size);
   }
 
   void RenderInterface::setClearColor (const Color& color)
   {
-    glClearColor(color.red, color.green, color.blue, color.alpha);
+    s_clearColor = color;
+    getBackend().setClearColor(color);
+  }
+
+  const Color& RenderInterface::getClearColor ()
+  {
+    return s_clearColor;
   }
 
   void RenderInterface::clear ()
   {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    getBackend().clear();
   }
 
   void RenderInterface::drawIndexed (const Ref<VertexArray>& vao, Count indexCount)
@@ -56,7 +96,7 @@ namespace dg
 
     // Bind the VAO and perform the draw call.
     vao->bind();
-    glDrawElements(resolvePrimitiveType(), indexCount, ibo->resolveIndexType(), nullptr);
+    getBackend().drawIndexed(resolvePrimitiveType(), indexCount, ibo->resolveIndexType());
 
   }
 
@@ -0,0 +1,146 @@
+/** @file DG/Graphics/RenderTargetPool.cpp */
+
+#include <DG/Graphics/RenderTargetPool.hpp>
+
+namespace dg
+{
+
+  RenderTargetPoolSpecification RenderTargetPool::s_spec;
+  RenderTargetPoolStats RenderTargetPool::s_stats;
+  Collection<RenderTargetPool::Entry> RenderTargetPool::s_entries;
+
+  void RenderTargetPool::initialize (const RenderTargetPoolSpecification& spec)
+  {
+    shutdown();
+
+    s_spec = spec;
+  }
+
+  void RenderTargetPool::shutdown ()
+  {
+    s_entries.clear();
+
+    s_spec = {};
+    s_stats = {};
+  }
+
+  Ref<FrameBuffer> RenderTargetPool::acquire (const FrameBufferSpecification& spec)
+  {
+    if (spec.size.x == 0 || spec.size.y == 0) {
+      throw std::invalid_argument { "Attempted 'acquire' with zero render target size!" };
+    }
+
+    // Of the released targets which fit, pick the one with the smallest capacity, so that the
+    // larger ones stay free for larger requests.
+    Entry* best = nullptr;
+    for (auto& entry : s_entries) {
+      if (entry.acquired == true || fits(*entry.target, spec) == false) {
+        continue;
+      }
+
+      const Vector2u& capacity = entry.target->getCapacity();
+      if (
+        best == nullptr ||
+        static_cast<Size>(capacity.x) * capacity.y <
+          static_cast<Size>(best->target->getCapacity().x) * best->target->getCapacity().y
+      ) {
+        best = &entry;
+      }
+    }
+
+    if (best != nullptr) {
+      best->target->setSize(spec.size);
+      best->acquired = true;
+      best->lastUsedFrame = s_stats.frame;
+      s_stats.hitCount++;
+      count();
+      return best->target;
+    }
+
+    FrameBufferSpecification targetSpec = spec;
+    targetSpec.headroom = std::max(spec.headroom, s_spec.headroom);
+    s_entries.push_back({ FrameBuffer::make(targetSpec), true, s_stats.frame });
+    s_stats.missCount++;
+    count();
+    return s_entries.back().target;
+  }
+
+  void RenderTargetPool::release (const Ref<FrameBuffer>& target)
+  {
+    auto iter = std::find_if(s_entries.begin(), s_entries.end(),
+      [&target] (const Entry& entry) { return entry.target == target; });
+    if (iter == s_entries.end()) {
+      DG_ENGINE_CRIT("Attempted 'release' with render target not acquired from the pool!");
+      throw std::invalid_argument { "Attempted 'release' with render target not from the pool!" };
+    }
+
+    iter->acquired = false;
+    iter->lastUsedFrame = s_stats.frame;
+    count();
+  }
+
+  void RenderTargetPool::update ()
+  {
+    if (s_spec.maxIdleFrames != 0) {
+      auto removed = std::remove_if(s_entries.begin(), s_entries.end(),
+        [] (const Entry& entry)
+        {
+          return entry.acquired == false &&
+            s_stats.frame - entry.lastUsedFrame > s_spec.maxIdleFrames;
+        });
+
+      s_stats.evictionCount += std::distance(removed, s_entries.end());
+      s_entries.erase(removed, s_entries.end());
+      count();
+    }
+
+    s_stats.frame++;
+  }
+
+  const RenderTargetPoolStats& RenderTargetPool::getStats ()
+  {
+    return s_stats;
+  }
+
+  Bool RenderTargetPool::fits (const FrameBuffer& target, const FrameBufferSpecification& spec)
+  {
+    const auto& targetSpec = target.getSpecification();
+    const auto& capacity = target.getCapacity();
+    if (
+      targetSpec.sampleCount != spec.sampleCount ||
+      capacity.x < spec.size.x || capacity.y < spec.size.y ||
+      targetSpec.attachmentSpec.attachments.size() != spec.attachmentSpec.attachments.size()
+    ) {
+      return false;
+    }
+
+    return std::equal(
+      targetSpec.attachmentSpec.attachments.begin(), targetSpec.attachmentSpec.attachments.end(),
+      spec.attachmentSpec.attachments.begin(),
+      [] (const FrameBufferTextureSpecification& left, const FrameBufferTextureSpecification& right)
+      {
+        return left.textureFormat == right.textureFormat;
+      }
+    );
+  }
+
+  void RenderTargetPool::count ()
+  {
+    s_stats.pooledCount = s_entries.size();
+    s_stats.acquiredCount = 0;
+    s_stats.byteCount = 0;
+
+    for (const auto& entry : s_entries) {
+      if (entry.acquired == true) {
+        s_stats.acquiredCount++;
+      }
+
+      // Every attachment format uses four bytes per pixel, per sample.
+      const auto& spec = entry.target->getSpecification();
+      const auto& capacity = entry.target->getCapacity();
+      s_stats.byteCount += static_cast<Size>(capacity.x) * capacity.y * 4 *
+        spec.attachmentSpec.attachments.size() * std::max(spec.sampleCount, 1u);
+    }
+  }
+
+}
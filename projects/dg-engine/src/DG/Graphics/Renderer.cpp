@@ -1,6 +1,7 @@
 /** @file DG/Graphics/Renderer.cpp */
 
 #include <DG/Graphics/Renderer.hpp>
+#include <DG/Graphics/FrameCapture.hpp>
 
 namespace dg
 {
@@ -9,7 +10,12 @@ namespace dg
 
   Renderer::Renderer (const RendererSpecification& spec)
   {
-    RenderInterface::initialize();
+    RenderInterface::initialize(spec.backend, spec.thread);
+    ShaderCache::initialize(spec.shaderCache);
+    TextureUploadQueue::initialize(spec.uploads);
+    TextureResidency::initialize(spec.residency);
+    RenderTargetPool::initialize(spec.targets);
+    DynamicResolution::initialize(spec.resolution);
 
     // First, create the blank, white texture(s).
     Uint32 blankTextureData = 0xFFFFFFFF;
@@ -66,7 +72,13 @@ namespace dg
 
   Renderer::~Renderer ()
   {
-    
+    FrameCapture::shutdown();
+    DynamicResolution::shutdown();
+    PixelReadback::shutdown();
+    RenderTargetPool::shutdown();
+    TextureResidency::shutdown();
+    TextureUploadQueue::shutdown();
+    ShaderCache::shutdown();
   }
 
   Scope<Renderer> Renderer::make (const RendererSpecification& spec)
@@ -76,7 +88,8 @@ namespace dg
 
   /** Use Shaders / Frame Buffer ******************************************************************/
 
-  void Renderer::useFrameBuffer2D (const Ref<FrameBuffer>& framebuffer)
+  void Renderer::useFrameBuffer2D (const Ref<FrameBuffer>& framebuffer,
+    const RenderPassDescriptor& pass)
   {
     // Ensure that a valid frame buffer has been provided!
     if (framebuffer == nullptr) {
@@ -84,13 +97,21 @@ namespace dg
     }
 
     // If the frame buffer is being swapped out in the middle of rendering a scene, then we need to
-    // flush the current rendering batch, first.
+    // flush the current rendering batch and end the old frame buffer's pass, first. The rest of
+    // the scene is rendered in a new pass on the new frame buffer.
     if (m_renderData2D.sceneHasStarted == true) {
       flushScene2D(true);
+      m_renderData2D.framebuffer->endPass(m_renderData2D.pass);
+      m_renderData2D.framebuffer = framebuffer;
+      m_renderData2D.pass = pass;
+      m_renderData2D.framebuffer->beginPass(m_renderData2D.pass);
+      return;
     }
 
-    // Swap out, then bind the new framebuffer.
+    // Swap out, then bind the new framebuffer. Its attachments are prepared when the next scene
+    // begins.
     m_renderData2D.framebuffer = framebuffer;
+    m_renderData2D.pass = pass;
     m_renderData2D.framebuffer->bind();
   }
 
@@ -149,6 +170,11 @@ namespace dg
     m_renderData2D.cameraProduct = cameraProduct;
     m_renderData2D.quadShader->setUniform<Matrix4f>("uni_CameraProduct", m_renderData2D.cameraProduct);
 
+    // Begin the frame buffer's render pass, clearing whichever attachments it asks for, and time
+    // the scene on the graphics card so that its resolution can adapt.
+    m_renderData2D.framebuffer->beginPass(m_renderData2D.pass);
+    DynamicResolution::beginTiming();
+
     // Reset the rendering statistics and mark the scene as started.
     m_renderData2D.quadVertexCount = 0;
     m_renderData2D.batchVertexCount = 0;
@@ -158,6 +184,8 @@ namespace dg
     m_renderData2D.totalIndexCount = 0;
     m_renderData2D.batchTextureCount = 1;
     m_renderData2D.batchCount = 0;
+    m_renderData2D.culledCount = 0;
+    m_renderData2D.cullToView = false;
     m_renderData2D.sceneHasStarted = true;
   }
 
@@ -166,6 +194,13 @@ namespace dg
     beginScene2D(projection * glm::inverse(view));
   }
 
+  void Renderer::beginScene2D (const OrthographicCamera2D& camera)
+  {
+    beginScene2D(camera.getViewProjection());
+    m_renderData2D.viewBounds = camera.getBounds();
+    m_renderData2D.cullToView = true;
+  }
+
   void Renderer::flushScene2D (Bool flushingEarly)
   {
 
@@ -214,8 +249,10 @@ namespace dg
       throw std::runtime_error { "Attempt to end a 2D scene without first starting one!" };
     }
 
-    // Flush the current rendering batch.
+    // Flush the current rendering batch, then end the render pass.
     flushScene2D(false);
+    DynamicResolution::endTiming();
+    m_renderData2D.framebuffer->endPass(m_renderData2D.pass);
 
     m_renderData2D.sceneHasStarted = false;
 
@@ -224,38 +261,117 @@ namespace dg
   /** 2D Submission Functions *********************************************************************/
 
   void Renderer::submitQuad2D (const Matrix4f& transform, const RenderDrawSpecification2D& spec)
+  {
+    const Vector3f corners[4] = {
+      transform * m_renderData2D.quadVertexPositions[0],
+      transform * m_renderData2D.quadVertexPositions[1],
+      transform * m_renderData2D.quadVertexPositions[2],
+      transform * m_renderData2D.quadVertexPositions[3]
+    };
+
+    submitQuadCorners2D(corners, spec);
+  }
+
+  void Renderer::submitQuad2D (const Vector3f& position, const Vector2f& size, 
+    const Float32 rotation, const RenderDrawSpecification2D& spec)
+  {
+    submitQuad2D(Transform2D::fromPositionRotationScale({ position.x, position.y }, rotation, size),
+      position.z, spec);
+  }
+
+  void Renderer::submitQuad2D (const Transform2D& transform, const Float32 depth,
+    const RenderDrawSpecification2D& spec)
+  {
+    Vector3f corners[4];
+    getQuadCorners2D(transform, depth, corners);
+    submitQuadCorners2D(corners, spec);
+  }
+
+  void Renderer::submitSprites2D (const TransformComponent* transforms,
+    const SpriteRendererComponent* sprites, const entt::entity* entities, const Count count)
+  {
+    // Ensure that a scene is currently underway!
+    if (m_renderData2D.sceneHasStarted == false) {
+      throw std::runtime_error { "Attempt to submit a 2D scene with no scene started!" };
+    }
+
+    // Neighbouring sprites often share a texture, so the last one's slot is kept until the
+    // texture changes, or the batch is flushed.
+    const Texture* lastTexture = nullptr;
+    Count lastBatch = m_renderData2D.batchCount;
+    Float32 textureIndex = 0.0f;
+
+    for (Index i = 0; i < count; ++i) {
+      Vector3f corners[4];
+      getQuadCorners2D(transforms[i].transform, transforms[i].depth, corners);
+      if (cullQuad2D(corners) == true) {
+        continue;
+      }
+
+      const SpriteRendererComponent& sprite = sprites[i];
+      const Ref<Texture>& texture = (sprite.subTexture != nullptr) ?
+        sprite.subTexture->getTexture() : sprite.texture;
+      const Vector2f* textureCoordinates = (sprite.subTexture != nullptr) ?
+        sprite.subTexture->getTextureCoordinates() : m_renderData2D.quadTextureCoordinates;
+      if (texture.get() != lastTexture || m_renderData2D.batchCount != lastBatch) {
+        textureIndex = static_cast<Float32>(slotTexture2D(texture));
+        lastTexture = texture.get();
+        lastBatch = m_renderData2D.batchCount;
+      }
+
+      // The entity's index, without its version, is used as its ID, so that it survives being
+      // stored as a floating point.
+      writeQuad2D(corners, textureCoordinates, textureIndex, sprite.color,
+        static_cast<Float32>(entt::to_entity(entities[i])));
+    }
+  }
+
+  /** Vertex Submission Functions *****************************************************************/
+
+  void Renderer::submitQuadVertex2D (const QuadVertex2D& vertex)
+  {
+    m_renderData2D.quadVertices[m_renderData2D.quadVertexCount++] = vertex;
+    m_renderData2D.batchVertexCount++;
+    m_renderData2D.totalVertexCount++;
+  }
+
+  void Renderer::submitQuadCorners2D (const Vector3f* corners,
+    const RenderDrawSpecification2D& spec)
   {
     // Ensure that a scene is currently underway!
     if (m_renderData2D.sceneHasStarted == false) {
       throw std::runtime_error { "Attempt to submit a 2D scene with no scene started!" };
     }
 
+    // Skip the quad if the scene's camera cannot see any part of it.
+    if (cullQuad2D(corners) == true) {
+      return;
+    }
+
+    // A sub-texture brings its own texture coordinates; otherwise, the whole texture is used.
+    const Ref<Texture>& texture = (spec.subTexture != nullptr) ?
+      spec.subTexture->getTexture() : spec.texture;
+    const Vector2f* textureCoordinates = (spec.subTexture != nullptr) ?
+      spec.subTexture->getTextureCoordinates() : m_renderData2D.quadTextureCoordinates;
+
     // Slot the texture into place, if provided. Cast the slot number, and the entity ID into a
     // floating point.
-    Float32 textureIndex  = static_cast<Float32>(slotTexture2D(spec.texture));
+    Float32 textureIndex  = static_cast<Float32>(slotTexture2D(texture));
     Float32 entityId      = static_cast<Float32>(spec.entityId);
 
+    writeQuad2D(corners, textureCoordinates, textureIndex, spec.color, entityId);
+  }
+
+  void Renderer::writeQuad2D (const Vector3f* corners, const Vector2f* textureCoordinates,
+    const Float32 textureIndex, const Vector4f& color, const Float32 entityId)
+  {
     // Submit the quad's vertices.
-    submitQuadVertex2D(QuadVertex2D {
-      transform * m_renderData2D.quadVertexPositions[0],
-      m_renderData2D.quadTextureCoordinates[0],
-      textureIndex, spec.color, entityId
-    });
-    submitQuadVertex2D(QuadVertex2D {
-      transform * m_renderData2D.quadVertexPositions[1],
-      m_renderData2D.quadTextureCoordinates[1],
-      textureIndex, spec.color, entityId
-    });
-    submitQuadVertex2D(QuadVertex2D {
-      transform * m_renderData2D.quadVertexPositions[2],
-      m_renderData2D.quadTextureCoordinates[2],
-      textureIndex, spec.color, entityId
-    });
-    submitQuadVertex2D(QuadVertex2D {
-      transform * m_renderData2D.quadVertexPositions[3],
-      m_renderData2D.quadTextureCoordinates[3],
-      textureIndex, spec.color, entityId
-    });
+    for (Index i = 0; i < 4; ++i) {
+      submitQuadVertex2D(QuadVertex2D {
+        corners[i], textureCoordinates[i],
+        textureIndex, color, entityId
+      });
+    }
 
     // Update the quad index counts.
     m_renderData2D.quadIndexCount += 6;
@@ -272,33 +388,54 @@ namespace dg
     }
   }
 
-  void Renderer::submitQuad2D (const Vector3f& position, const Vector2f& size, 
-    const Float32 rotation, const RenderDrawSpecification2D& spec)
-  {
-    Matrix4f transform = 
-      glm::translate(Matrix4f(1.0f), position) *
-      glm::rotate(Matrix4f(1.0f), glm::radians(rotation), { 0.0f, 0.0f, 1.0f }) *
-      glm::scale(Matrix4f(1.0f), { size.x, size.y, 1.0f });
+  /** Other Private Functions *********************************************************************/
 
-    submitQuad2D(transform, spec);
+  void Renderer::getQuadCorners2D (const Transform2D& transform, const Float32 depth,
+    Vector3f* corners)
+  {
+    // The quad's corners lie half an axis either side of its origin, along each axis.
+    const Vector2f halfX = transform.axisX * 0.5f;
+    const Vector2f halfY = transform.axisY * 0.5f;
+    const Vector2f bottom = transform.origin - halfY;
+    const Vector2f top = transform.origin + halfY;
+    corners[0] = { bottom - halfX, depth };
+    corners[1] = { bottom + halfX, depth };
+    corners[2] = { top + halfX, depth };
+    corners[3] = { top - halfX, depth };
   }
 
-  /** Vertex Submission Functions *****************************************************************/
-
-  void Renderer::submitQuadVertex2D (const QuadVertex2D& vertex)
+  Bool Renderer::cullQuad2D (const Vector3f* corners)
   {
-    m_renderData2D.quadVertices[m_renderData2D.quadVertexCount++] = vertex;
-    m_renderData2D.batchVertexCount++;
-    m_renderData2D.totalVertexCount++;
-  }
+    if (m_renderData2D.cullToView == false) {
+      return false;
+    }
 
-  /** Other Private Functions *********************************************************************/
+    const AABB2D bounds {
+      glm::min(glm::min(Vector2f { corners[0] }, Vector2f { corners[1] }),
+        glm::min(Vector2f { corners[2] }, Vector2f { corners[3] })),
+      glm::max(glm::max(Vector2f { corners[0] }, Vector2f { corners[1] }),
+        glm::max(Vector2f { corners[2] }, Vector2f { corners[3] }))
+    };
+    if (m_renderData2D.viewBounds.overlaps(bounds) == true) {
+      return false;
+    }
+
+    m_renderData2D.culledCount++;
+    return true;
+  }
 
   Index Renderer::slotTexture2D (const Ref<Texture>& texture)
   {
 
-    // If the texture given is null or invalid, then return the slot of the blank, white texture.
-    if (texture == nullptr || texture->isValid() == false) {
+    // If the texture given is null, then return the slot of the blank, white texture.
+    if (texture == nullptr) {
+      return 0;
+    }
+
+    // Stamp the texture as drawn in this frame, loading it again if it has been evicted. Until it
+    // is valid again, return the slot of the blank, white texture.
+    TextureResidency::touch(texture);
+    if (texture->isValid() == false) {
       return 0;
     }
 
@@ -1,7 +1,10 @@
 /** @file DG/Graphics/Shader.cpp */
 
+#include <DG/Core/AssetLoader.hpp>
 #include <DG/Core/FileIo.hpp>
 #include <DG/Graphics/Shader.hpp>
+#include <DG/Graphics/ShaderCache.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
 
 namespace dg
 {
@@ -15,7 +18,12 @@ namespace dg
 
   Shader::~Shader ()
   {
-    glDeleteProgram(m_handle);
+    if (m_pendingHandle != 0) {
+      RenderInterface::getBackend().destroyProgram(m_pendingHandle);
+    }
+    if (m_handle != 0) {
+      RenderInterface::getBackend().destroyProgram(m_handle);
+    }
   }
 
   Ref<Shader> Shader::make (const String& vertexCode, const String& fragmentCode)
@@ -34,33 +42,122 @@ namespace dg
 
   void Shader::bind () const
   {
-    glUseProgram(m_handle);
+    RenderInterface::getBackend().useProgram(m_handle);
   }
 
   void Shader::unbind ()
   {
-    glUseProgram(0);
+    RenderInterface::getBackend().useProgram(0);
   }
   
   Boolean Shader::loadFromSources (const String& vertexCode, const String& fragmentCode)
   {
+    // A build already under way is for source code which is now out of date.
+    if (m_pendingHandle != 0) {
+      RenderInterface::getBackend().destroyProgram(m_pendingHandle);
+      m_pendingHandle = 0;
+    }
+
     m_vertexCode = vertexCode;
     m_fragmentCode = fragmentCode;
 
     return build();
   }
 
+  Boolean Shader::loadFromSourcesAsync (const String& vertexCode, const String& fragmentCode)
+  {
+    if (vertexCode.empty()) {
+      DG_ENGINE_ERROR("No vertex shader code provided.");
+      return false;
+    } else if (fragmentCode.empty()) {
+      DG_ENGINE_ERROR("No fragment shader code provided.");
+      return false;
+    }
+
+    // A build already under way is for source code which is now out of date.
+    auto& backend = RenderInterface::getBackend();
+    if (m_pendingHandle != 0) {
+      backend.destroyProgram(m_pendingHandle);
+      m_pendingHandle = 0;
+    }
+
+    m_vertexCode = vertexCode;
+    m_fragmentCode = fragmentCode;
+
+    // A cached binary is loaded right away, since there is nothing to wait on.
+    Uint32 shaderProgram = ShaderCache::load(m_vertexCode, m_fragmentCode);
+    if (shaderProgram != 0) {
+      if (m_handle != 0) {
+        backend.destroyProgram(m_handle);
+      }
+
+      m_handle = shaderProgram;
+      return true;
+    }
+
+    m_pendingHandle = backend.beginProgram(m_vertexCode, m_fragmentCode);
+    return true;
+  }
+
+  ProgramStatus Shader::poll (Bool wait)
+  {
+    if (m_pendingHandle == 0) {
+      return (m_handle != 0) ? ProgramStatus::Linked : ProgramStatus::Failed;
+    }
+
+    auto& backend = RenderInterface::getBackend();
+    ProgramStatus status = backend.pollProgram(m_pendingHandle, wait);
+    if (status == ProgramStatus::Pending) {
+      return status;
+    }
+
+    // The backend has already destroyed a program which failed to build.
+    Uint32 shaderProgram = m_pendingHandle;
+    m_pendingHandle = 0;
+    if (status == ProgramStatus::Failed) {
+      return status;
+    }
+
+    ShaderCache::store(shaderProgram, m_vertexCode, m_fragmentCode);
+    if (m_handle != 0) {
+      backend.destroyProgram(m_handle);
+    }
+
+    m_handle = shaderProgram;
+    return status;
+  }
+
   Boolean Shader::loadFromFile (const Path& path)
+  {
+    ShaderSources sources;
+    if (readFile(path, sources) == false) {
+      return false;
+    }
+
+    return loadFromSources(sources.vertexCode, sources.fragmentCode);
+  }
+
+  Boolean Shader::readFile (const Path& path, ShaderSources& sources)
   {
     String* codePtr = nullptr;
 
-    Boolean result = FileIo::loadTextFile(
+    return FileIo::loadTextFile(
       path,
       [&] (StringView line, Index number)
       {
-        if (line.starts_with("#shader ")){
-          if (line.ends_with("vertex")) { codePtr = &m_vertexCode; }
-          else if (line.ends_with("fragment")) { codePtr = &m_fragmentCode; }
+        if (line.starts_with("#feature ")) {
+          String name { line.substr(9) };
+          name.erase(0, name.find_first_not_of(" \t"));
+          name.erase(name.find_last_not_of(" \t\r") + 1);
+          if (name.empty()) {
+            DG_ENGINE_ERROR("Blank #feature directive.");
+            return false;
+          }
+
+          sources.features.push_back(name);
+        } else if (line.starts_with("#shader ")){
+          if (line.ends_with("vertex")) { codePtr = &sources.vertexCode; }
+          else if (line.ends_with("fragment")) { codePtr = &sources.fragmentCode; }
           else {
             DG_ENGINE_ERROR("Invalid #shader directive.");
             return false;
@@ -78,11 +175,9 @@ namespace dg
         return true;
       }
     );
-
-    return result == true && build();
   }
 
-  #define DG_UNIFORM_LOCATION(type, gl_func, ...) \
+  #define DG_UNIFORM_LOCATION(type, uniform_type, ...) \
     template <> \
     void Shader::setUniform<type> ( \
       const String& name, \
@@ -93,43 +188,41 @@ namespace dg
         DG_ENGINE_CRIT("Attempt to set uniform '{}' on invalid shader!", name); \
         throw std::runtime_error { "Attempt to set uniform on invalid shader!" }; \
       } \
-      glUseProgram(m_handle); \
-      auto location = findUniform(name); \
-      if (location != -1) { \
-        gl_func(location, __VA_ARGS__); \
-      } \
+      const auto data = __VA_ARGS__; \
+      RenderInterface::getBackend().setUniform(m_handle, name, \
+        ShaderUniformType::uniform_type, &data); \
     }
 
-  DG_UNIFORM_LOCATION(Float32,   glUniform1f, value)
-  DG_UNIFORM_LOCATION(Vector2f,  glUniform2f, value.x, value.y)
-  DG_UNIFORM_LOCATION(Vector3f,  glUniform3f, value.x, value.y, value.z)
-  DG_UNIFORM_LOCATION(Vector4f,  glUniform4f, value.x, value.y, value.z, value.w)
-  DG_UNIFORM_LOCATION(Matrix2f,  glUniformMatrix2fv, 1, GL_FALSE, (float*) &value)
-  DG_UNIFORM_LOCATION(Matrix3f,  glUniformMatrix3fv, 1, GL_FALSE, (float*) &value)
-  DG_UNIFORM_LOCATION(Matrix4f,  glUniformMatrix4fv, 1, GL_FALSE, (float*) &value)
-
-  DG_UNIFORM_LOCATION(Float64,   glUniform1d, value)
-  DG_UNIFORM_LOCATION(Vector2d,  glUniform2d, value.x, value.y)
-  DG_UNIFORM_LOCATION(Vector3d,  glUniform3d, value.x, value.y, value.z)
-  DG_UNIFORM_LOCATION(Vector4d,  glUniform4d, value.x, value.y, value.z, value.w)
-  DG_UNIFORM_LOCATION(Matrix2d,  glUniformMatrix2dv, 1, GL_FALSE, (double*) &value)
-  DG_UNIFORM_LOCATION(Matrix3d,  glUniformMatrix3dv, 1, GL_FALSE, (double*) &value)
-  DG_UNIFORM_LOCATION(Matrix4d,  glUniformMatrix4dv, 1, GL_FALSE, (double*) &value)
-
-  DG_UNIFORM_LOCATION(Int32,     glUniform1i, value)
-  DG_UNIFORM_LOCATION(Vector2i,  glUniform2i, value.x, value.y)
-  DG_UNIFORM_LOCATION(Vector3i,  glUniform3i, value.x, value.y, value.z)
-  DG_UNIFORM_LOCATION(Vector4i,  glUniform4i, value.x, value.y, value.z, value.w)
-
-  DG_UNIFORM_LOCATION(Uint32,    glUniform1ui, value)
-  DG_UNIFORM_LOCATION(Vector2u,  glUniform2ui, value.x, value.y)
-  DG_UNIFORM_LOCATION(Vector3u,  glUniform3ui, value.x, value.y, value.z)
-  DG_UNIFORM_LOCATION(Vector4u,  glUniform4ui, value.x, value.y, value.z, value.w)
-
-  DG_UNIFORM_LOCATION(Boolean,   glUniform1i, value)
-  DG_UNIFORM_LOCATION(Vector2b,  glUniform2i, value.x, value.y)
-  DG_UNIFORM_LOCATION(Vector3b,  glUniform3i, value.x, value.y, value.z)
-  DG_UNIFORM_LOCATION(Vector4b,  glUniform4i, value.x, value.y, value.z, value.w)
+  DG_UNIFORM_LOCATION(Float32,   Float,     value)
+  DG_UNIFORM_LOCATION(Vector2f,  Float2,    value)
+  DG_UNIFORM_LOCATION(Vector3f,  Float3,    value)
+  DG_UNIFORM_LOCATION(Vector4f,  Float4,    value)
+  DG_UNIFORM_LOCATION(Matrix2f,  Float2x2,  value)
+  DG_UNIFORM_LOCATION(Matrix3f,  Float3x3,  value)
+  DG_UNIFORM_LOCATION(Matrix4f,  Float4x4,  value)
+
+  DG_UNIFORM_LOCATION(Float64,   Double,    value)
+  DG_UNIFORM_LOCATION(Vector2d,  Double2,   value)
+  DG_UNIFORM_LOCATION(Vector3d,  Double3,   value)
+  DG_UNIFORM_LOCATION(Vector4d,  Double4,   value)
+  DG_UNIFORM_LOCATION(Matrix2d,  Double2x2, value)
+  DG_UNIFORM_LOCATION(Matrix3d,  Double3x3, value)
+  DG_UNIFORM_LOCATION(Matrix4d,  Double4x4, value)
+
+  DG_UNIFORM_LOCATION(Int32,     Int,       value)
+  DG_UNIFORM_LOCATION(Vector2i,  Int2,      value)
+  DG_UNIFORM_LOCATION(Vector3i,  Int3,      value)
+  DG_UNIFORM_LOCATION(Vector4i,  Int4,      value)
+
+  DG_UNIFORM_LOCATION(Uint32,    Uint,      value)
+  DG_UNIFORM_LOCATION(Vector2u,  Uint2,     value)
+  DG_UNIFORM_LOCATION(Vector3u,  Uint3,     value)
+  DG_UNIFORM_LOCATION(Vector4u,  Uint4,     value)
+
+  DG_UNIFORM_LOCATION(Boolean,   Int,       static_cast<Int32>(value))
+  DG_UNIFORM_LOCATION(Vector2b,  Int2,      Vector2i { value })
+  DG_UNIFORM_LOCATION(Vector3b,  Int3,      Vector3i { value })
+  DG_UNIFORM_LOCATION(Vector4b,  Int4,      Vector4i { value })
 
   #undef DG_UNIFORM_LOCATION  
 
@@ -138,11 +231,13 @@ namespace dg
     return m_handle != 0;
   }
 
-  Boolean Shader::build ()
+  Boolean Shader::isPending () const
   {
-    // The length of the status info log string.
-    static constexpr Int32 INFO_LOG_LENGTH = 512;
+    return m_pendingHandle != 0;
+  }
 
+  Boolean Shader::build ()
+  {
     // Ensure that both vertex and fragment shader code was provided.
     if (m_vertexCode.empty()) {
       DG_ENGINE_ERROR("No vertex shader code provided.");
@@ -152,84 +247,28 @@ namespace dg
       return false;
     }
 
-    // Keep track of a status code and an info log.
-    Int32 status = 0;
-    char infoLog[INFO_LOG_LENGTH];
-
-    // We will need the C-string forms of the shader's source code strings.
-    const char* vertexCode = m_vertexCode.c_str();
-    const char* fragmentCode = m_fragmentCode.c_str();
-
-    // Begin by compiling the vertex shader code, then check the compilation
-    // status.
-    Uint32 vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexCode, nullptr);
-    glCompileShader(vertexShader);
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &status);
-    glGetShaderInfoLog(vertexShader, INFO_LOG_LENGTH, nullptr, infoLog);
-    if (status != GL_TRUE) {
-      DG_ENGINE_ERROR("Error compiling GLSL vertex shader: {}", infoLog);
-      glDeleteShader(vertexShader);
-      return false;
-    } else if (infoLog[0] != '\0') {
-      DG_ENGINE_WARN("GLSL vertex shader compiled with warning: {}", infoLog);
-    }
-
-    // Repeat this now for the fragment shader.
-    Uint32 fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentCode, nullptr);
-    glCompileShader(fragmentShader);
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &status);
-    glGetShaderInfoLog(fragmentShader, INFO_LOG_LENGTH, nullptr, infoLog);
-    if (status != GL_TRUE) {
-      DG_ENGINE_ERROR("Error compiling GLSL fragment shader: {}", infoLog);
-      glDeleteShader(vertexShader);
-      glDeleteShader(fragmentShader);
-      return false;
-    } else if (infoLog[0] != '\0') {
-      DG_ENGINE_WARN("GLSL fragment shader compiled with warning: {}", infoLog);
-    }
+    // Load the shader program from its cached binary if there is one. Otherwise, compile and link
+    // it on the graphics card, then cache its binary for next time.
+    Uint32 shaderProgram = ShaderCache::load(m_vertexCode, m_fragmentCode);
+    if (shaderProgram == 0) {
+      shaderProgram = RenderInterface::getBackend().createProgram(m_vertexCode, m_fragmentCode);
+      if (shaderProgram == 0) {
+        return false;
+      }
 
-    // Next, create the shader program and attach the above-compiled shaders
-    // to it.
-    Uint32 shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-
-    // Link the program, then check status.
-    glLinkProgram(shaderProgram);
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
-    glGetProgramInfoLog(shaderProgram, INFO_LOG_LENGTH, nullptr, infoLog);
-    if (status != GL_TRUE) {
-      DG_ENGINE_ERROR("Error linking GLSL shader program: {}", infoLog);
-      glDeleteProgram(shaderProgram);
-      glDeleteShader(vertexShader);
-      glDeleteShader(fragmentShader);
-      return false;
-    } else if (infoLog[0] != '\0') {
-      DG_ENGINE_WARN("GLSL shader program linked with warning: {}", infoLog);
+      ShaderCache::store(shaderProgram, m_vertexCode, m_fragmentCode);
     }
 
-    // Delete the shader objects now.
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
     // Now that the new shader program has been successfully built, if there was another shader
     // program present, delete that program now.
     if (m_handle != 0) {
-      glDeleteProgram(m_handle);
+      RenderInterface::getBackend().destroyProgram(m_handle);
     }
 
     m_handle = shaderProgram;
     return true; 
   }
 
-  Int32 Shader::findUniform (StringView name)
-  {
-    if (isValid() == false || name.empty()) { return -1; }
-    return glGetUniformLocation(m_handle, name.data());
-  }
-
   Ref<Shader> ShaderManager::getOrEmplace (const String& filename)
   {
     // Ensure that the relative filename string is provided.
@@ -237,9 +276,22 @@ namespace dg
       throw std::invalid_argument { "Attempted 'getOrEmplace' with a blank filename string!" };
     }
 
-    // Check to see if the shader asset is present. If so, then return it.
+    // Check to see if the shader asset is present. If so, then return it, first finishing its
+    // load if it is still loading in the background.
     auto iter = s_assets.find(filename);
-    if (iter != s_assets.end()) { return iter->second; }
+    if (iter != s_assets.end()) {
+      if (AssetLoader::isLoading(filename) == false) { return iter->second; }
+
+      Ref<Shader> shader = iter->second;
+      AssetLoader::wait(filename);
+      if (shader->isValid() == false) {
+        s_assets.erase(filename);
+        DG_ENGINE_CRIT("Could not load shader asset file '{}'!", filename);
+        throw std::runtime_error { "Could not load shader asset file!" };
+      }
+
+      return shader;
+    }
 
     // Create the shader. Ensure that it is valid.
     Ref<Shader> shader = Shader::make(FileIo::getAbsolute(filename));
@@ -253,6 +305,37 @@ namespace dg
     return shader;
   }
 
+  Ref<Shader> ShaderManager::loadAsync (const String& filename)
+  {
+    // Ensure that the relative filename string is provided.
+    if (filename.empty()) {
+      throw std::invalid_argument { "Attempted 'loadAsync' with a blank filename string!" };
+    }
+
+    // Check to see if the shader asset is present. If so, then return it.
+    auto iter = s_assets.find(filename);
+    if (iter != s_assets.end()) { return iter->second; }
+
+    // Map an empty shader now. The source file is read on a worker thread, and the program is
+    // built on the main thread.
+    Ref<Shader> shader = makeRef<Shader>();
+    auto sources = makeRef<ShaderSources>();
+    AssetLoader::submit(
+      filename,
+      [sources, path = FileIo::getAbsolute(filename)] ()
+      {
+        return Shader::readFile(path, *sources);
+      },
+      [shader, sources] ()
+      {
+        return shader->loadFromSources(sources->vertexCode, sources->fragmentCode);
+      }
+    );
+
+    s_assets.emplace(filename, shader);
+    return shader;
+  }
+
   Boolean ShaderManager::contains (const String& filename)
   {
     // Ensure that the relative filename string is provided.
@@ -0,0 +1,206 @@
+/** @file DG/Graphics/ShaderCache.cpp */
+
+#include <DG/Core/MappedFile.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
+#include <DG/Graphics/ShaderCache.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static constexpr Uint32 SHADER_CACHE_MAGIC = 0x48534744;  // "DGSH"
+    static constexpr Uint32 SHADER_CACHE_VERSION = 1;
+    static constexpr Uint64 FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+    static constexpr Uint64 FNV_PRIME = 0x100000001B3;
+
+    struct ShaderCacheHeader
+    {
+      Uint32 magic = SHADER_CACHE_MAGIC;
+      Uint32 version = SHADER_CACHE_VERSION;
+      Uint32 format = 0;
+      Uint32 reserved = 0;
+      Uint64 key = 0;
+      Uint64 binarySize = 0;
+    };
+
+    static_assert(sizeof(ShaderCacheHeader) == 32, "Shader cache header must be 32 bytes!");
+
+    static Uint64 hashFnv1a (Uint64 hash, StringView text)
+    {
+      for (char character : text) {
+        hash ^= static_cast<Uint8>(character);
+        hash *= FNV_PRIME;
+      }
+
+      // Hash a terminator as well, so that moving text from one string to the next changes the
+      // hash.
+      hash ^= 0xFF;
+      hash *= FNV_PRIME;
+      return hash;
+    }
+
+  }
+
+  ShaderCacheSpecification ShaderCache::s_spec { false, "" };
+  String ShaderCache::s_deviceName = "";
+
+  void ShaderCache::initialize (const ShaderCacheSpecification& spec)
+  {
+    shutdown();
+
+    s_spec = spec;
+    if (s_spec.enabled == false) {
+      return;
+    }
+
+    std::error_code error;
+    fs::create_directories(s_spec.directory, error);
+    if (error) {
+      DG_ENGINE_WARN("Could not create shader cache directory '{}' - {}; disabling the cache.",
+        s_spec.directory.string(), error.message());
+      s_spec.enabled = false;
+    }
+  }
+
+  void ShaderCache::shutdown ()
+  {
+    s_spec.enabled = false;
+    s_deviceName.clear();
+  }
+
+  Bool ShaderCache::isEnabled ()
+  {
+    return s_spec.enabled;
+  }
+
+  Uint32 ShaderCache::load (const String& vertexCode, const String& fragmentCode)
+  {
+    if (s_spec.enabled == false) {
+      return 0;
+    }
+
+    const Uint64 key = getKey(vertexCode, fragmentCode);
+    const Path path = getCachePath(key);
+    std::error_code error;
+    if (fs::exists(path, error) == false) {
+      return 0;
+    }
+
+    auto file = MappedFile::make(path);
+    if (file == nullptr) {
+      return 0;
+    }
+
+    // Make sure that the file is a whole cache file for this key before handing it to the driver.
+    Private::ShaderCacheHeader header;
+    if (file->getSize() >= sizeof(header)) {
+      std::memcpy(&header, file->getData(), sizeof(header));
+    }
+
+    if (
+      header.magic != Private::SHADER_CACHE_MAGIC ||
+      header.version != Private::SHADER_CACHE_VERSION ||
+      header.key != key ||
+      header.binarySize == 0 ||
+      file->getSize() < sizeof(header) + header.binarySize
+    ) {
+      DG_ENGINE_WARN("Shader cache file '{}' is invalid; rebuilding from source.", path.string());
+      file.reset();
+      fs::remove(path, error);
+      return 0;
+    }
+
+    Uint32 program = RenderInterface::getBackend().createProgramFromBinary(header.format,
+      file->getData() + sizeof(header), header.binarySize);
+    if (program == 0) {
+      DG_ENGINE_WARN("Graphics driver rejected cached shader binary '{}'; rebuilding from source.",
+        path.string());
+      file.reset();
+      fs::remove(path, error);
+      return 0;
+    }
+
+    return program;
+  }
+
+  Bool ShaderCache::store (Uint32 program, const String& vertexCode, const String& fragmentCode)
+  {
+    if (s_spec.enabled == false || program == 0) {
+      return false;
+    }
+
+    Private::ShaderCacheHeader header;
+    Collection<Uint8> binary;
+    GLenum format = 0;
+    if (RenderInterface::getBackend().getProgramBinary(program, format, binary) == false) {
+      return false;
+    }
+
+    header.format = format;
+    header.key = getKey(vertexCode, fragmentCode);
+    header.binarySize = binary.size();
+
+    // Write to a temporary file first, so that a cache file is never seen half-written.
+    const Path path = getCachePath(header.key);
+    Path temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    {
+      std::fstream file { temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc };
+      if (file.is_open() == false) {
+        DG_ENGINE_WARN("Could not open shader cache file '{}' for writing.",
+          temporaryPath.string());
+        return false;
+      }
+
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+      if (file.good() == false) {
+        DG_ENGINE_WARN("Could not write shader cache file '{}'.", temporaryPath.string());
+        file.close();
+        fs::remove(temporaryPath);
+        return false;
+      }
+    }
+
+    std::error_code error;
+    fs::rename(temporaryPath, path, error);
+    if (error) {
+      DG_ENGINE_WARN("Could not move shader cache file into place at '{}' - {}", path.string(),
+        error.message());
+      fs::remove(temporaryPath, error);
+      return false;
+    }
+
+    return true;
+  }
+
+  Uint64 ShaderCache::getKey (const String& vertexCode, const String& fragmentCode)
+  {
+    // The device name never changes while the backend is up, so it is only asked for once.
+    if (s_deviceName.empty() == true) {
+      s_deviceName = RenderInterface::getBackend().getDeviceName();
+    }
+
+    Uint64 hash = Private::FNV_OFFSET_BASIS;
+    hash = Private::hashFnv1a(hash, vertexCode);
+    hash = Private::hashFnv1a(hash, fragmentCode);
+    hash = Private::hashFnv1a(hash, s_deviceName);
+    return hash;
+  }
+
+  Path ShaderCache::getCachePath (Uint64 key)
+  {
+    // Name the file by the key's sixteen hexadecimal digits.
+    static constexpr const char* DIGITS = "0123456789abcdef";
+    String name(16, '0');
+    for (Index i = 0; i < name.size(); ++i) {
+      name[name.size() - 1 - i] = DIGITS[(key >> (i * 4)) & 0xF];
+    }
+
+    return s_spec.directory / formatString("{}{}", name, SHADER_CACHE_EXTENSION);
+  }
+
+}
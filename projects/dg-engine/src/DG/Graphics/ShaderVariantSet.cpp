@@ -0,0 +1,189 @@
+/** @file DG/Graphics/ShaderVariantSet.cpp */
+
+#include <DG/Graphics/ShaderVariantSet.hpp>
+
+namespace dg
+{
+
+  Ref<ShaderVariantSet> ShaderVariantSet::make (const Path& path)
+  {
+    auto variantSet = makeRef<ShaderVariantSet>();
+    variantSet->loadFromFile(path);
+    return variantSet;
+  }
+
+  Ref<ShaderVariantSet> ShaderVariantSet::make (const String& vertexCode,
+    const String& fragmentCode, const Collection<String>& features)
+  {
+    auto variantSet = makeRef<ShaderVariantSet>();
+    variantSet->loadFromSources(vertexCode, fragmentCode, features);
+    return variantSet;
+  }
+
+  Boolean ShaderVariantSet::loadFromFile (const Path& path)
+  {
+    ShaderSources sources;
+    if (Shader::readFile(path, sources) == false) {
+      return false;
+    }
+
+    return loadFromSources(sources.vertexCode, sources.fragmentCode, sources.features);
+  }
+
+  Boolean ShaderVariantSet::loadFromSources (const String& vertexCode,
+    const String& fragmentCode, const Collection<String>& features)
+  {
+    if (vertexCode.empty()) {
+      DG_ENGINE_ERROR("No vertex shader code provided.");
+      return false;
+    } else if (fragmentCode.empty()) {
+      DG_ENGINE_ERROR("No fragment shader code provided.");
+      return false;
+    } else if (features.size() > MAX_FEATURES) {
+      DG_ENGINE_ERROR("Shader variant set has {} features; no more than {} are allowed.",
+        features.size(), MAX_FEATURES);
+      return false;
+    }
+
+    for (Index i = 0; i < features.size(); ++i) {
+      if (std::find(features.begin(), features.begin() + i, features[i]) !=
+        features.begin() + i) {
+        DG_ENGINE_ERROR("Shader feature '{}' is declared more than once.", features[i]);
+        return false;
+      }
+    }
+
+    m_vertexCode = vertexCode;
+    m_fragmentCode = fragmentCode;
+    m_features = features;
+    m_variants.clear();
+    return true;
+  }
+
+  Uint64 ShaderVariantSet::getMask (const Collection<String>& names) const
+  {
+    Uint64 mask = 0;
+    for (const auto& name : names) {
+      auto iter = std::find(m_features.begin(), m_features.end(), name);
+      if (iter == m_features.end()) {
+        DG_ENGINE_CRIT("Shader feature '{}' not found!", name);
+        throw std::invalid_argument { "Shader feature not found!" };
+      }
+
+      mask |= (Uint64 { 1 } << (iter - m_features.begin()));
+    }
+
+    return mask;
+  }
+
+  const Ref<Shader>& ShaderVariantSet::get (Uint64 mask)
+  {
+    checkMask(mask, "get");
+
+    Ref<Shader>& shader = begin(mask);
+    if (shader->poll(true) != ProgramStatus::Linked) {
+      DG_ENGINE_CRIT("Could not build shader variant {}!", mask);
+      throw std::runtime_error { "Could not build shader variant!" };
+    }
+
+    return shader;
+  }
+
+  void ShaderVariantSet::prepare (const Collection<Uint64>& masks)
+  {
+    for (Uint64 mask : masks) {
+      checkMask(mask, "prepare");
+    }
+
+    for (Uint64 mask : masks) {
+      begin(mask);
+    }
+  }
+
+  Boolean ShaderVariantSet::isReady (Uint64 mask)
+  {
+    auto iter = m_variants.find(mask);
+    if (iter == m_variants.end()) {
+      return false;
+    }
+
+    return iter->second->poll() == ProgramStatus::Linked;
+  }
+
+  Count ShaderVariantSet::update ()
+  {
+    Count pending = 0;
+    for (auto& [mask, shader] : m_variants) {
+      if (shader->isPending() == true && shader->poll() == ProgramStatus::Pending) {
+        pending++;
+      }
+    }
+
+    return pending;
+  }
+
+  const Collection<String>& ShaderVariantSet::getFeatures () const
+  {
+    return m_features;
+  }
+
+  Count ShaderVariantSet::getVariantCount () const
+  {
+    return m_variants.size();
+  }
+
+  void ShaderVariantSet::checkMask (Uint64 mask, const char* function) const
+  {
+    if (m_features.size() < MAX_FEATURES && (mask >> m_features.size()) != 0) {
+      DG_ENGINE_CRIT("Attempted '{}' with variant mask {}, but there are only {} features!",
+        function, mask, m_features.size());
+      throw std::invalid_argument { "Shader variant mask switches on unknown features!" };
+    }
+  }
+
+  String ShaderVariantSet::injectDefines (const String& code, Uint64 mask) const
+  {
+    String defines = "";
+    for (Index i = 0; i < m_features.size(); ++i) {
+      if ((mask & (Uint64 { 1 } << i)) != 0) {
+        defines += formatString("#define {} 1\n", m_features[i]);
+      }
+    }
+
+    if (defines.empty()) {
+      return code;
+    }
+
+    // GLSL requires the `#version` directive to come before anything else, so the defines go just
+    // after it. Source code without one has the defines put first.
+    Index position = 0;
+    Index version = code.find("#version");
+    if (version != String::npos) {
+      Index lineEnd = code.find('\n', version);
+      position = (lineEnd != String::npos) ? lineEnd + 1 : code.size();
+    }
+
+    String injected = code;
+    if (position == code.size() && code.ends_with('\n') == false) {
+      injected += '\n';
+      position++;
+    }
+
+    injected.insert(position, defines);
+    return injected;
+  }
+
+  Ref<Shader>& ShaderVariantSet::begin (Uint64 mask)
+  {
+    auto iter = m_variants.find(mask);
+    if (iter != m_variants.end()) {
+      return iter->second;
+    }
+
+    auto shader = makeRef<Shader>();
+    shader->loadFromSourcesAsync(injectDefines(m_vertexCode, mask),
+      injectDefines(m_fragmentCode, mask));
+    return m_variants.emplace(mask, shader).first->second;
+  }
+
+}
@@ -0,0 +1,108 @@
+/** @file DG/Graphics/SubTexture.cpp */
+
+#include <DG/Graphics/SubTexture.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static const Vector2u& getSizedTexture (const Ref<Texture>& texture, const char* function)
+    {
+      if (texture == nullptr) {
+        DG_ENGINE_CRIT("Attempted '{}' with null texture!", function);
+        throw std::invalid_argument { "Attempted sub-texture creation with null texture!" };
+      }
+
+      const Vector2u& size = texture->getSize();
+      if (size.x == 0 || size.y == 0) {
+        DG_ENGINE_CRIT("Attempted '{}' with texture which has no size yet!", function);
+        throw std::invalid_argument { "Attempted sub-texture creation with unsized texture!" };
+      }
+
+      return size;
+    }
+
+  }
+
+  SubTexture::SubTexture (const Ref<Texture>& texture, const Vector2f& minimum,
+    const Vector2f& maximum) :
+    m_texture { texture }
+  {
+    m_textureCoordinates[0] = { minimum.x, minimum.y };
+    m_textureCoordinates[1] = { maximum.x, minimum.y };
+    m_textureCoordinates[2] = { maximum.x, maximum.y };
+    m_textureCoordinates[3] = { minimum.x, maximum.y };
+  }
+
+  Ref<SubTexture> SubTexture::make (const Ref<Texture>& texture, const Vector2f& minimum,
+    const Vector2f& maximum)
+  {
+    if (texture == nullptr) {
+      throw std::invalid_argument { "Attempted sub-texture creation with null texture!" };
+    }
+
+    return makeRef<SubTexture>(texture, minimum, maximum);
+  }
+
+  Ref<SubTexture> SubTexture::makeFromPixels (const Ref<Texture>& texture,
+    const Vector2f& position, const Vector2f& size)
+  {
+    const Vector2u& textureSize = Private::getSizedTexture(texture, "makeFromPixels");
+
+    // Textures are flipped as they are loaded, so that their bottom row comes first. Flip the
+    // rectangle to match.
+    const Float32 top = static_cast<Float32>(textureSize.y) - position.y;
+    return makeRef<SubTexture>(
+      texture,
+      texture->getTextureCoordinate({ position.x, top - size.y }),
+      texture->getTextureCoordinate({ position.x + size.x, top })
+    );
+  }
+
+  Ref<SubTexture> SubTexture::makeFromGrid (const Ref<Texture>& texture, const Vector2u& cell,
+    const Vector2u& cellSize, const Vector2u& span)
+  {
+    return makeFromPixels(
+      texture,
+      { static_cast<Float32>(cell.x * cellSize.x), static_cast<Float32>(cell.y * cellSize.y) },
+      { static_cast<Float32>(span.x * cellSize.x), static_cast<Float32>(span.y * cellSize.y) }
+    );
+  }
+
+  Collection<Ref<SubTexture>> SubTexture::slice (const Ref<Texture>& texture,
+    const Vector2u& cellSize, const Vector2u& spacing, const Vector2u& margin)
+  {
+    const Vector2u& textureSize = Private::getSizedTexture(texture, "slice");
+    if (cellSize.x == 0 || cellSize.y == 0) {
+      throw std::invalid_argument { "Attempted 'slice' with zero cell size!" };
+    }
+
+    Collection<Ref<SubTexture>> cells;
+    for (Uint32 y = margin.y; y + cellSize.y + margin.y <= textureSize.y;
+      y += cellSize.y + spacing.y) {
+      for (Uint32 x = margin.x; x + cellSize.x + margin.x <= textureSize.x;
+        x += cellSize.x + spacing.x) {
+        cells.push_back(makeFromPixels(
+          texture,
+          { static_cast<Float32>(x), static_cast<Float32>(y) },
+          { static_cast<Float32>(cellSize.x), static_cast<Float32>(cellSize.y) }
+        ));
+      }
+    }
+
+    return cells;
+  }
+
+  const Ref<Texture>& SubTexture::getTexture () const
+  {
+    return m_texture;
+  }
+
+  const Vector2f* SubTexture::getTextureCoordinates () const
+  {
+    return m_textureCoordinates;
+  }
+
+}
@@ -4,8 +4,12 @@
 #define STBI_FAILURE_USERMSG
 #include <stb_image.h>
 
+#include <DG/Core/AssetLoader.hpp>
 #include <DG/Core/FileIo.hpp>
 #include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureContainer.hpp>
+#include <DG/Graphics/TextureCooker.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
 
 namespace dg
 {
@@ -23,11 +27,25 @@ namespace dg
       }
     }
 
-    GLenum resolveGLTextureFilter (TextureFilterMode mode)
+    GLenum resolveGLTextureFilter (TextureFilterMode mode, Boolean mipmapped)
     {
+      // Without a mip chain to pick from, the mipmap modes fall back to their base filter.
+      if (mipmapped == false) {
+        switch (mode) {
+          case TextureFilterMode::Nearest:
+          case TextureFilterMode::NearestMipmapNearest:
+          case TextureFilterMode::NearestMipmapLinear:  return GL_NEAREST;
+          default:                                      return GL_LINEAR;
+        }
+      }
+
       switch (mode) {
-        case TextureFilterMode::Linear:   return GL_LINEAR;
-        case TextureFilterMode::Nearest:  return GL_NEAREST;
+        case TextureFilterMode::Linear:               return GL_LINEAR;
+        case TextureFilterMode::Nearest:              return GL_NEAREST;
+        case TextureFilterMode::NearestMipmapNearest: return GL_NEAREST_MIPMAP_NEAREST;
+        case TextureFilterMode::LinearMipmapNearest:  return GL_LINEAR_MIPMAP_NEAREST;
+        case TextureFilterMode::NearestMipmapLinear:  return GL_NEAREST_MIPMAP_LINEAR;
+        case TextureFilterMode::LinearMipmapLinear:   return GL_LINEAR_MIPMAP_LINEAR;
         default: return 0;
       }
     }
@@ -46,16 +64,112 @@ namespace dg
       return true;
     }
 
+    struct DecodedImage
+    {
+      PixelData pixels { nullptr, stbi_image_free };
+      Vector2u  size;
+      Uint32    colorChannels = 0;
+      GLenum    compressedFormat = 0;
+      Size      byteCount = 0;
+      Collection<TextureLevel> levels;
+    };
+
+    Boolean decodeImage (const Path& path, DecodedImage& image)
+    {
+      if (path.empty()) {
+        DG_ENGINE_ERROR("No image filename specified to load into the texture.");
+        return false;
+      }
+
+      if (fs::exists(path) == false) {
+        DG_ENGINE_ERROR("Image filename '{}' not found.", path.string());
+        return false;
+      }
+
+      // Texture container files need no decoding, so their pixel data is used straight from the
+      // mapped file, which is kept alive until the pixel data is freed. Files which had to be
+      // flipped hand over their flipped copy instead.
+      if (TextureContainer::isContainerPath(path) == true) {
+        MappedImage mapped;
+        if (TextureContainer::load(path, mapped) == false) {
+          return false;
+        }
+
+        if (mapped.pixels.empty() == false) {
+          auto pixels = makeRef<Collection<Uint8>>(std::move(mapped.pixels));
+          image.pixels = { pixels->data(), [pixels] (Uint8*) {} };
+          image.byteCount = pixels->size();
+        } else {
+          image.pixels = {
+            const_cast<Uint8*>(mapped.file->getData()),
+            [file = mapped.file] (Uint8*) {}
+          };
+          image.byteCount = mapped.file->getSize();
+        }
+
+        image.size = mapped.size;
+        image.colorChannels = mapped.colorChannels;
+        image.compressedFormat = mapped.compressedFormat;
+        image.levels = std::move(mapped.levels);
+        return true;
+      }
+
+      // Make sure that images are correctly flipped before any loading is done. Images may be
+      // decoded on several threads at once, so the setting is made for this thread only.
+      stbi_set_flip_vertically_on_load_thread(true);
+
+      // Store the image's width, height and color channel count here.
+      Int32 width = 0, height = 0, colorChannels = 0;
+      Uint8* data = stbi_load(path.c_str(), &width, &height, &colorChannels, 0);
+      if (data == nullptr) {
+        DG_ENGINE_ERROR("Could not load image file '{}' - {}", path.string(),
+          stbi_failure_reason());
+        return false;
+      }
+
+      image.pixels = { data, stbi_image_free };
+      image.size = { static_cast<Uint32>(width), static_cast<Uint32>(height) };
+      image.colorChannels = static_cast<Uint32>(colorChannels);
+      return true;
+    }
+
+    Boolean loadDecodedImage (Texture& texture, DecodedImage& image)
+    {
+      if (image.compressedFormat != 0) {
+        return texture.loadFromCompressed(std::move(image.pixels), image.size,
+          image.compressedFormat, image.byteCount, image.levels);
+      }
+
+      return texture.loadFromPixels(std::move(image.pixels), image.size, image.colorChannels,
+        image.levels);
+    }
+
+    void applyGLTextureParameters (Uint32 handle, const TextureSpecification& spec,
+      Count levelCount)
+    {
+      auto& backend = RenderInterface::getBackend();
+      backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_WRAP_S,
+        resolveGLTextureWrap(spec.wrap));
+      backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_WRAP_T,
+        resolveGLTextureWrap(spec.wrap));
+      backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_MIN_FILTER,
+        resolveGLTextureFilter(spec.minify, levelCount > 1));
+      backend.setTextureParameter(GL_TEXTURE_2D, handle, GL_TEXTURE_MAG_FILTER,
+        resolveGLTextureFilter(spec.magnify, false));
+    }
+
   }
 
   Texture::Texture ()
   {
-    glGenTextures(1, &m_handle);
+    m_handle = RenderInterface::getBackend().createTexture();
   }
 
   Texture::~Texture ()
   {
-    glDeleteTextures(1, &m_handle);
+    TextureResidency::untrack(*this);
+    TextureUploadQueue::cancel(*this);
+    RenderInterface::getBackend().destroyTexture(m_handle);
   }
 
   Ref<Texture> Texture::make ()
@@ -70,6 +184,32 @@ namespace dg
     return texture;
   }
 
+  Ref<Texture> Texture::make (const Path& path, const TextureSpecification& spec)
+  {
+    auto texture = makeRef<Texture>();
+    texture->m_spec = spec;
+    texture->loadFromFile(path);
+    return texture;
+  }
+
+  void Texture::loadAsync (const Ref<Texture>& texture, const Path& path, const String& key)
+  {
+    // The image is decoded on a worker thread, then handed to the texture on the main thread.
+    auto image = makeRef<Private::DecodedImage>();
+    texture->m_filepath = path;
+    AssetLoader::submit(
+      key,
+      [image, path] ()
+      {
+        return Private::decodeImage(TextureCooker::resolve(path), *image);
+      },
+      [texture, image] ()
+      {
+        return Private::loadDecodedImage(*texture, *image);
+      }
+    );
+  }
+
   void Texture::bind (const Index slot) const
   {
     if (slot >= TEXTURE_SLOT_COUNT) {
@@ -77,8 +217,7 @@ namespace dg
       throw std::out_of_range { "Attempted 'bind' of GL texture to invalid texture slot!" };
     }
     
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_handle);
+    RenderInterface::getBackend().bindTexture(GL_TEXTURE_2D, m_handle, slot);
   }
 
   void Texture::unbind (const Index slot) const
@@ -88,8 +227,7 @@ namespace dg
       throw std::out_of_range { "Attempted 'bind' of GL texture to invalid texture slot!" };
     }
     
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    RenderInterface::getBackend().bindTexture(GL_TEXTURE_2D, 0, slot);
   }
 
   Boolean Texture::createFromSpecification (const TextureSpecification& spec)
@@ -102,87 +240,191 @@ namespace dg
       return false;
     }
 
-    // Bind the texture, then set its wrap and filter modes.
-    glBindTexture(GL_TEXTURE_2D, m_handle);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, 
-      Private::resolveGLTextureWrap(spec.wrap));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, 
-      Private::resolveGLTextureWrap(spec.wrap));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, 
-      Private::resolveGLTextureFilter(spec.minify));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, 
-      Private::resolveGLTextureFilter(spec.magnify));
-  
-    // Set aside storage for the texture on the graphics card.
-    glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, spec.size.x, spec.size.y, 0, m_pixelFormat,
-      GL_UNSIGNED_BYTE, nullptr);
-      
+    // Discard any upload still pending from an earlier load.
+    TextureUploadQueue::cancel(*this);
+
+    // Set aside storage for the texture, and its mip chain if it has one, on the graphics card.
     m_spec = spec;
+    m_compressed = false;
+    allocateStorage(
+      (spec.mipmaps == true) ? TextureContainer::getFullLevelCount(spec.size) : 1
+    );
+      
     m_valid = true;
     return true;
   }
 
   Boolean Texture::loadFromFile (const Path& path)
   {
-    if (path.empty()) {
-      DG_ENGINE_ERROR("No image filename specified to load into the texture.");
+    Private::DecodedImage image;
+    if (Private::decodeImage(path, image) == false) {
       return false;
     }
 
-    if (fs::exists(path) == false) {
-      DG_ENGINE_ERROR("Image filename '{}' not found.", path);
+    m_filepath = path;
+
+    if (Private::loadDecodedImage(*this, image) == false) {
+      DG_ENGINE_ERROR("Could not create texture from image file '{}'.", path.string());
       return false;
     }
 
-    // Make sure that images are correctly flipped before any loading is done.
-    stbi_set_flip_vertically_on_load(true);
+    return true;
+  }
 
-    // Store the image's width, height and color channel count here.
-    Int32 width = 0, height = 0, colorChannels = 0;
-    Uint8* data = stbi_load(path.c_str(), &width, &height, &colorChannels, 0);
-    if (data == nullptr) {
-      DG_ENGINE_ERROR("Could not load image file '{}' - {}", path,
-        stbi_failure_reason());
+  Boolean Texture::loadFromPixels (PixelData pixels, const Vector2u& size,
+    const Uint32 colorChannels, const Collection<TextureLevel>& levels)
+  {
+    if (pixels == nullptr || size.x == 0 || size.y == 0) {
+      DG_ENGINE_ERROR("No pixel data specified to load into the texture.");
+      return false;
+    } else if (levels.size() > TextureContainer::getFullLevelCount(size)) {
+      DG_ENGINE_ERROR("Pixel data has too many mip levels for a {}x{} texture.", size.x, size.y);
       return false;
     }
 
     // Determine the pixel format from the given color channel count.
     if (Private::resolveGLTextureFormat(colorChannels, m_internalFormat, m_pixelFormat) == false)
     {
-      DG_ENGINE_ERROR("Image file '{}' has invalid color channel count {}.", path, colorChannels);
-      stbi_image_free(data);
+      DG_ENGINE_ERROR("Pixel data has invalid color channel count {}.", colorChannels);
       return false;
     }
 
-    m_spec.size = { static_cast<Uint32>(width), static_cast<Uint32>(height) };
-    m_spec.colorChannels = static_cast<Uint32>(colorChannels);
+    // Pixel data which brings only its base level has the rest of its mip chain generated on the
+    // graphics card, if the texture wants one.
+    Collection<TextureLevel> uploadLevels = levels;
+    if (uploadLevels.empty() == true) {
+      uploadLevels.push_back({ size, 0, static_cast<Size>(size.x) * size.y * colorChannels });
+    }
+
+    const Boolean generateMipmaps = (uploadLevels.size() == 1 && m_spec.mipmaps == true);
+    const Count levelCount = (generateMipmaps == true) ?
+      TextureContainer::getFullLevelCount(size) : uploadLevels.size();
+
+    // Discard any upload still pending from an earlier load, before its storage goes away.
+    TextureUploadQueue::cancel(*this);
 
-    // Bind the texture, then set its wrap and filter modes.
-    glBindTexture(GL_TEXTURE_2D, m_handle);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, Private::resolveGLTextureWrap(m_spec.wrap));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, Private::resolveGLTextureWrap(m_spec.wrap));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, Private::resolveGLTextureFilter(m_spec.minify));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, Private::resolveGLTextureFilter(m_spec.magnify));
+    m_spec.size = size;
+    m_spec.colorChannels = colorChannels;
+    m_compressed = false;
+    allocateStorage(levelCount);
   
-    // Set aside storage for the texture on the graphics card.
-    glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, m_spec.size.x, m_spec.size.y, 0, m_pixelFormat,
-      GL_UNSIGNED_BYTE, data);
+    // If uploads are queued, the image is uploaded over the next few frames; otherwise, upload it
+    // now.
+    if (TextureUploadQueue::isEnabled() == true) {
+      TextureUploadQueue::enqueue(*this, m_handle, std::move(pixels), uploadLevels,
+        m_pixelFormat, m_spec.colorChannels, generateMipmaps);
+      return true;
+    }
+
+    // Decoded pixel rows are tightly packed.
+    auto& backend = RenderInterface::getBackend();
+    backend.setPixelStore(GL_UNPACK_ALIGNMENT, 1);
+    for (Index i = 0; i < uploadLevels.size(); ++i) {
+      const auto& level = uploadLevels[i];
+      backend.uploadTexture2D(m_handle, { 0, 0 }, level.size, m_pixelFormat, GL_UNSIGNED_BYTE,
+        pixels.get() + level.offset, i);
+    }
+    backend.setPixelStore(GL_UNPACK_ALIGNMENT, 4);
+
+    if (generateMipmaps == true) {
+      backend.generateTextureMipmaps(m_handle);
+    }
       
     m_valid = true;
     return true;
   }
 
+  Boolean Texture::loadFromCompressed (PixelData data, const Vector2u& size,
+    const GLenum compressedFormat, const Size byteCount, const Collection<TextureLevel>& levels)
+  {
+    if (data == nullptr || size.x == 0 || size.y == 0) {
+      DG_ENGINE_ERROR("No compressed data specified to load into the texture.");
+      return false;
+    } else if (levels.size() > TextureContainer::getFullLevelCount(size)) {
+      DG_ENGINE_ERROR("Compressed data has too many mip levels for a {}x{} texture.",
+        size.x, size.y);
+      return false;
+    }
+
+    const Size blockSize = TextureContainer::getBlockByteCount(compressedFormat);
+    if (blockSize == 0) {
+      DG_ENGINE_ERROR("Compressed data has unknown format {}.", compressedFormat);
+      return false;
+    }
+
+    // Compressed data which brings only its base level gets no mip chain, since the graphics
+    // card cannot generate one for a block-compressed texture.
+    Collection<TextureLevel> uploadLevels = levels;
+    if (uploadLevels.empty() == true) {
+      uploadLevels.push_back({ size, 0,
+        TextureContainer::getCompressedByteCount(compressedFormat, size) });
+    }
+
+    for (const auto& level : uploadLevels) {
+      if (level.offset + level.byteCount > byteCount ||
+          level.byteCount < TextureContainer::getCompressedByteCount(compressedFormat, level.size))
+      {
+        DG_ENGINE_ERROR("Compressed data is too small for a {}x{} texture.", size.x, size.y);
+        return false;
+      }
+    }
+
+    // There is no fallback for a format the graphics card cannot sample.
+    auto& backend = RenderInterface::getBackend();
+    if (backend.isTextureFormatSupported(compressedFormat) == false) {
+      DG_ENGINE_ERROR("Compressed texture format {} is not supported by this graphics card.",
+        compressedFormat);
+      return false;
+    }
+
+    // Compressed data is a fraction of the size of the pixels it stands for, so it is uploaded
+    // right away, rather than queued.
+    TextureUploadQueue::cancel(*this);
+
+    m_internalFormat = compressedFormat;
+    m_pixelFormat = (compressedFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT) ? GL_RGB : GL_RGBA;
+    m_spec.size = size;
+    m_spec.colorChannels = (m_pixelFormat == GL_RGB) ? 3 : 4;
+    m_compressed = true;
+    allocateStorage(uploadLevels.size());
+
+    for (Index i = 0; i < uploadLevels.size(); ++i) {
+      const auto& level = uploadLevels[i];
+      backend.uploadCompressedTexture2D(m_handle, { 0, 0 }, level.size, m_internalFormat,
+        data.get() + level.offset, level.byteCount, i);
+    }
+
+    m_valid = true;
+    return true;
+  }
+
   void Texture::uploadData (const void* data, const Size size)
   {
-    if (data == nullptr || size == 0) {
+    if (m_compressed == true) {
+      throw std::runtime_error { "Attempted 'uploadData' to a compressed texture!" };
+    } else if (data == nullptr || size == 0) {
       throw std::invalid_argument { "Attempted 'uploadData' with null image data!" };
     } else if (size != m_spec.size.x * m_spec.size.y * m_spec.colorChannels) {
       throw std::invalid_argument { "Attempted 'uploadData' of mismatched texture size!" };
     }
 
-    glBindTexture(GL_TEXTURE_2D, m_handle);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_spec.size.x, m_spec.size.y, m_pixelFormat,
-      GL_UNSIGNED_BYTE, data);
+    // This data replaces any upload still pending from an earlier load.
+    TextureUploadQueue::cancel(*this);
+
+    // An evicted texture has no storage left to upload into, so it is set aside again, with the
+    // mip chain it had before.
+    if (m_allocated == false) {
+      allocateStorage(std::max<Count>(m_levelCount, 1));
+    }
+
+    auto& backend = RenderInterface::getBackend();
+    backend.uploadTexture2D(m_handle, { 0, 0 }, m_spec.size, m_pixelFormat, GL_UNSIGNED_BYTE,
+      data);
+    if (m_levelCount > 1) {
+      backend.generateTextureMipmaps(m_handle);
+    }
+
+    m_valid = true;
   }
 
   Vector2f Texture::getTextureCoordinate (const Vector2f& position) const
@@ -194,12 +436,88 @@ namespace dg
     };
   }
 
+  const Vector2u& Texture::getSize () const
+  {
+    return m_spec.size;
+  }
+
   Boolean Texture::isValid () const
   {
     return m_valid;
   }
 
+  Boolean Texture::isPending () const
+  {
+    return m_pending;
+  }
+
+  Boolean Texture::isCompressed () const
+  {
+    return m_compressed;
+  }
+
+  Count Texture::getLevelCount () const
+  {
+    return m_levelCount;
+  }
+
+  Size Texture::getByteCount () const
+  {
+    return m_byteCount;
+  }
+
+  const Path& Texture::getFilepath () const
+  {
+    return m_filepath;
+  }
+
+  void Texture::allocateStorage (Count levelCount)
+  {
+    // Immutable storage cannot be resized or reformatted, so a texture which already has storage
+    // is swapped for a new texture object.
+    auto& backend = RenderInterface::getBackend();
+    if (m_allocated == true) {
+      backend.destroyTexture(m_handle);
+      m_handle = backend.createTexture();
+    }
+
+    backend.allocateTextureStorage2D(m_handle, levelCount, m_internalFormat, m_spec.size);
+    Private::applyGLTextureParameters(m_handle, m_spec, levelCount);
+    m_levelCount = levelCount;
+    m_allocated = true;
+    m_evicted = false;
+
+    // Tally up the size of each level, as the graphics card would store it.
+    m_byteCount = 0;
+    for (Index i = 0; i < levelCount; ++i) {
+      const Vector2u levelSize {
+        std::max(m_spec.size.x >> i, 1u),
+        std::max(m_spec.size.y >> i, 1u)
+      };
+
+      m_byteCount += (m_compressed == true) ?
+        TextureContainer::getCompressedByteCount(m_internalFormat, levelSize) :
+        static_cast<Size>(levelSize.x) * levelSize.y * m_spec.colorChannels;
+    }
+  }
+
+  void Texture::evict ()
+  {
+    // Throw out any upload still pending, then swap the texture object for one with no storage.
+    TextureUploadQueue::cancel(*this);
+
+    auto& backend = RenderInterface::getBackend();
+    backend.destroyTexture(m_handle);
+    m_handle = backend.createTexture();
+
+    m_allocated = false;
+    m_byteCount = 0;
+    m_valid = false;
+    m_evicted = true;
+  }
+
   Dictionary<Ref<Texture>> TextureManager::s_assets;
+  TextureSpecification TextureManager::s_loadSpec;
 
   Ref<Texture> TextureManager::getOrEmplace (const String& filename)
   {
@@ -208,22 +526,69 @@ namespace dg
       throw std::invalid_argument { "Attempted 'getOrEmplace' with a blank filename string!" };
     }
 
-    // Check to see if the texture asset is present. If so, then return it.
+    // Check to see if the texture asset is present. If so, then return it, first finishing its
+    // load if it is still loading in the background.
     auto iter = s_assets.find(filename);
-    if (iter != s_assets.end()) { return iter->second; }
+    if (iter != s_assets.end()) {
+      if (AssetLoader::isLoading(filename) == false) { return iter->second; }
+
+      Ref<Texture> texture = iter->second;
+      AssetLoader::wait(filename);
+      if (texture->isValid() == false && texture->isPending() == false) {
+        s_assets.erase(filename);
+        DG_ENGINE_CRIT("Could not load texture asset file '{}'!", filename);
+        throw std::runtime_error { "Could not load texture asset file!" };
+      }
+
+      return texture;
+    }
 
-    // Create the texture. Ensure that it is valid.
-    Ref<Texture> texture = Texture::make(FileIo::getAbsolute(filename));
-    if (texture->isValid() == false) {
+    // Create the texture, from its cooked texture file if that is up to date. Ensure that it is
+    // valid, or waiting to be uploaded.
+    Ref<Texture> texture = Texture::make(TextureCooker::resolve(FileIo::getAbsolute(filename)),
+      s_loadSpec);
+    if (texture->isValid() == false && texture->isPending() == false) {
       DG_ENGINE_CRIT("Could not load texture asset file '{}'!", filename);
       throw std::runtime_error { "Could not load texture asset file!" };
     }
 
     // Emplace, then return the texture.
+    TextureResidency::track(*texture, filename);
     s_assets.emplace(filename, texture);
     return texture;
   }
 
+  Ref<Texture> TextureManager::loadAsync (const String& filename)
+  {
+    // Ensure that the relative filename string is provided.
+    if (filename.empty()) {
+      throw std::invalid_argument { "Attempted 'loadAsync' with a blank filename string!" };
+    }
+
+    // Check to see if the texture asset is present. If so, then return it.
+    auto iter = s_assets.find(filename);
+    if (iter != s_assets.end()) { return iter->second; }
+
+    // Map an empty texture now, and load its image in the background.
+    Ref<Texture> texture = Texture::make();
+    texture->m_spec = s_loadSpec;
+    Texture::loadAsync(texture, FileIo::getAbsolute(filename), filename);
+
+    TextureResidency::track(*texture, filename);
+    s_assets.emplace(filename, texture);
+    return texture;
+  }
+
+  void TextureManager::setLoadSpecification (const TextureSpecification& spec)
+  {
+    s_loadSpec = spec;
+  }
+
+  const TextureSpecification& TextureManager::getLoadSpecification ()
+  {
+    return s_loadSpec;
+  }
+
   Boolean TextureManager::contains (const String& filename)
   {
     // Ensure that the relative filename string is provided.
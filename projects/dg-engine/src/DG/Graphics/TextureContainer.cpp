@@ -0,0 +1,584 @@
+/** @file DG/Graphics/TextureContainer.cpp */
+
+#include <DG/Graphics/TextureCooker.hpp>
+#include <DG/Graphics/TextureContainer.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static constexpr Uint32 DDS_MAGIC         = 0x20534444;   // "DDS "
+    static constexpr Uint32 DDS_HEADER_SIZE   = 128;          // Including the magic number.
+    static constexpr Uint32 DDS_DX10_SIZE     = 20;
+    static constexpr Uint32 DDS_FOURCC_DXT1   = 0x31545844;   // "DXT1"
+    static constexpr Uint32 DDS_FOURCC_DXT5   = 0x35545844;   // "DXT5"
+    static constexpr Uint32 DDS_FOURCC_DX10   = 0x30315844;   // "DX10"
+    static constexpr Uint32 DDS_MIPMAP_COUNT  = 0x20000;      // DDSD_MIPMAPCOUNT
+
+    static constexpr Uint8 KTX2_IDENTIFIER[12] = {
+      0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+    };
+    static constexpr Uint32 KTX2_HEADER_SIZE  = 80;
+    static constexpr Uint32 KTX2_LEVEL_SIZE   = 24;
+    static constexpr const char* KTX2_ORIENTATION_KEY = "KTXorientation";
+
+    template <typename T>
+    T readValue (const Uint8* data, Size offset)
+    {
+      T value;
+      std::memcpy(&value, data + offset, sizeof(T));
+      return value;
+    }
+
+    String getLowercaseExtension (const Path& path)
+    {
+      String extension = path.extension().string();
+      std::transform(extension.begin(), extension.end(), extension.begin(),
+        [] (char c) { return static_cast<char>(std::tolower(c)); });
+      return extension;
+    }
+
+    /**
+     * @brief Resolves a DXGI format, as found in a DDS file's extended header, to a block-
+     *        compressed OpenGL format.
+     */
+    GLenum resolveDxgiFormat (Uint32 format)
+    {
+      switch (format) {
+        case 71: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;     // DXGI_FORMAT_BC1_UNORM
+        case 77: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;     // DXGI_FORMAT_BC3_UNORM
+        case 98: return GL_COMPRESSED_RGBA_BPTC_UNORM;        // DXGI_FORMAT_BC7_UNORM
+        default: return 0;
+      }
+    }
+
+    /**
+     * @brief Resolves a Vulkan format, as found in a KTX2 file's header, to either a block-
+     *        compressed OpenGL format or an uncompressed color channel count.
+     */
+    Bool resolveVulkanFormat (Uint32 format, GLenum& compressedFormat, Uint32& colorChannels)
+    {
+      compressedFormat = 0;
+      switch (format) {
+        case 9:   colorChannels = 1; break;   // VK_FORMAT_R8_UNORM
+        case 16:  colorChannels = 2; break;   // VK_FORMAT_R8G8_UNORM
+        case 23:  colorChannels = 3; break;   // VK_FORMAT_R8G8B8_UNORM
+        case 37:  colorChannels = 4; break;   // VK_FORMAT_R8G8B8A8_UNORM
+        case 131: colorChannels = 3; compressedFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break;
+        case 133: colorChannels = 4; compressedFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case 137: colorChannels = 4; compressedFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case 145: colorChannels = 4; compressedFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;    break;
+        default: return false;
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Finds the value of the given key in a KTX2 file's key/value data, or an empty view if
+     *        the key is not there.
+     */
+    StringView findKtx2Value (const Uint8* data, Size fileSize, StringView key)
+    {
+      Size offset = readValue<Uint32>(data, 56);
+      Size end = offset + readValue<Uint32>(data, 60);
+      if (end > fileSize) {
+        return {};
+      }
+
+      // Each entry is its length, then its key and value, each ending in a null character, then
+      // padding up to a multiple of four bytes.
+      while (offset + sizeof(Uint32) <= end) {
+        Size length = readValue<Uint32>(data, offset);
+        offset += sizeof(Uint32);
+        if (length > end - offset) {
+          break;
+        }
+
+        StringView entry { reinterpret_cast<const char*>(data + offset), length };
+        Size split = entry.find('\0');
+        if (split != StringView::npos && entry.substr(0, split) == key) {
+          StringView value = entry.substr(split + 1);
+          return value.substr(0, value.find('\0'));
+        }
+
+        offset += (length + 3) & ~Size { 3 };
+      }
+
+      return {};
+    }
+
+    /**
+     * @brief Reverses the first few rows of a BC1 color block's indices, each of which is a byte.
+     */
+    void flipColorBlock (Uint8* block, Uint32 rows)
+    {
+      std::reverse(block + 4, block + 4 + rows);
+    }
+
+    /**
+     * @brief Reverses the first few rows of a BC3 alpha block's indices, each of which is twelve
+     *        bits of the 48-bit field following the two alpha endpoints.
+     */
+    void flipAlphaBlock (Uint8* block, Uint32 rows)
+    {
+      Uint64 indices = 0, flipped = 0;
+      std::memcpy(&indices, block + 2, 6);
+      for (Uint32 row = 0; row < 4; ++row) {
+        Uint32 source = (row < rows) ? rows - 1 - row : row;
+        flipped |= ((indices >> (12 * source)) & 0xFFF) << (12 * row);
+      }
+      std::memcpy(block + 2, &flipped, 6);
+    }
+
+    /**
+     * @brief Checks whether a block-compressed level is padded out below its bottom row, within
+     *        more than one row of blocks. Reversing its rows of blocks would move the padding to
+     *        the top, and each row of blocks would then need rows of pixels from two.
+     */
+    Bool isPaddedBelow (const TextureLevel& level)
+    {
+      return level.size.y > 4 && level.size.y % 4 != 0;
+    }
+
+    /**
+     * @brief Decodes a BC1 color block's palette into four-channel colors. BC3 blocks always use
+     *        four colors; BC1 blocks whose first endpoint is not the greater use three, and black,
+     *        which is see-through unless the format has no alpha.
+     */
+    void decodeColorPalette (const Uint8* block, GLenum compressedFormat, Uint8 (&palette)[4][4])
+    {
+      const Uint16 endpoints[2] = { readValue<Uint16>(block, 0), readValue<Uint16>(block, 2) };
+      for (Index i = 0; i < 2; ++i) {
+        palette[i][0] = static_cast<Uint8>(((endpoints[i] >> 11) & 0x1F) * 255 / 31);
+        palette[i][1] = static_cast<Uint8>(((endpoints[i] >> 5) & 0x3F) * 255 / 63);
+        palette[i][2] = static_cast<Uint8>((endpoints[i] & 0x1F) * 255 / 31);
+        palette[i][3] = 255;
+      }
+
+      const Uint8* first = palette[0];
+      const Uint8* second = palette[1];
+      if (compressedFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT || endpoints[0] > endpoints[1]) {
+        for (Index c = 0; c < 3; ++c) {
+          palette[2][c] = static_cast<Uint8>((2 * first[c] + second[c] + 1) / 3);
+          palette[3][c] = static_cast<Uint8>((first[c] + 2 * second[c] + 1) / 3);
+        }
+        palette[2][3] = palette[3][3] = 255;
+      } else {
+        for (Index c = 0; c < 3; ++c) {
+          palette[2][c] = static_cast<Uint8>((first[c] + second[c]) / 2);
+          palette[3][c] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = (compressedFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT) ? 255 : 0;
+      }
+    }
+
+    /**
+     * @brief Decodes a BC3 alpha block's palette, of eight alphas interpolated between its two
+     *        endpoints, or six and the two extremes if the first endpoint is not the greater.
+     */
+    void decodeAlphaPalette (const Uint8* block, Uint8 (&palette)[8])
+    {
+      const Uint32 first = block[0], second = block[1];
+      palette[0] = block[0];
+      palette[1] = block[1];
+      if (first > second) {
+        for (Uint32 i = 1; i < 7; ++i) {
+          palette[i + 1] = static_cast<Uint8>(((7 - i) * first + i * second + 3) / 7);
+        }
+      } else {
+        for (Uint32 i = 1; i < 5; ++i) {
+          palette[i + 1] = static_cast<Uint8>(((5 - i) * first + i * second + 2) / 5);
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+      }
+    }
+
+    /**
+     * @brief Decodes one BC1 or BC3 level into four-channel pixels, flipping it upside down as it
+     *        goes.
+     */
+    void decodeLevel (const Uint8* blocks, const Vector2u& size, GLenum compressedFormat,
+      Uint8* pixels)
+    {
+      const Bool hasAlphaBlock = (compressedFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+      const Size blockSize = TextureContainer::getBlockByteCount(compressedFormat);
+      const Uint32 blocksAcross = (size.x + 3) / 4, blocksDown = (size.y + 3) / 4;
+
+      for (Uint32 blockY = 0; blockY < blocksDown; ++blockY) {
+        for (Uint32 blockX = 0; blockX < blocksAcross; ++blockX) {
+          const Uint8* block = blocks + (static_cast<Size>(blockY) * blocksAcross + blockX) *
+            blockSize;
+          const Uint8* colorBlock = (hasAlphaBlock == true) ? block + 8 : block;
+
+          Uint8 colors[4][4];
+          decodeColorPalette(colorBlock, compressedFormat, colors);
+
+          Uint8 alphas[8];
+          Uint64 alphaIndices = 0;
+          if (hasAlphaBlock == true) {
+            decodeAlphaPalette(block, alphas);
+            std::memcpy(&alphaIndices, block + 2, 6);
+          }
+
+          for (Uint32 row = 0; row < 4 && blockY * 4 + row < size.y; ++row) {
+            const Size y = size.y - 1 - (blockY * 4 + row);
+            for (Uint32 column = 0; column < 4 && blockX * 4 + column < size.x; ++column) {
+              Uint8* pixel = pixels + (y * size.x + blockX * 4 + column) * 4;
+              std::memcpy(pixel, colors[(colorBlock[4 + row] >> (2 * column)) & 0x3], 4);
+              if (hasAlphaBlock == true) {
+                pixel[3] = alphas[(alphaIndices >> (3 * (row * 4 + column))) & 0x7];
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Decodes each level of a mapped BC1 or BC3 image into four-channel pixels, flipped
+     *        upside down, in place of its compressed data.
+     */
+    void decodeImage (MappedImage& image)
+    {
+      Collection<TextureLevel> levels;
+      Size byteCount = 0;
+      for (const auto& level : image.levels) {
+        TextureLevel& decoded = levels.emplace_back();
+        decoded.size = level.size;
+        decoded.offset = byteCount;
+        decoded.byteCount = static_cast<Size>(level.size.x) * level.size.y * 4;
+        byteCount += decoded.byteCount;
+      }
+
+      Collection<Uint8> pixels(byteCount);
+      for (Index i = 0; i < levels.size(); ++i) {
+        decodeLevel(image.file->getData() + image.levels[i].offset, image.levels[i].size,
+          image.compressedFormat, pixels.data() + levels[i].offset);
+      }
+
+      image.colorChannels = 4;
+      image.compressedFormat = 0;
+      image.levels = std::move(levels);
+      image.pixels = std::move(pixels);
+    }
+
+    /**
+     * @brief Flips one level of pixel data upside down, in place.
+     *
+     *        Block-compressed levels have their rows of blocks reversed, then the rows of pixels
+     *        within each block. A level less than four pixels high only fills the top rows of its
+     *        blocks, so only those are reversed. Levels which are padded below their bottom row
+     *        cannot be flipped this way.
+     *
+     * @return @a `false` if the level cannot be flipped without decoding it.
+     */
+    Bool flipLevel (Uint8* pixels, const TextureLevel& level, GLenum compressedFormat,
+      Uint32 colorChannels)
+    {
+      // BC7 blocks lay out their rows differently from one mode to the next.
+      if (
+        compressedFormat == GL_COMPRESSED_RGBA_BPTC_UNORM ||
+        (compressedFormat != 0 && isPaddedBelow(level) == true)
+      ) {
+        return false;
+      }
+
+      Size rowSize = static_cast<Size>(level.size.x) * colorChannels;
+      Uint32 rowCount = level.size.y;
+      if (compressedFormat != 0) {
+        rowSize = ((level.size.x + 3) / 4) * TextureContainer::getBlockByteCount(compressedFormat);
+        rowCount = (level.size.y + 3) / 4;
+      }
+
+      for (Uint32 top = 0, bottom = rowCount - 1; top < bottom; ++top, --bottom) {
+        std::swap_ranges(pixels + top * rowSize, pixels + (top + 1) * rowSize,
+          pixels + bottom * rowSize);
+      }
+
+      if (compressedFormat == 0) {
+        return true;
+      }
+
+      const Uint32 blockRows = std::min(level.size.y, 4u);
+      const Size blockSize = TextureContainer::getBlockByteCount(compressedFormat);
+      for (Uint8* block = pixels; block < pixels + rowCount * rowSize; block += blockSize) {
+        if (compressedFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) {
+          flipAlphaBlock(block, blockRows);
+          flipColorBlock(block + 8, blockRows);
+        } else {
+          flipColorBlock(block, blockRows);
+        }
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Copies a mapped image's file out, and flips each of its levels upside down, so that
+     *        their bottom rows come first.
+     */
+    void flipImage (const Path& path, MappedImage& image)
+    {
+      // BC1 and BC3 levels which are padded below their bottom row are decoded instead, along
+      // with the rest of the image, since a texture's levels must all share one format.
+      if (
+        image.compressedFormat != 0 &&
+        image.compressedFormat != GL_COMPRESSED_RGBA_BPTC_UNORM &&
+        std::any_of(image.levels.begin(), image.levels.end(), isPaddedBelow) == true
+      ) {
+        DG_ENGINE_WARN("Texture file '{}' stores its top row first, and its height cannot be "
+          "flipped a block at a time. It will be decoded.", path.string());
+        decodeImage(image);
+        return;
+      }
+
+      Collection<Uint8> pixels { image.file->getData(),
+        image.file->getData() + image.file->getSize() };
+      for (const auto& level : image.levels) {
+        if (flipLevel(pixels.data() + level.offset, level, image.compressedFormat,
+          image.colorChannels) == false) {
+          DG_ENGINE_WARN("Texture file '{}' stores its top row first, and BC7 blocks cannot be "
+            "flipped without decoding them. It will appear upside down.", path.string());
+          return;
+        }
+      }
+
+      image.pixels = std::move(pixels);
+    }
+
+  }
+
+  Bool TextureContainer::isContainerPath (const Path& path)
+  {
+    String extension = Private::getLowercaseExtension(path);
+    return extension == ".dds" || extension == ".ktx2" || extension == COOKED_TEXTURE_EXTENSION;
+  }
+
+  Bool TextureContainer::load (const Path& path, MappedImage& image)
+  {
+    String extension = Private::getLowercaseExtension(path);
+    if (extension == ".dds")                        { return loadDds(path, image); }
+    else if (extension == ".ktx2")                  { return loadKtx2(path, image); }
+    else if (extension == COOKED_TEXTURE_EXTENSION) { return loadCooked(path, image); }
+
+    DG_ENGINE_ERROR("File '{}' is not a texture container file.", path.string());
+    return false;
+  }
+
+  Size TextureContainer::getBlockByteCount (GLenum compressedFormat)
+  {
+    switch (compressedFormat) {
+      case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+      case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:  return 8;
+      case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+      case GL_COMPRESSED_RGBA_BPTC_UNORM:     return 16;
+      default: return 0;
+    }
+  }
+
+  Size TextureContainer::getCompressedByteCount (GLenum compressedFormat, const Vector2u& size)
+  {
+    return static_cast<Size>((size.x + 3) / 4) * ((size.y + 3) / 4) *
+      getBlockByteCount(compressedFormat);
+  }
+
+  Count TextureContainer::getFullLevelCount (const Vector2u& size)
+  {
+    Count count = 1;
+    for (Uint32 largest = std::max(size.x, size.y); largest > 1; largest /= 2) {
+      count++;
+    }
+
+    return count;
+  }
+
+  Collection<TextureLevel> TextureContainer::getPackedLevels (GLenum compressedFormat,
+    Uint32 colorChannels, const Vector2u& size, Count levelCount, Size offset)
+  {
+    Collection<TextureLevel> levels;
+    levels.reserve(levelCount);
+
+    Vector2u levelSize = size;
+    for (Index i = 0; i < levelCount; ++i) {
+      TextureLevel& level = levels.emplace_back();
+      level.size = levelSize;
+      level.offset = offset;
+      level.byteCount = (compressedFormat != 0) ?
+        getCompressedByteCount(compressedFormat, levelSize) :
+        static_cast<Size>(levelSize.x) * levelSize.y * colorChannels;
+
+      offset += level.byteCount;
+      levelSize = { std::max(levelSize.x / 2, 1u), std::max(levelSize.y / 2, 1u) };
+    }
+
+    return levels;
+  }
+
+  Bool TextureContainer::loadDds (const Path& path, MappedImage& image)
+  {
+    auto file = MappedFile::make(path);
+    if (file == nullptr) {
+      return false;
+    }
+
+    const Uint8* data = file->getData();
+    if (
+      file->getSize() < Private::DDS_HEADER_SIZE ||
+      Private::readValue<Uint32>(data, 0) != Private::DDS_MAGIC
+    ) {
+      DG_ENGINE_ERROR("File '{}' is not a DDS file.", path.string());
+      return false;
+    }
+
+    Vector2u size = { Private::readValue<Uint32>(data, 16), Private::readValue<Uint32>(data, 12) };
+    Uint32 fourCC = Private::readValue<Uint32>(data, 84);
+    Size offset = Private::DDS_HEADER_SIZE;
+
+    GLenum compressedFormat = 0;
+    if (fourCC == Private::DDS_FOURCC_DXT1) {
+      compressedFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    } else if (fourCC == Private::DDS_FOURCC_DXT5) {
+      compressedFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    } else if (
+      fourCC == Private::DDS_FOURCC_DX10 && file->getSize() >= offset + Private::DDS_DX10_SIZE
+    ) {
+      compressedFormat = Private::resolveDxgiFormat(Private::readValue<Uint32>(data, offset));
+      offset += Private::DDS_DX10_SIZE;
+    }
+
+    if (compressedFormat == 0) {
+      DG_ENGINE_ERROR("DDS file '{}' is not in a supported block-compressed format.",
+        path.string());
+      return false;
+    }
+
+    // Mip levels follow the base level, largest first.
+    Count levelCount = 1;
+    if ((Private::readValue<Uint32>(data, 8) & Private::DDS_MIPMAP_COUNT) != 0) {
+      levelCount = std::max<Count>(Private::readValue<Uint32>(data, 28), 1);
+    }
+
+    if (size.x == 0 || size.y == 0 || levelCount > getFullLevelCount(size)) {
+      DG_ENGINE_ERROR("DDS file '{}' has an invalid size.", path.string());
+      return false;
+    }
+
+    auto levels = getPackedLevels(compressedFormat, 0, size, levelCount, offset);
+    if (levels.back().offset + levels.back().byteCount > file->getSize()) {
+      DG_ENGINE_ERROR("DDS file '{}' is truncated.", path.string());
+      return false;
+    }
+
+    // DDS files always store their top row first.
+    image.size = size;
+    image.colorChannels = 4;
+    image.compressedFormat = compressedFormat;
+    image.levels = std::move(levels);
+    image.file = std::move(file);
+    Private::flipImage(path, image);
+    return true;
+  }
+
+  Bool TextureContainer::loadKtx2 (const Path& path, MappedImage& image)
+  {
+    auto file = MappedFile::make(path);
+    if (file == nullptr) {
+      return false;
+    }
+
+    const Uint8* data = file->getData();
+    if (
+      file->getSize() < Private::KTX2_HEADER_SIZE + Private::KTX2_LEVEL_SIZE ||
+      std::memcmp(data, Private::KTX2_IDENTIFIER, sizeof(Private::KTX2_IDENTIFIER)) != 0
+    ) {
+      DG_ENGINE_ERROR("File '{}' is not a KTX2 file.", path.string());
+      return false;
+    }
+
+    // Only single, two-dimensional images without supercompression are supported.
+    Uint32 vulkanFormat = Private::readValue<Uint32>(data, 12);
+    Vector2u size = { Private::readValue<Uint32>(data, 20), Private::readValue<Uint32>(data, 24) };
+    if (
+      Private::readValue<Uint32>(data, 28) != 0 ||    // Pixel depth
+      Private::readValue<Uint32>(data, 32) != 0 ||    // Layer count
+      Private::readValue<Uint32>(data, 36) != 1 ||    // Face count
+      Private::readValue<Uint32>(data, 44) != 0       // Supercompression scheme
+    ) {
+      DG_ENGINE_ERROR("KTX2 file '{}' is not a plain two-dimensional texture.", path.string());
+      return false;
+    }
+
+    GLenum compressedFormat = 0;
+    Uint32 colorChannels = 0;
+    if (Private::resolveVulkanFormat(vulkanFormat, compressedFormat, colorChannels) == false) {
+      DG_ENGINE_ERROR("KTX2 file '{}' has unsupported format {}.", path.string(), vulkanFormat);
+      return false;
+    }
+
+    // A level count of zero asks for the mip chain to be generated, so only the base level is
+    // stored.
+    Count levelCount = std::max<Count>(Private::readValue<Uint32>(data, 40), 1);
+    if (
+      size.x == 0 || size.y == 0 || levelCount > getFullLevelCount(size) ||
+      file->getSize() < Private::KTX2_HEADER_SIZE + levelCount * Private::KTX2_LEVEL_SIZE
+    ) {
+      DG_ENGINE_ERROR("KTX2 file '{}' has an invalid size.", path.string());
+      return false;
+    }
+
+    // Each entry of the level index locates one level, starting with the largest. The levels
+    // themselves may be stored in any order.
+    auto levels = getPackedLevels(compressedFormat, colorChannels, size, levelCount);
+    for (Index i = 0; i < levelCount; ++i) {
+      Size entry = Private::KTX2_HEADER_SIZE + i * Private::KTX2_LEVEL_SIZE;
+      Uint64 offset = Private::readValue<Uint64>(data, entry);
+      Uint64 length = Private::readValue<Uint64>(data, entry + 8);
+      if (
+        length < levels[i].byteCount || offset > file->getSize() ||
+        file->getSize() - offset < levels[i].byteCount
+      ) {
+        DG_ENGINE_ERROR("KTX2 file '{}' is truncated.", path.string());
+        return false;
+      }
+
+      levels[i].offset = offset;
+    }
+
+    // The orientation's second letter tells whether rows run down (the default) or up.
+    StringView orientation = Private::findKtx2Value(data, file->getSize(),
+      Private::KTX2_ORIENTATION_KEY);
+    Bool topDown = (orientation.size() < 2 || orientation[1] != 'u');
+
+    image.size = size;
+    image.colorChannels = colorChannels;
+    image.compressedFormat = compressedFormat;
+    image.levels = std::move(levels);
+    image.file = std::move(file);
+    if (topDown == true) {
+      Private::flipImage(path, image);
+    }
+    return true;
+  }
+
+  Bool TextureContainer::loadCooked (const Path& path, MappedImage& image)
+  {
+    CookedTexture cooked;
+    if (TextureCooker::load(path, cooked) == false) {
+      return false;
+    }
+
+    image.size = { cooked.header.width, cooked.header.height };
+    image.colorChannels = cooked.header.colorChannels;
+    image.compressedFormat = TextureCooker::getCompressedFormat(cooked.header.format);
+    image.levels = getPackedLevels(image.compressedFormat, image.colorChannels, image.size,
+      cooked.header.mipCount, cooked.payload - cooked.file->getData());
+    image.file = std::move(cooked.file);
+    return true;
+  }
+
+}
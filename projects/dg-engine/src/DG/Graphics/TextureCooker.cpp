@@ -0,0 +1,462 @@
+/** @file DG/Graphics/TextureCooker.cpp */
+
+#include <stb_image.h>
+#include <DG/Graphics/TextureContainer.hpp>
+#include <DG/Graphics/TextureCooker.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static constexpr const char* COOKABLE_EXTENSIONS[] = {
+      ".png", ".jpg", ".jpeg", ".bmp", ".tga"
+    };
+
+    Uint16 packColor565 (const Uint8* color)
+    {
+      return static_cast<Uint16>(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) |
+        (color[2] >> 3));
+    }
+
+    void unpackColor565 (Uint16 packed, Int32* color)
+    {
+      Int32 r = (packed >> 11) & 0x1F, g = (packed >> 5) & 0x3F, b = packed & 0x1F;
+      color[0] = (r << 3) | (r >> 2);
+      color[1] = (g << 2) | (g >> 4);
+      color[2] = (b << 3) | (b >> 2);
+    }
+
+    /**
+     * @brief Encodes the colors of a block of sixteen RGBA pixels as an eight-byte BC1 block. The
+     *        endpoints are the two pixels furthest apart along the block's principal axis.
+     */
+    void encodeColorBlock (const Uint8* pixels, Uint8* output)
+    {
+      Float32 mean[3] = { 0.0f, 0.0f, 0.0f };
+      for (Index i = 0; i < 16; ++i) {
+        for (Index c = 0; c < 3; ++c) { mean[c] += pixels[i * 4 + c] / 16.0f; }
+      }
+
+      Float32 covariance[3][3] = {};
+      for (Index i = 0; i < 16; ++i) {
+        Float32 d[3];
+        for (Index c = 0; c < 3; ++c) { d[c] = pixels[i * 4 + c] - mean[c]; }
+        for (Index r = 0; r < 3; ++r) {
+          for (Index c = 0; c < 3; ++c) { covariance[r][c] += d[r] * d[c]; }
+        }
+      }
+
+      // A few rounds of power iteration are enough to find the principal axis of a block.
+      Float32 axis[3] = { 1.0f, 1.0f, 1.0f };
+      for (Index round = 0; round < 8; ++round) {
+        Float32 next[3];
+        for (Index r = 0; r < 3; ++r) {
+          next[r] = covariance[r][0] * axis[0] + covariance[r][1] * axis[1] +
+            covariance[r][2] * axis[2];
+        }
+
+        Float32 length = std::max({ std::abs(next[0]), std::abs(next[1]), std::abs(next[2]) });
+        if (length == 0.0f) { break; }
+        for (Index c = 0; c < 3; ++c) { axis[c] = next[c] / length; }
+      }
+
+      Index lowest = 0, highest = 0;
+      Float32 lowestDot = std::numeric_limits<Float32>::max();
+      Float32 highestDot = std::numeric_limits<Float32>::lowest();
+      for (Index i = 0; i < 16; ++i) {
+        Float32 dot = pixels[i * 4] * axis[0] + pixels[i * 4 + 1] * axis[1] +
+          pixels[i * 4 + 2] * axis[2];
+        if (dot < lowestDot)  { lowestDot = dot; lowest = i; }
+        if (dot > highestDot) { highestDot = dot; highest = i; }
+      }
+
+      // The first endpoint must be the greater, so that the block uses four colors.
+      Uint16 endpoints[2] = {
+        packColor565(pixels + highest * 4),
+        packColor565(pixels + lowest * 4)
+      };
+      if (endpoints[0] < endpoints[1]) { std::swap(endpoints[0], endpoints[1]); }
+
+      Uint32 indices = 0;
+      if (endpoints[0] != endpoints[1]) {
+        Int32 palette[4][3];
+        unpackColor565(endpoints[0], palette[0]);
+        unpackColor565(endpoints[1], palette[1]);
+        for (Index c = 0; c < 3; ++c) {
+          palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+          palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (Index i = 0; i < 16; ++i) {
+          Uint32 best = 0;
+          Int32 bestDistance = std::numeric_limits<Int32>::max();
+          for (Uint32 p = 0; p < 4; ++p) {
+            Int32 distance = 0;
+            for (Index c = 0; c < 3; ++c) {
+              Int32 d = pixels[i * 4 + c] - palette[p][c];
+              distance += d * d;
+            }
+            if (distance < bestDistance) { bestDistance = distance; best = p; }
+          }
+
+          indices |= best << (i * 2);
+        }
+      }
+
+      output[0] = static_cast<Uint8>(endpoints[0]);
+      output[1] = static_cast<Uint8>(endpoints[0] >> 8);
+      output[2] = static_cast<Uint8>(endpoints[1]);
+      output[3] = static_cast<Uint8>(endpoints[1] >> 8);
+      for (Index i = 0; i < 4; ++i) {
+        output[4 + i] = static_cast<Uint8>(indices >> (i * 8));
+      }
+    }
+
+    /**
+     * @brief Encodes the alpha values of a block of sixteen RGBA pixels as the eight-byte alpha
+     *        half of a BC3 block.
+     */
+    void encodeAlphaBlock (const Uint8* pixels, Uint8* output)
+    {
+      Int32 highest = 0, lowest = 255;
+      for (Index i = 0; i < 16; ++i) {
+        highest = std::max<Int32>(highest, pixels[i * 4 + 3]);
+        lowest = std::min<Int32>(lowest, pixels[i * 4 + 3]);
+      }
+
+      // The first endpoint is the greater, so that the block uses eight alpha values.
+      Uint64 indices = 0;
+      if (highest != lowest) {
+        Int32 palette[8] = { highest, lowest };
+        for (Index p = 2; p < 8; ++p) {
+          palette[p] = ((8 - p) * highest + (p - 1) * lowest) / 7;
+        }
+
+        for (Index i = 0; i < 16; ++i) {
+          Uint64 best = 0;
+          Int32 bestDistance = std::numeric_limits<Int32>::max();
+          for (Uint64 p = 0; p < 8; ++p) {
+            Int32 distance = std::abs(pixels[i * 4 + 3] - palette[p]);
+            if (distance < bestDistance) { bestDistance = distance; best = p; }
+          }
+
+          indices |= best << (i * 3);
+        }
+      }
+
+      output[0] = static_cast<Uint8>(highest);
+      output[1] = static_cast<Uint8>(lowest);
+      for (Index i = 0; i < 6; ++i) {
+        output[2 + i] = static_cast<Uint8>(indices >> (i * 8));
+      }
+    }
+
+    /**
+     * @brief Compresses tightly-packed RGB or RGBA pixels into BC1 or BC3 blocks. Blocks hanging
+     *        over the image's edges repeat its edge pixels.
+     */
+    Collection<Uint8> compressImage (const Uint8* data, const Vector2u& size,
+      Uint32 colorChannels, CookedTextureFormat format)
+    {
+      const Size blockSize = (format == CookedTextureFormat::BC3) ? 16 : 8;
+      const Uint32 blocksWide = (size.x + 3) / 4, blocksHigh = (size.y + 3) / 4;
+      Collection<Uint8> output(static_cast<Size>(blocksWide) * blocksHigh * blockSize);
+
+      Uint8* block = output.data();
+      for (Uint32 by = 0; by < blocksHigh; ++by) {
+        for (Uint32 bx = 0; bx < blocksWide; ++bx) {
+          Uint8 pixels[16 * 4];
+          for (Uint32 y = 0; y < 4; ++y) {
+            for (Uint32 x = 0; x < 4; ++x) {
+              Uint32 sx = std::min(bx * 4 + x, size.x - 1), sy = std::min(by * 4 + y, size.y - 1);
+              const Uint8* source = data + (static_cast<Size>(sy) * size.x + sx) * colorChannels;
+              Uint8* pixel = pixels + (y * 4 + x) * 4;
+              pixel[0] = source[0];
+              pixel[1] = source[1];
+              pixel[2] = source[2];
+              pixel[3] = (colorChannels == 4) ? source[3] : 255;
+            }
+          }
+
+          if (format == CookedTextureFormat::BC3) {
+            encodeAlphaBlock(pixels, block);
+            encodeColorBlock(pixels, block + 8);
+          } else {
+            encodeColorBlock(pixels, block);
+          }
+
+          block += blockSize;
+        }
+      }
+
+      return output;
+    }
+
+    /**
+     * @brief Halves the size of the given tightly-packed image, averaging each two-by-two square
+     *        of pixels. Along an odd edge, the last row or column is averaged with itself. The
+     *        halved size is written to @a `halfSize`, which must not be @a `size` itself.
+     */
+    Collection<Uint8> downsampleImage (const Uint8* data, const Vector2u& size,
+      Uint32 colorChannels, Vector2u& halfSize)
+    {
+      halfSize = { std::max(size.x / 2, 1u), std::max(size.y / 2, 1u) };
+      Collection<Uint8> output(static_cast<Size>(halfSize.x) * halfSize.y * colorChannels);
+
+      Uint8* pixel = output.data();
+      for (Uint32 y = 0; y < halfSize.y; ++y) {
+        const Uint8* row0 = data + static_cast<Size>(std::min(y * 2, size.y - 1)) * size.x *
+          colorChannels;
+        const Uint8* row1 = data + static_cast<Size>(std::min(y * 2 + 1, size.y - 1)) * size.x *
+          colorChannels;
+
+        for (Uint32 x = 0; x < halfSize.x; ++x) {
+          const Size x0 = static_cast<Size>(std::min(x * 2, size.x - 1)) * colorChannels;
+          const Size x1 = static_cast<Size>(std::min(x * 2 + 1, size.x - 1)) * colorChannels;
+          for (Uint32 c = 0; c < colorChannels; ++c) {
+            *pixel++ = static_cast<Uint8>(
+              (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4
+            );
+          }
+        }
+      }
+
+      return output;
+    }
+
+    Bool isCookableImage (const Path& path)
+    {
+      String extension = path.extension().string();
+      std::transform(extension.begin(), extension.end(), extension.begin(),
+        [] (char c) { return static_cast<char>(std::tolower(c)); });
+
+      return std::find(std::begin(COOKABLE_EXTENSIONS), std::end(COOKABLE_EXTENSIONS),
+        extension) != std::end(COOKABLE_EXTENSIONS);
+    }
+
+  }
+
+  Bool TextureCooker::cook (const Path& source, const Path& output,
+    const TextureCookSpecification& spec)
+  {
+    if (fs::exists(source) == false) {
+      DG_ENGINE_ERROR("Image filename '{}' not found.", source.string());
+      return false;
+    }
+
+    // Decode the image the same way the texture loader would, so that the cooked pixel data can
+    // be uploaded as it is.
+    stbi_set_flip_vertically_on_load_thread(true);
+    Int32 width = 0, height = 0, colorChannels = 0;
+    Uint8* data = stbi_load(source.c_str(), &width, &height, &colorChannels, 0);
+    if (data == nullptr) {
+      DG_ENGINE_ERROR("Could not load image file '{}' - {}", source.string(),
+        stbi_failure_reason());
+      return false;
+    }
+
+    CookedTextureHeader header;
+    header.width = static_cast<Uint32>(width);
+    header.height = static_cast<Uint32>(height);
+    header.colorChannels = static_cast<Uint32>(colorChannels);
+    if (spec.compress == true && colorChannels >= 3) {
+      header.format = (colorChannels == 4) ? CookedTextureFormat::BC3 : CookedTextureFormat::BC1;
+    }
+
+    // Build each level of the mip chain from the one before it, block-compressing RGB and RGBA
+    // images if asked to. Levels are stored largest first.
+    Collection<Uint8> payload;
+    Collection<Uint8> level { data, data + static_cast<Size>(width) * height * colorChannels };
+    Vector2u levelSize = { header.width, header.height };
+    header.mipCount = (spec.mipmaps == true) ? TextureContainer::getFullLevelCount(levelSize) : 1;
+    stbi_image_free(data);
+
+    for (Index i = 0; i < header.mipCount; ++i) {
+      if (header.format != CookedTextureFormat::Raw) {
+        auto compressed = Private::compressImage(level.data(), levelSize, header.colorChannels,
+          header.format);
+        payload.insert(payload.end(), compressed.begin(), compressed.end());
+      } else {
+        payload.insert(payload.end(), level.begin(), level.end());
+      }
+
+      if (i + 1 < header.mipCount) {
+        Vector2u halfSize = { 0, 0 };
+        level = Private::downsampleImage(level.data(), levelSize, header.colorChannels, halfSize);
+        levelSize = halfSize;
+      }
+    }
+
+    header.payloadSize = payload.size();
+
+    // Write to a temporary file first, so that a failed cook never leaves behind a cooked texture
+    // file which looks newer than its image file.
+    Path temporary = output;
+    temporary += ".tmp";
+
+    Bool written = false;
+    {
+      std::fstream file { temporary, std::ios::out | std::ios::binary | std::ios::trunc };
+      if (file.is_open() == true) {
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(payload.data()), header.payloadSize);
+        written = file.good();
+      }
+    }
+
+    std::error_code error;
+    if (written == true) {
+      fs::rename(temporary, output, error);
+    }
+
+    if (written == false || error) {
+      DG_ENGINE_ERROR("Could not write cooked texture file '{}'.", output.string());
+      fs::remove(temporary, error);
+      return false;
+    }
+
+    DG_ENGINE_INFO("Cooked texture '{}' ({}x{}, {} channels, {} levels, {} bytes).",
+      output.string(), width, height, colorChannels, header.mipCount, header.payloadSize);
+    return true;
+  }
+
+  Count TextureCooker::cookDirectory (const Path& directory,
+    const TextureCookSpecification& spec)
+  {
+    if (fs::is_directory(directory) == false) {
+      DG_ENGINE_ERROR("Texture directory '{}' not found.", directory.string());
+      return 0;
+    }
+
+    Count count = 0;
+    for (const auto& entry : fs::recursive_directory_iterator { directory }) {
+      if (entry.is_regular_file() == false || Private::isCookableImage(entry.path()) == false) {
+        continue;
+      }
+
+      if (isUpToDate(entry.path()) == false && cook(entry.path(),
+          getCookedPath(entry.path()), spec) == true) {
+        count++;
+      }
+    }
+
+    return count;
+  }
+
+  Bool TextureCooker::load (const Path& path, CookedTexture& texture)
+  {
+    auto file = MappedFile::make(path);
+    if (file == nullptr) {
+      return false;
+    }
+
+    CookedTextureHeader header;
+    if (file->getSize() < sizeof(header)) {
+      DG_ENGINE_ERROR("Cooked texture file '{}' is too small.", path.string());
+      return false;
+    }
+
+    std::memcpy(&header, file->getData(), sizeof(header));
+    if (header.magic != COOKED_TEXTURE_MAGIC) {
+      DG_ENGINE_ERROR("File '{}' is not a cooked texture file.", path.string());
+      return false;
+    } else if (header.version != COOKED_TEXTURE_VERSION) {
+      DG_ENGINE_ERROR("Cooked texture file '{}' has unsupported version {}.", path.string(),
+        header.version);
+      return false;
+    } else if (header.format > CookedTextureFormat::BC7) {
+      DG_ENGINE_ERROR("Cooked texture file '{}' has unsupported format {}.", path.string(),
+        static_cast<Uint16>(header.format));
+      return false;
+    } else if (
+      header.width == 0 || header.height == 0 || header.mipCount == 0 ||
+      header.mipCount > TextureContainer::getFullLevelCount({ header.width, header.height }) ||
+      header.colorChannels == 0 || header.colorChannels > 4
+    ) {
+      DG_ENGINE_ERROR("Cooked texture file '{}' has an invalid header.", path.string());
+      return false;
+    }
+
+    // Every level of the mip chain must fit within the payload.
+    auto levels = TextureContainer::getPackedLevels(getCompressedFormat(header.format),
+      header.colorChannels, { header.width, header.height }, header.mipCount);
+    if (
+      header.payloadSize < levels.back().offset + levels.back().byteCount ||
+      file->getSize() - sizeof(header) < header.payloadSize
+    ) {
+      DG_ENGINE_ERROR("Cooked texture file '{}' is truncated.", path.string());
+      return false;
+    }
+
+    texture.payload = file->getData() + sizeof(header);
+    texture.header = header;
+    texture.file = std::move(file);
+    return true;
+  }
+
+  GLenum TextureCooker::getCompressedFormat (CookedTextureFormat format)
+  {
+    switch (format) {
+      case CookedTextureFormat::BC1:  return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+      case CookedTextureFormat::BC3:  return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+      case CookedTextureFormat::BC7:  return GL_COMPRESSED_RGBA_BPTC_UNORM;
+      default: return 0;
+    }
+  }
+
+  Path TextureCooker::getCookedPath (const Path& source)
+  {
+    Path cooked = source;
+    cooked += COOKED_TEXTURE_EXTENSION;
+    return cooked;
+  }
+
+  Path TextureCooker::getSourcePath (const Path& path)
+  {
+    if (isCookedPath(path) == false) {
+      return path;
+    }
+
+    Path source = path;
+    source.replace_extension();
+    return source;
+  }
+
+  Bool TextureCooker::isCookedPath (const Path& path)
+  {
+    return path.extension() == COOKED_TEXTURE_EXTENSION;
+  }
+
+  Bool TextureCooker::isUpToDate (const Path& source)
+  {
+    std::error_code error;
+    Path cooked = getCookedPath(source);
+    if (fs::exists(cooked, error) == false) {
+      return false;
+    }
+
+    // A cooked texture file shipped without its image file is always used.
+    if (fs::exists(source, error) == false) {
+      return true;
+    }
+
+    auto cookedTime = fs::last_write_time(cooked, error);
+    if (error) { return false; }
+    auto sourceTime = fs::last_write_time(source, error);
+    if (error) { return false; }
+
+    return cookedTime >= sourceTime;
+  }
+
+  Path TextureCooker::resolve (const Path& source)
+  {
+    if (isCookedPath(source) == false && isUpToDate(source) == true) {
+      return getCookedPath(source);
+    }
+
+    return source;
+  }
+
+}
@@ -0,0 +1,141 @@
+/** @file DG/Graphics/TextureResidency.cpp */
+
+#include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/TextureResidency.hpp>
+
+namespace dg
+{
+
+  TextureResidencySpecification TextureResidency::s_spec;
+  TextureResidencyStats TextureResidency::s_stats;
+  Collection<TextureResidency::Entry> TextureResidency::s_entries;
+
+  void TextureResidency::initialize (const TextureResidencySpecification& spec)
+  {
+    shutdown();
+
+    s_spec = spec;
+    s_stats.budget = s_spec.budget;
+  }
+
+  void TextureResidency::shutdown ()
+  {
+    for (auto& entry : s_entries) {
+      entry.texture->m_evicted = false;
+    }
+    s_entries.clear();
+
+    s_spec = {};
+    s_stats = {};
+  }
+
+  void TextureResidency::track (Texture& texture, const String& key)
+  {
+    auto iter = std::find_if(s_entries.begin(), s_entries.end(),
+      [&texture] (const Entry& entry) { return entry.texture == &texture; });
+    if (iter != s_entries.end()) {
+      iter->key = key;
+      return;
+    }
+
+    // Count a newly-tracked texture as drawn now, so that it is not evicted before it is drawn.
+    texture.m_lastUsedFrame = s_stats.frame;
+    s_entries.push_back({ &texture, key });
+  }
+
+  void TextureResidency::untrack (const Texture& texture)
+  {
+    auto iter = std::find_if(s_entries.begin(), s_entries.end(),
+      [&texture] (const Entry& entry) { return entry.texture == &texture; });
+    if (iter != s_entries.end()) {
+      s_entries.erase(iter);
+    }
+  }
+
+  void TextureResidency::touch (const Ref<Texture>& texture)
+  {
+    texture->m_lastUsedFrame = s_stats.frame;
+    if (texture->m_evicted == false) {
+      return;
+    }
+
+    auto iter = std::find_if(s_entries.begin(), s_entries.end(),
+      [&texture] (const Entry& entry) { return entry.texture == texture.get(); });
+    if (iter == s_entries.end()) {
+      return;
+    }
+
+    // The texture keeps its specification, so it comes back with the same filter and mipmap
+    // settings it was evicted with.
+    texture->m_evicted = false;
+    s_stats.reloadCount++;
+    Texture::loadAsync(texture, texture->m_filepath, iter->key);
+  }
+
+  void TextureResidency::update ()
+  {
+    count();
+
+    if (s_spec.budget != 0 && s_stats.residentByteCount > s_spec.budget) {
+
+      // Gather the textures which may be evicted: those which are resident, and were not drawn
+      // in the frame just finished. Pending textures are still being uploaded, and are spared.
+      Collection<Texture*> candidates;
+      for (const auto& entry : s_entries) {
+        if (entry.texture->isValid() == true && entry.texture->m_lastUsedFrame < s_stats.frame) {
+          candidates.push_back(entry.texture);
+        }
+      }
+
+      // Evict the least recently drawn textures first.
+      std::sort(candidates.begin(), candidates.end(),
+        [] (const Texture* left, const Texture* right)
+        {
+          return left->m_lastUsedFrame < right->m_lastUsedFrame;
+        });
+
+      Size byteCount = s_stats.residentByteCount;
+      for (Texture* texture : candidates) {
+        if (byteCount <= s_spec.budget) { break; }
+
+        byteCount -= texture->getByteCount();
+        texture->evict();
+        s_stats.evictionCount++;
+      }
+
+      count();
+
+    }
+
+    s_stats.frame++;
+  }
+
+  void TextureResidency::setBudget (Size budget)
+  {
+    s_spec.budget = budget;
+    s_stats.budget = budget;
+  }
+
+  const TextureResidencyStats& TextureResidency::getStats ()
+  {
+    return s_stats;
+  }
+
+  void TextureResidency::count ()
+  {
+    s_stats.trackedCount = s_entries.size();
+    s_stats.residentCount = 0;
+    s_stats.evictedCount = 0;
+    s_stats.residentByteCount = 0;
+
+    for (const auto& entry : s_entries) {
+      if (entry.texture->m_evicted == true) {
+        s_stats.evictedCount++;
+      } else if (entry.texture->getByteCount() > 0) {
+        s_stats.residentCount++;
+        s_stats.residentByteCount += entry.texture->getByteCount();
+      }
+    }
+  }
+
+}
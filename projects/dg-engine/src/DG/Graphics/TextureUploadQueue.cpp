@@ -0,0 +1,213 @@
+/** @file DG/Graphics/TextureUploadQueue.cpp */
+
+#include <DG/Graphics/Texture.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
+#include <DG/Graphics/TextureUploadQueue.hpp>
+
+namespace dg
+{
+
+  TextureUploadSpecification TextureUploadQueue::s_spec;
+  Collection<TextureUploadQueue::Upload> TextureUploadQueue::s_uploads;
+  Collection<Uint32> TextureUploadQueue::s_buffers;
+  Collection<Uint32> TextureUploadQueue::s_fences;
+  Index TextureUploadQueue::s_bufferIndex = 0;
+
+  void TextureUploadQueue::initialize (const TextureUploadSpecification& spec)
+  {
+    shutdown();
+
+    s_spec = spec;
+    if (s_spec.enabled == false) {
+      return;
+    }
+
+    if (s_spec.frameBudget == 0 || s_spec.bufferCount == 0 || s_spec.bufferSize == 0) {
+      DG_ENGINE_WARN("Texture upload queue has no budget or buffers; uploading synchronously.");
+      s_spec.enabled = false;
+      return;
+    }
+
+    // The buffers' storage is allocated once, here, and each is fenced off after it is staged
+    // into, until the graphics card has finished reading from it.
+    auto& backend = RenderInterface::getBackend();
+    for (Index i = 0; i < s_spec.bufferCount; ++i) {
+      Uint32 buffer = backend.createBuffer();
+      backend.allocateBuffer(GL_PIXEL_UNPACK_BUFFER, buffer, nullptr, s_spec.bufferSize,
+        GL_STREAM_DRAW);
+      s_buffers.push_back(buffer);
+      s_fences.push_back(0);
+    }
+    backend.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
+
+  void TextureUploadQueue::shutdown ()
+  {
+    for (auto& upload : s_uploads) {
+      upload.texture->m_pending = false;
+    }
+    s_uploads.clear();
+
+    if (s_buffers.empty() == false) {
+      auto& backend = RenderInterface::getBackend();
+      for (Uint32 fence : s_fences) {
+        backend.destroyFence(fence);
+      }
+      for (Uint32 buffer : s_buffers) {
+        backend.destroyBuffer(buffer);
+      }
+      s_fences.clear();
+      s_buffers.clear();
+    }
+
+    s_bufferIndex = 0;
+    s_spec.enabled = false;
+  }
+
+  Bool TextureUploadQueue::isEnabled ()
+  {
+    return s_spec.enabled;
+  }
+
+  void TextureUploadQueue::enqueue (Texture& texture, Uint32 handle, PixelData pixels,
+    const Collection<TextureLevel>& levels, GLenum pixelFormat, Uint32 channels,
+    Bool generateMipmaps)
+  {
+    if (pixels == nullptr || levels.empty() == true || levels[0].size.x == 0 ||
+        levels[0].size.y == 0) {
+      throw std::invalid_argument { "Attempted 'enqueue' of empty texture upload!" };
+    }
+
+    cancel(texture);
+
+    Upload& upload = s_uploads.emplace_back();
+    upload.texture = &texture;
+    upload.handle = handle;
+    upload.pixels = std::move(pixels);
+    upload.levels = levels;
+    upload.pixelFormat = pixelFormat;
+    upload.channels = channels;
+    upload.generateMipmaps = generateMipmaps;
+
+    texture.m_valid = false;
+    texture.m_pending = true;
+  }
+
+  void TextureUploadQueue::cancel (const Texture& texture)
+  {
+    auto iter = std::find_if(s_uploads.begin(), s_uploads.end(),
+      [&texture] (const Upload& upload) { return upload.texture == &texture; });
+    if (iter != s_uploads.end()) {
+      iter->texture->m_pending = false;
+      s_uploads.erase(iter);
+    }
+  }
+
+  void TextureUploadQueue::process ()
+  {
+    upload(s_spec.frameBudget, false);
+  }
+
+  void TextureUploadQueue::flush ()
+  {
+    upload(std::numeric_limits<Size>::max(), true);
+  }
+
+  Count TextureUploadQueue::getPendingCount ()
+  {
+    return s_uploads.size();
+  }
+
+  Size TextureUploadQueue::getPendingByteCount ()
+  {
+    Size byteCount = 0;
+    for (const auto& upload : s_uploads) {
+      for (Index i = upload.levelIndex; i < upload.levels.size(); ++i) {
+        byteCount += upload.levels[i].byteCount;
+      }
+      byteCount -= static_cast<Size>(upload.rowsUploaded) *
+        upload.levels[upload.levelIndex].size.x * upload.channels;
+    }
+
+    return byteCount;
+  }
+
+  void TextureUploadQueue::upload (Size budget, Bool wait)
+  {
+    if (s_uploads.empty() == true) { return; }
+
+    // Decoded pixel rows are tightly packed.
+    auto& backend = RenderInterface::getBackend();
+    backend.setPixelStore(GL_UNPACK_ALIGNMENT, 1);
+
+    Bool first = true;
+    while (s_uploads.empty() == false && budget > 0) {
+      Upload& upload = s_uploads.front();
+      const TextureLevel& level = upload.levels[upload.levelIndex];
+      const Size rowSize = static_cast<Size>(level.size.x) * upload.channels;
+
+      // Stage as many whole rows as fit in both the remaining budget and a buffer. The first
+      // chunk of each call always gets at least one row, so that a budget smaller than a row
+      // still makes progress.
+      Size rowLimit = std::min(budget, s_spec.bufferSize) / rowSize;
+      Uint32 rows = static_cast<Uint32>(
+        std::min<Size>(level.size.y - upload.rowsUploaded, rowLimit)
+      );
+      if (rows == 0) {
+        if (first == false) { break; }
+        rows = 1;
+      }
+
+      const Size byteCount = rows * rowSize;
+      const Uint8* pixels = upload.pixels.get() + level.offset + upload.rowsUploaded * rowSize;
+
+      if (byteCount > s_spec.bufferSize) {
+        // A single row is larger than a buffer, so upload it straight from memory.
+        backend.uploadTexture2D(upload.handle, { 0, upload.rowsUploaded }, { level.size.x, rows },
+          upload.pixelFormat, GL_UNSIGNED_BYTE, pixels, upload.levelIndex);
+      } else {
+        // The next buffer in the ring may still be read from by an earlier upload. Writing into
+        // it before its fence signals would stall, so a frame's uploads stop there instead, and
+        // pick up again next frame.
+        Uint32& fence = s_fences[s_bufferIndex];
+        if (fence != 0 && backend.pollFence(fence, wait) == false) {
+          break;
+        }
+
+        Uint32 buffer = s_buffers[s_bufferIndex];
+        s_bufferIndex = (s_bufferIndex + 1) % s_buffers.size();
+        backend.uploadBuffer(GL_PIXEL_UNPACK_BUFFER, buffer, pixels, byteCount);
+        backend.uploadTexture2DFromBuffer(upload.handle, { 0, upload.rowsUploaded },
+          { level.size.x, rows }, upload.pixelFormat, GL_UNSIGNED_BYTE, buffer, 0,
+          upload.levelIndex);
+        fence = backend.insertFence();
+      }
+
+      upload.rowsUploaded += rows;
+      budget -= std::min(budget, byteCount);
+      first = false;
+
+      if (upload.rowsUploaded < level.size.y) {
+        continue;
+      }
+
+      // Move on to the next level, if there is one.
+      upload.rowsUploaded = 0;
+      if (++upload.levelIndex < upload.levels.size()) {
+        continue;
+      }
+
+      if (upload.generateMipmaps == true) {
+        backend.generateTextureMipmaps(upload.handle);
+      }
+
+      upload.texture->m_pending = false;
+      upload.texture->m_valid = true;
+      s_uploads.erase(s_uploads.begin());
+    }
+
+    // Restore OpenGL's default alignment.
+    backend.setPixelStore(GL_UNPACK_ALIGNMENT, 4);
+  }
+
+}
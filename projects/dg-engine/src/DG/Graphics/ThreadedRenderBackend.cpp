@@ -0,0 +1,892 @@
+/** @file DG/Graphics/ThreadedRenderBackend.cpp */
+
+#include <DG/Graphics/ThreadedRenderBackend.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    static Size getUniformByteCount (const ShaderUniformType type)
+    {
+      switch (type)
+      {
+        case ShaderUniformType::Float:      return sizeof(Float32);
+        case ShaderUniformType::Float2:     return sizeof(Float32) * 2;
+        case ShaderUniformType::Float3:     return sizeof(Float32) * 3;
+        case ShaderUniformType::Float4:     return sizeof(Float32) * 4;
+        case ShaderUniformType::Float2x2:   return sizeof(Float32) * 4;
+        case ShaderUniformType::Float3x3:   return sizeof(Float32) * 9;
+        case ShaderUniformType::Float4x4:   return sizeof(Float32) * 16;
+        case ShaderUniformType::Double:     return sizeof(Float64);
+        case ShaderUniformType::Double2:    return sizeof(Float64) * 2;
+        case ShaderUniformType::Double3:    return sizeof(Float64) * 3;
+        case ShaderUniformType::Double4:    return sizeof(Float64) * 4;
+        case ShaderUniformType::Double2x2:  return sizeof(Float64) * 4;
+        case ShaderUniformType::Double3x3:  return sizeof(Float64) * 9;
+        case ShaderUniformType::Double4x4:  return sizeof(Float64) * 16;
+        case ShaderUniformType::Int:
+        case ShaderUniformType::Uint:       return sizeof(Int32);
+        case ShaderUniformType::Int2:
+        case ShaderUniformType::Uint2:      return sizeof(Int32) * 2;
+        case ShaderUniformType::Int3:
+        case ShaderUniformType::Uint3:      return sizeof(Int32) * 3;
+        case ShaderUniformType::Int4:
+        case ShaderUniformType::Uint4:      return sizeof(Int32) * 4;
+        default:                            return 0;
+      }
+    }
+
+  }
+
+  ThreadedRenderBackend::ThreadedRenderBackend (Scope<RenderBackend> backend,
+    const RenderThreadSpecification& spec) :
+      m_backend { std::move(backend) },
+      m_spec    { spec }
+  {
+    if (m_backend == nullptr) {
+      throw std::invalid_argument {
+        "Attempted to create threaded render backend with no backend!"
+      };
+    }
+
+    // At least two queues are needed: one being recorded, and one being carried out.
+    if (m_spec.frameCount < 2) {
+      DG_ENGINE_WARN("Render thread needs at least two frame command buffers; using two.");
+      m_spec.frameCount = 2;
+    }
+
+    m_queues.resize(m_spec.frameCount);
+    m_handles.push_back(0);
+  }
+
+  ThreadedRenderBackend::~ThreadedRenderBackend ()
+  {
+    if (m_thread.joinable() == false) {
+      return;
+    }
+
+    // Have the render thread carry out everything recorded so far, then stop.
+    if (m_failed.load(std::memory_order_acquire) == false) {
+      record([this] () { m_stopping = true; });
+      publish();
+    }
+
+    m_thread.join();
+  }
+
+  RenderBackendType ThreadedRenderBackend::getType () const
+  {
+    return m_backend->getType();
+  }
+
+  void ThreadedRenderBackend::initialize ()
+  {
+    if (m_thread.joinable() == true) {
+      throw std::runtime_error { "Threaded render backend is already initialized!" };
+    }
+
+    DG_ENGINE_INFO("Starting render thread with {} frame command buffers.", m_spec.frameCount);
+    m_thread = std::thread { [this] () { run(); } };
+
+    // The inner backend may only be initialized once its context is current on the render thread.
+    record([this] () { m_backend->initialize(); });
+    flush();
+  }
+
+  /** State and Draw Calls ************************************************************************/
+
+  void ThreadedRenderBackend::setViewport (const Vector2i& position, const Vector2u& size)
+  {
+    record([this, position, size] () { m_backend->setViewport(position, size); });
+  }
+
+  void ThreadedRenderBackend::setClearColor (const Color& color)
+  {
+    record([this, color] () { m_backend->setClearColor(color); });
+  }
+
+  void ThreadedRenderBackend::clear ()
+  {
+    record([this] () { m_backend->clear(); });
+  }
+
+  void ThreadedRenderBackend::setPixelStore (GLenum name, Int32 value)
+  {
+    // Texture data is copied when recorded, so the size of its rows must be known up front.
+    if (name == GL_UNPACK_ALIGNMENT) {
+      m_unpackAlignment = value;
+    }
+
+    record([this, name, value] () { m_backend->setPixelStore(name, value); });
+  }
+
+  void ThreadedRenderBackend::drawIndexed (GLenum primitive, Count indexCount, GLenum indexType)
+  {
+    record([this, primitive, indexCount, indexType] () {
+      m_backend->drawIndexed(primitive, indexCount, indexType);
+    });
+  }
+
+  /** Buffers *************************************************************************************/
+
+  Uint32 ThreadedRenderBackend::createBuffer ()
+  {
+    Uint32 handle = allocateHandle();
+    record([this, handle] () { bindHandle(handle, m_backend->createBuffer()); });
+    return handle;
+  }
+
+  void ThreadedRenderBackend::destroyBuffer (Uint32 handle)
+  {
+    record([this, handle] () {
+      m_backend->destroyBuffer(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  void ThreadedRenderBackend::bindBuffer (GLenum target, Uint32 handle)
+  {
+    record([this, target, handle] () { m_backend->bindBuffer(target, resolveHandle(handle)); });
+  }
+
+  void ThreadedRenderBackend::allocateBuffer (GLenum target, Uint32 handle, const void* data,
+    Size size, GLenum usage)
+  {
+    const void* copied = copy(data, size);
+    record([this, target, handle, copied, size, usage] () {
+      m_backend->allocateBuffer(target, resolveHandle(handle), copied, size, usage);
+    });
+  }
+
+  void ThreadedRenderBackend::uploadBuffer (GLenum target, Uint32 handle, const void* data,
+    Size size, Size offset)
+  {
+    const void* copied = copy(data, size);
+    record([this, target, handle, copied, size, offset] () {
+      m_backend->uploadBuffer(target, resolveHandle(handle), copied, size, offset);
+    });
+  }
+
+  /** Vertex Arrays *******************************************************************************/
+
+  Uint32 ThreadedRenderBackend::createVertexArray ()
+  {
+    Uint32 handle = allocateHandle();
+    record([this, handle] () { bindHandle(handle, m_backend->createVertexArray()); });
+    return handle;
+  }
+
+  void ThreadedRenderBackend::destroyVertexArray (Uint32 handle)
+  {
+    record([this, handle] () {
+      m_backend->destroyVertexArray(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  void ThreadedRenderBackend::bindVertexArray (Uint32 handle)
+  {
+    record([this, handle] () { m_backend->bindVertexArray(resolveHandle(handle)); });
+  }
+
+  void ThreadedRenderBackend::setVertexAttribute (Index index, Count elementCount, GLenum type,
+    Bool normalized, Size stride, Size offset)
+  {
+    record([this, index, elementCount, type, normalized, stride, offset] () {
+      m_backend->setVertexAttribute(index, elementCount, type, normalized, stride, offset);
+    });
+  }
+
+  /** Textures ************************************************************************************/
+
+  Uint32 ThreadedRenderBackend::createTexture ()
+  {
+    Uint32 handle = allocateHandle();
+    record([this, handle] () { bindHandle(handle, m_backend->createTexture()); });
+    return handle;
+  }
+
+  void ThreadedRenderBackend::destroyTexture (Uint32 handle)
+  {
+    record([this, handle] () {
+      m_backend->destroyTexture(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  void ThreadedRenderBackend::bindTexture (GLenum target, Uint32 handle, Index slot)
+  {
+    record([this, target, handle, slot] () {
+      m_backend->bindTexture(target, resolveHandle(handle), slot);
+    });
+  }
+
+  void ThreadedRenderBackend::setTextureParameter (GLenum target, Uint32 handle, GLenum name,
+    Int32 value)
+  {
+    record([this, target, handle, name, value] () {
+      m_backend->setTextureParameter(target, resolveHandle(handle), name, value);
+    });
+  }
+
+  void ThreadedRenderBackend::allocateTexture2D (Uint32 handle, GLenum internalFormat,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void* data)
+  {
+    const void* copied = copy(data,
+      getImageByteCount(size, pixelFormat, dataType, m_unpackAlignment));
+    record([this, handle, internalFormat, size, pixelFormat, dataType, copied] () {
+      m_backend->allocateTexture2D(resolveHandle(handle), internalFormat, size, pixelFormat,
+        dataType, copied);
+    });
+  }
+
+  void ThreadedRenderBackend::allocateTexture2DMultisample (Uint32 handle, Uint32 sampleCount,
+    GLenum internalFormat, const Vector2u& size)
+  {
+    record([this, handle, sampleCount, internalFormat, size] () {
+      m_backend->allocateTexture2DMultisample(resolveHandle(handle), sampleCount, internalFormat,
+        size);
+    });
+  }
+
+  void ThreadedRenderBackend::allocateTextureStorage2D (Uint32 handle, Count levelCount,
+    GLenum internalFormat, const Vector2u& size)
+  {
+    record([this, handle, levelCount, internalFormat, size] () {
+      m_backend->allocateTextureStorage2D(resolveHandle(handle), levelCount, internalFormat, size);
+    });
+  }
+
+  Bool ThreadedRenderBackend::isTextureFormatSupported (GLenum internalFormat)
+  {
+    // The answer is only known once the render thread has initialized the wrapped backend.
+    flush();
+    return m_backend->isTextureFormatSupported(internalFormat);
+  }
+
+  void ThreadedRenderBackend::uploadTexture2D (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, const void* data, Index level)
+  {
+    const void* copied = copy(data,
+      getImageByteCount(size, pixelFormat, dataType, m_unpackAlignment));
+    record([this, handle, offset, size, pixelFormat, dataType, copied, level] () {
+      m_backend->uploadTexture2D(resolveHandle(handle), offset, size, pixelFormat, dataType,
+        copied, level);
+    });
+  }
+
+  void ThreadedRenderBackend::uploadTexture2DFromBuffer (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum pixelFormat, GLenum dataType, Uint32 buffer, Size bufferOffset,
+    Index level)
+  {
+    record([this, handle, offset, size, pixelFormat, dataType, buffer, bufferOffset, level] () {
+      m_backend->uploadTexture2DFromBuffer(resolveHandle(handle), offset, size, pixelFormat,
+        dataType, resolveHandle(buffer), bufferOffset, level);
+    });
+  }
+
+  void ThreadedRenderBackend::uploadCompressedTexture2D (Uint32 handle, const Vector2u& offset,
+    const Vector2u& size, GLenum compressedFormat, const void* data, Size byteCount, Index level)
+  {
+    const void* copied = copy(data, byteCount);
+    record([this, handle, offset, size, compressedFormat, copied, byteCount, level] () {
+      m_backend->uploadCompressedTexture2D(resolveHandle(handle), offset, size, compressedFormat,
+        copied, byteCount, level);
+    });
+  }
+
+  void ThreadedRenderBackend::generateTextureMipmaps (Uint32 handle)
+  {
+    record([this, handle] () { m_backend->generateTextureMipmaps(resolveHandle(handle)); });
+  }
+
+  void ThreadedRenderBackend::clearTexture (Uint32 handle, GLenum pixelFormat, GLenum dataType,
+    const void* data)
+  {
+    // The clear value is a single pixel.
+    const void* copied = copy(data, getImageByteCount({ 1, 1 }, pixelFormat, dataType));
+    record([this, handle, pixelFormat, dataType, copied] () {
+      m_backend->clearTexture(resolveHandle(handle), pixelFormat, dataType, copied);
+    });
+  }
+
+  /** Frame Buffers *******************************************************************************/
+
+  Uint32 ThreadedRenderBackend::createFramebuffer ()
+  {
+    Uint32 handle = allocateHandle();
+    record([this, handle] () { bindHandle(handle, m_backend->createFramebuffer()); });
+    return handle;
+  }
+
+  void ThreadedRenderBackend::destroyFramebuffer (Uint32 handle)
+  {
+    record([this, handle] () {
+      m_backend->destroyFramebuffer(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  void ThreadedRenderBackend::bindFramebuffer (GLenum target, Uint32 handle)
+  {
+    record([this, target, handle] () {
+      m_backend->bindFramebuffer(target, resolveHandle(handle));
+    });
+  }
+
+  void ThreadedRenderBackend::attachFramebufferTexture (GLenum attachment, GLenum textureTarget,
+    Uint32 texture)
+  {
+    record([this, attachment, textureTarget, texture] () {
+      m_backend->attachFramebufferTexture(attachment, textureTarget, resolveHandle(texture));
+    });
+  }
+
+  void ThreadedRenderBackend::setDrawBuffers (const GLenum* buffers, Count count)
+  {
+    auto copied = static_cast<const GLenum*>(copy(buffers, sizeof(GLenum) * count));
+    record([this, copied, count] () { m_backend->setDrawBuffers(copied, count); });
+  }
+
+  void ThreadedRenderBackend::setReadBuffer (GLenum buffer)
+  {
+    record([this, buffer] () { m_backend->setReadBuffer(buffer); });
+  }
+
+  void ThreadedRenderBackend::clearFramebufferColor (Uint32 framebuffer, Index index,
+    const Vector4f& color)
+  {
+    record([this, framebuffer, index, color] () {
+      m_backend->clearFramebufferColor(resolveHandle(framebuffer), index, color);
+    });
+  }
+
+  void ThreadedRenderBackend::clearFramebufferInteger (Uint32 framebuffer, Index index,
+    const Vector4i& value)
+  {
+    record([this, framebuffer, index, value] () {
+      m_backend->clearFramebufferInteger(resolveHandle(framebuffer), index, value);
+    });
+  }
+
+  void ThreadedRenderBackend::clearFramebufferDepthStencil (Uint32 framebuffer, Float32 depth,
+    Int32 stencil)
+  {
+    record([this, framebuffer, depth, stencil] () {
+      m_backend->clearFramebufferDepthStencil(resolveHandle(framebuffer), depth, stencil);
+    });
+  }
+
+  void ThreadedRenderBackend::invalidateFramebuffer (Uint32 framebuffer,
+    const GLenum* attachments, Count count)
+  {
+    const void* copied = copy(attachments, count * sizeof(GLenum));
+    record([this, framebuffer, copied, count] () {
+      m_backend->invalidateFramebuffer(resolveHandle(framebuffer),
+        static_cast<const GLenum*>(copied), count);
+    });
+  }
+
+  void ThreadedRenderBackend::blitFramebuffer (Uint32 source, Index sourceIndex,
+    const Vector2i& sourcePosition, const Vector2u& sourceSize, Uint32 destination,
+    Index destinationIndex, const Vector2i& destinationPosition, const Vector2u& destinationSize,
+    Bool linear)
+  {
+    record([this, source, sourceIndex, sourcePosition, sourceSize, destination, destinationIndex,
+      destinationPosition, destinationSize, linear] () {
+      m_backend->blitFramebuffer(resolveHandle(source), sourceIndex, sourcePosition, sourceSize,
+        resolveHandle(destination), destinationIndex, destinationPosition, destinationSize,
+        linear);
+    });
+  }
+
+  Bool ThreadedRenderBackend::isFramebufferComplete ()
+  {
+    Bool complete = false;
+    record([this, &complete] () { complete = m_backend->isFramebufferComplete(); });
+    flush();
+
+    return complete;
+  }
+
+  void ThreadedRenderBackend::readPixels (const Vector2i& position, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType, void* data)
+  {
+    // The render thread writes straight into the caller's buffer, which stays alive because
+    // this waits for it to finish.
+    record([this, position, size, pixelFormat, dataType, data] () {
+      m_backend->readPixels(position, size, pixelFormat, dataType, data);
+    });
+    flush();
+  }
+
+  Uint32 ThreadedRenderBackend::beginReadback (const Vector2i& position, const Vector2u& size,
+    GLenum pixelFormat, GLenum dataType)
+  {
+    // The render thread copies finished pixels into the readback's own buffer, so the caller's
+    // memory is only written to on the recording thread.
+    Uint32 handle = allocateHandle();
+    auto state = makeRef<ReadbackState>();
+    state->pixels.resize(getImageByteCount(size, pixelFormat, dataType));
+    m_readbacks.emplace(handle, state);
+    record([this, handle, position, size, pixelFormat, dataType] () {
+      bindHandle(handle, m_backend->beginReadback(position, size, pixelFormat, dataType));
+    });
+
+    return handle;
+  }
+
+  ReadbackStatus ThreadedRenderBackend::pollReadback (Uint32 handle, void* data, Bool wait)
+  {
+    auto iter = m_readbacks.find(handle);
+    if (iter == m_readbacks.end()) {
+      return ReadbackStatus::Failed;
+    }
+
+    // As with shader programs, the state seen here may lag the real state by a frame or two.
+    auto state = iter->second;
+    record([this, handle, wait, state] () {
+      if (state->status.load(std::memory_order_acquire) != ReadbackStatus::Pending) { return; }
+
+      ReadbackStatus result = m_backend->pollReadback(resolveHandle(handle),
+        state->pixels.data(), wait);
+      if (result != ReadbackStatus::Pending) {
+        bindHandle(handle, 0);
+      }
+      state->status.store(result, std::memory_order_release);
+    });
+
+    if (wait == true) {
+      flush();
+    }
+
+    ReadbackStatus result = state->status.load(std::memory_order_acquire);
+    if (result == ReadbackStatus::Complete && data != nullptr) {
+      std::memcpy(data, state->pixels.data(), state->pixels.size());
+    }
+    if (result != ReadbackStatus::Pending) {
+      m_readbacks.erase(iter);
+      releaseHandle(handle);
+    }
+
+    return result;
+  }
+
+  void ThreadedRenderBackend::destroyReadback (Uint32 handle)
+  {
+    if (m_readbacks.erase(handle) == 0) {
+      return;
+    }
+
+    record([this, handle] () {
+      m_backend->destroyReadback(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  /** Timer Queries *******************************************************************************/
+
+  Uint32 ThreadedRenderBackend::beginTimerQuery ()
+  {
+    Uint32 handle = allocateHandle();
+    m_timerQueries.emplace(handle, makeRef<TimerQueryState>());
+    record([this, handle] () { bindHandle(handle, m_backend->beginTimerQuery()); });
+
+    return handle;
+  }
+
+  void ThreadedRenderBackend::endTimerQuery ()
+  {
+    record([this] () { m_backend->endTimerQuery(); });
+  }
+
+  QueryStatus ThreadedRenderBackend::pollTimerQuery (Uint32 handle, Uint64& nanoseconds)
+  {
+    auto iter = m_timerQueries.find(handle);
+    if (iter == m_timerQueries.end()) {
+      return QueryStatus::Failed;
+    }
+
+    // As with readbacks, the state seen here may lag the real state by a frame or two.
+    auto state = iter->second;
+    record([this, handle, state] () {
+      if (state->status.load(std::memory_order_acquire) != QueryStatus::Pending) { return; }
+
+      Uint64 result = 0;
+      QueryStatus status = m_backend->pollTimerQuery(resolveHandle(handle), result);
+      if (status != QueryStatus::Pending) {
+        bindHandle(handle, 0);
+      }
+      state->nanoseconds.store(result, std::memory_order_relaxed);
+      state->status.store(status, std::memory_order_release);
+    });
+
+    QueryStatus result = state->status.load(std::memory_order_acquire);
+    if (result != QueryStatus::Pending) {
+      nanoseconds = state->nanoseconds.load(std::memory_order_relaxed);
+      m_timerQueries.erase(iter);
+      releaseHandle(handle);
+    }
+
+    return result;
+  }
+
+  void ThreadedRenderBackend::destroyTimerQuery (Uint32 handle)
+  {
+    if (m_timerQueries.erase(handle) == 0) {
+      return;
+    }
+
+    record([this, handle] () {
+      m_backend->destroyTimerQuery(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  /** Fences **************************************************************************************/
+
+  Uint32 ThreadedRenderBackend::insertFence ()
+  {
+    Uint32 handle = allocateHandle();
+    m_fences.emplace(handle, makeRef<std::atomic<Bool>>(false));
+    record([this, handle] () { bindHandle(handle, m_backend->insertFence()); });
+
+    return handle;
+  }
+
+  Bool ThreadedRenderBackend::pollFence (Uint32 handle, Bool wait)
+  {
+    auto iter = m_fences.find(handle);
+    if (iter == m_fences.end()) {
+      return true;
+    }
+
+    // As with readbacks, the state seen here may lag the real state by a frame or two.
+    auto signaled = iter->second;
+    record([this, handle, wait, signaled] () {
+      if (signaled->load(std::memory_order_acquire) == true) { return; }
+
+      if (m_backend->pollFence(resolveHandle(handle), wait) == true) {
+        bindHandle(handle, 0);
+        signaled->store(true, std::memory_order_release);
+      }
+    });
+
+    if (wait == true) {
+      flush();
+    }
+
+    if (signaled->load(std::memory_order_acquire) == false) {
+      return false;
+    }
+
+    m_fences.erase(iter);
+    releaseHandle(handle);
+    return true;
+  }
+
+  void ThreadedRenderBackend::destroyFence (Uint32 handle)
+  {
+    if (m_fences.erase(handle) == 0) {
+      return;
+    }
+
+    record([this, handle] () {
+      m_backend->destroyFence(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  /** Shader Programs *****************************************************************************/
+
+  Uint32 ThreadedRenderBackend::createProgram (const String& vertexCode,
+    const String& fragmentCode)
+  {
+    // Whether or not the program compiled must be known right away, so this waits for the
+    // render thread to catch up.
+    Uint32 handle = allocateHandle();
+    Bool built = false;
+    record([this, handle, &vertexCode, &fragmentCode, &built] () {
+      Uint32 program = m_backend->createProgram(vertexCode, fragmentCode);
+      bindHandle(handle, program);
+      built = (program != 0);
+    });
+    flush();
+
+    if (built == false) {
+      releaseHandle(handle);
+      return 0;
+    }
+
+    return handle;
+  }
+
+  Uint32 ThreadedRenderBackend::beginProgram (const String& vertexCode,
+    const String& fragmentCode)
+  {
+    // Unlike building right away, this does not wait: the source code is copied into the command,
+    // and the build's state is handed back by later calls to `pollProgram`.
+    Uint32 handle = allocateHandle();
+    auto status = makeRef<std::atomic<ProgramStatus>>(ProgramStatus::Pending);
+    m_programStatuses.emplace(handle, status);
+    record([this, handle, vertexCode, fragmentCode] () {
+      bindHandle(handle, m_backend->beginProgram(vertexCode, fragmentCode));
+    });
+
+    return handle;
+  }
+
+  ProgramStatus ThreadedRenderBackend::pollProgram (Uint32 handle, Bool wait)
+  {
+    auto iter = m_programStatuses.find(handle);
+    if (iter == m_programStatuses.end()) {
+      return (handle != 0) ? ProgramStatus::Linked : ProgramStatus::Failed;
+    }
+
+    // The render thread checks on the build when it reaches this command, so without waiting, the
+    // state seen here may lag the real state by a frame or two.
+    auto status = iter->second;
+    record([this, handle, wait, status] () {
+      if (status->load(std::memory_order_acquire) != ProgramStatus::Pending) { return; }
+
+      ProgramStatus result = m_backend->pollProgram(resolveHandle(handle), wait);
+      if (result == ProgramStatus::Failed) {
+        bindHandle(handle, 0);
+      }
+      status->store(result, std::memory_order_release);
+    });
+
+    if (wait == true) {
+      flush();
+    }
+
+    ProgramStatus result = status->load(std::memory_order_acquire);
+    if (result != ProgramStatus::Pending) {
+      m_programStatuses.erase(iter);
+    }
+
+    return result;
+  }
+
+  Uint32 ThreadedRenderBackend::createProgramFromBinary (GLenum format, const void* data,
+    Size byteCount)
+  {
+    // As with building from source, whether the binary was accepted must be known right away.
+    // The binary is not copied, since it is used before this returns.
+    Uint32 handle = allocateHandle();
+    Bool built = false;
+    record([this, handle, format, data, byteCount, &built] () {
+      Uint32 program = m_backend->createProgramFromBinary(format, data, byteCount);
+      bindHandle(handle, program);
+      built = (program != 0);
+    });
+    flush();
+
+    if (built == false) {
+      releaseHandle(handle);
+      return 0;
+    }
+
+    return handle;
+  }
+
+  Bool ThreadedRenderBackend::getProgramBinary (Uint32 handle, GLenum& format,
+    Collection<Uint8>& binary)
+  {
+    Bool retrieved = false;
+    record([this, handle, &format, &binary, &retrieved] () {
+      retrieved = m_backend->getProgramBinary(resolveHandle(handle), format, binary);
+    });
+    flush();
+
+    return retrieved;
+  }
+
+  String ThreadedRenderBackend::getDeviceName ()
+  {
+    String name = "";
+    record([this, &name] () { name = m_backend->getDeviceName(); });
+    flush();
+
+    return name;
+  }
+
+  void ThreadedRenderBackend::destroyProgram (Uint32 handle)
+  {
+    record([this, handle] () {
+      m_backend->destroyProgram(resolveHandle(handle));
+      bindHandle(handle, 0);
+    });
+    releaseHandle(handle);
+  }
+
+  void ThreadedRenderBackend::useProgram (Uint32 handle)
+  {
+    record([this, handle] () { m_backend->useProgram(resolveHandle(handle)); });
+  }
+
+  void ThreadedRenderBackend::setUniform (Uint32 program, const String& name,
+    ShaderUniformType type, const void* value)
+  {
+    const void* copied = copy(value, Private::getUniformByteCount(type));
+    record([this, program, name, type, copied] () {
+      m_backend->setUniform(resolveHandle(program), name, type, copied);
+    });
+  }
+
+  /** Submission **********************************************************************************/
+
+  void ThreadedRenderBackend::submit (const LFunction<void>& function)
+  {
+    record([function] () { function(); });
+  }
+
+  void ThreadedRenderBackend::flush ()
+  {
+    publish();
+
+    // Wait for the render thread to run out of work.
+    Uint32 pending = m_pendingFrames.load(std::memory_order_acquire);
+    while (pending != 0 && m_failed.load(std::memory_order_acquire) == false) {
+      m_pendingFrames.wait(pending, std::memory_order_acquire);
+      pending = m_pendingFrames.load(std::memory_order_acquire);
+    }
+
+    checkForErrors();
+  }
+
+  void ThreadedRenderBackend::endFrame ()
+  {
+    if (m_spec.present != nullptr) {
+      record([this] () { m_spec.present(); });
+    }
+
+    publish();
+    checkForErrors();
+  }
+
+  Uint32 ThreadedRenderBackend::resolveHandle (Uint32 handle) const
+  {
+    // Handles not created by this backend are passed through unchanged.
+    if ((handle & HANDLE_FLAG) == 0) {
+      return handle;
+    }
+
+    Index index = handle & ~HANDLE_FLAG;
+    return (index < m_handles.size()) ? m_handles[index] : 0;
+  }
+
+  /** Private Methods *****************************************************************************/
+
+  Uint32 ThreadedRenderBackend::allocateHandle ()
+  {
+    // Re-use a released handle if there is one. Its commands were recorded before this, so the
+    // render thread is done with the old object by the time it reaches the new one.
+    Uint32 index = 0;
+    if (m_freeHandles.empty() == false) {
+      index = m_freeHandles.back();
+      m_freeHandles.pop_back();
+    } else if ((m_nextHandle & HANDLE_FLAG) == 0) {
+      index = m_nextHandle++;
+      m_liveHandles.resize(index + 1, false);
+    } else {
+      DG_ENGINE_CRIT("Render thread has run out of stand-in handles!");
+      throw std::runtime_error { "Render thread has run out of stand-in handles!" };
+    }
+
+    m_liveHandles[index] = true;
+    return HANDLE_FLAG | index;
+  }
+
+  void ThreadedRenderBackend::releaseHandle (Uint32 handle)
+  {
+    // Handles released twice, or which were never handed out, are ignored.
+    Index index = handle & ~HANDLE_FLAG;
+    if ((handle & HANDLE_FLAG) == 0 || index >= m_liveHandles.size() ||
+      m_liveHandles[index] == false) {
+      return;
+    }
+
+    m_liveHandles[index] = false;
+    m_freeHandles.push_back(static_cast<Uint32>(index));
+  }
+
+  void ThreadedRenderBackend::bindHandle (Uint32 handle, Uint32 realHandle)
+  {
+    Index index = handle & ~HANDLE_FLAG;
+    if (index >= m_handles.size()) {
+      m_handles.resize(index + 1, 0);
+    }
+
+    m_handles[index] = realHandle;
+  }
+
+  void ThreadedRenderBackend::publish ()
+  {
+    // The queue after this one must not still be waiting to be carried out, since it is the next
+    // one to be recorded.
+    Uint32 pending = m_pendingFrames.load(std::memory_order_acquire);
+    while (pending + 1 >= m_queues.size()) {
+      if (m_failed.load(std::memory_order_acquire) == true) {
+        return;
+      }
+
+      m_pendingFrames.wait(pending, std::memory_order_acquire);
+      pending = m_pendingFrames.load(std::memory_order_acquire);
+    }
+
+    m_writeIndex = (m_writeIndex + 1) % m_queues.size();
+    m_pendingFrames.fetch_add(1, std::memory_order_release);
+    m_pendingFrames.notify_all();
+  }
+
+  void ThreadedRenderBackend::checkForErrors () const
+  {
+    if (m_failed.load(std::memory_order_acquire) == true) {
+      DG_ENGINE_CRIT("Render thread stopped: {}", m_error);
+      throw std::runtime_error { "Render thread stopped: " + m_error };
+    }
+  }
+
+  void ThreadedRenderBackend::run ()
+  {
+    try {
+      if (m_spec.attachContext != nullptr) { m_spec.attachContext(); }
+
+      while (m_stopping == false) {
+        m_pendingFrames.wait(0, std::memory_order_acquire);
+
+        m_queues[m_readIndex].execute();
+        m_readIndex = (m_readIndex + 1) % m_queues.size();
+
+        m_pendingFrames.fetch_sub(1, std::memory_order_release);
+        m_pendingFrames.notify_all();
+      }
+    } catch (const std::exception& ex) {
+      m_error = ex.what();
+    } catch (...) {
+      m_error = "Unknown error.";
+    }
+
+    if (m_error.empty() == false) {
+      // Wake the recording thread, which will find out about the error on its next sync point.
+      m_failed.store(true, std::memory_order_release);
+      m_pendingFrames.store(0, std::memory_order_release);
+      m_pendingFrames.notify_all();
+    }
+
+    try {
+      if (m_spec.detachContext != nullptr) { m_spec.detachContext(); }
+    } catch (...) {}
+  }
+
+}
@@ -1,6 +1,7 @@
 /** @file DG/Graphics/VertexArray.cpp */
 
 #include <DG/Graphics/VertexArray.hpp>
+#include <DG/Graphics/RenderInterface.hpp>
 
 namespace dg
 {
@@ -53,12 +54,12 @@ namespace dg
 
   VertexArray::VertexArray ()
   {
-    glGenVertexArrays(1, &m_handle);
+    m_handle = RenderInterface::getBackend().createVertexArray();
   }
 
   VertexArray::~VertexArray ()
   {
-    glDeleteVertexArrays(1, &m_handle);
+    RenderInterface::getBackend().destroyVertexArray(m_handle);
   }
 
   Ref<VertexArray> VertexArray::make ()
@@ -68,12 +69,12 @@ namespace dg
 
   void VertexArray::bind () const
   {
-    glBindVertexArray(m_handle);
+    RenderInterface::getBackend().bindVertexArray(m_handle);
   }
 
   void VertexArray::unbind ()
   {
-    glBindVertexArray(0);
+    RenderInterface::getBackend().bindVertexArray(0);
   }
 
   void VertexArray::addVertexBuffer (const Ref<VertexBuffer>& buffer)
@@ -84,7 +85,7 @@ namespace dg
     }
 
     // Bind the vertex array, then the vertex buffer.
-    glBindVertexArray(m_handle);
+    RenderInterface::getBackend().bindVertexArray(m_handle);
     buffer->bind();
 
     // Get the vertex buffer's layout. Ensure that it is not empty.
@@ -99,18 +100,15 @@ namespace dg
     // Iterate over the vertex buffer's layout.
     for (const auto& attribute : layout)
     {
-      // Define the GL vertex attribute.
-      glVertexAttribPointer(
-        index,
+      // Define the vertex attribute, and inform the bound vertex array of how it's laid out.
+      RenderInterface::getBackend().setVertexAttribute(
+        index++,
         attribute.getElementCount(),
         Private::resolveGLType(attribute.type),
-        attribute.normalized ? GL_TRUE : GL_FALSE,
+        attribute.normalized,
         layout.getStride(),
-        (const void*) attribute.offset
+        attribute.offset
       );
-
-      // Inform the bound vertex array of the attribute and how it's laid out.
-      glEnableVertexAttribArray(index++);
     }
 
     // Add the vertex buffer.
@@ -125,7 +123,7 @@ namespace dg
     }
 
     // Bind the vertex array, then the index buffer.
-    glBindVertexArray(m_handle);
+    RenderInterface::getBackend().bindVertexArray(m_handle);
     buffer->bind();
 
     // Inform this vertex array of the buffer.
@@ -0,0 +1,80 @@
+/** @file DG/Math/OBB2D.cpp */
+
+#include <DG/Math/OBB2D.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // Retrieves how far the given box reaches from its center along the given axis.
+    static Float32 projectRadius (const OBB2D& box, const Vector2f& onto)
+    {
+      return box.halfExtents.x * std::abs(glm::dot(box.axis, onto)) +
+        box.halfExtents.y * std::abs(glm::dot(box.getAxisY(), onto));
+    }
+
+  }
+
+  AABB2D OBB2D::getBounds () const
+  {
+    const Vector2f reach {
+      halfExtents.x * std::abs(axis.x) + halfExtents.y * std::abs(axis.y),
+      halfExtents.x * std::abs(axis.y) + halfExtents.y * std::abs(axis.x)
+    };
+
+    return { center - reach, center + reach };
+  }
+
+  Bool OBB2D::contains (const Vector2f& point) const
+  {
+    const Vector2f offset = point - center;
+    return std::abs(glm::dot(offset, axis)) <= halfExtents.x &&
+      std::abs(glm::dot(offset, getAxisY())) <= halfExtents.y;
+  }
+
+  Bool OBB2D::overlaps (const AABB2D& box) const
+  {
+    // The world axes are covered by this box's bounds; then only this box's own axes are left.
+    if (getBounds().overlaps(box) == false) {
+      return false;
+    }
+
+    const Vector2f offset = box.getCenter() - center;
+    const Vector2f boxHalf = box.getSize() * 0.5f;
+    const Vector2f axisY = getAxisY();
+    return
+      std::abs(glm::dot(offset, axis)) <=
+        halfExtents.x + boxHalf.x * std::abs(axis.x) + boxHalf.y * std::abs(axis.y) &&
+      std::abs(glm::dot(offset, axisY)) <=
+        halfExtents.y + boxHalf.x * std::abs(axisY.x) + boxHalf.y * std::abs(axisY.y);
+  }
+
+  Bool OBB2D::overlaps (const OBB2D& other) const
+  {
+    // The boxes overlap unless one of their four axes separates them.
+    const Vector2f offset = other.center - center;
+    for (const Vector2f& onto : { axis, getAxisY(), other.axis, other.getAxisY() }) {
+      if (std::abs(glm::dot(offset, onto)) >
+        Private::projectRadius(*this, onto) + Private::projectRadius(other, onto)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  OBB2D OBB2D::fromTransform (const Transform2D& transform)
+  {
+    const Float32 width = glm::length(transform.axisX);
+    const Float32 height = glm::length(transform.axisY);
+
+    return {
+      transform.origin,
+      { width * 0.5f, height * 0.5f },
+      (width > 0.0f) ? transform.axisX / width : Vector2f { 1.0f, 0.0f }
+    };
+  }
+
+}
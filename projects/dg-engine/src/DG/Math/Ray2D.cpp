@@ -0,0 +1,44 @@
+/** @file DG/Math/Ray2D.cpp */
+
+#include <DG/Math/Ray2D.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // Stands in for the reciprocal of a zero direction component.
+    static constexpr Float32 PARALLEL_INVERSE = 1.0e30f;
+
+  }
+
+  Vector2f Ray2D::getInverseDirection () const
+  {
+    return {
+      (direction.x != 0.0f) ? 1.0f / direction.x : Private::PARALLEL_INVERSE,
+      (direction.y != 0.0f) ? 1.0f / direction.y : Private::PARALLEL_INVERSE
+    };
+  }
+
+  Bool Ray2D::cast (const AABB2D& box, Float32 maxDistance, Float32& distance) const
+  {
+    // Find where the ray enters and leaves the box's slab along each axis; it hits the box if the
+    // last entry comes before the first exit.
+    const Vector2f inverse = getInverseDirection();
+    const Vector2f toMin = (box.min - origin) * inverse;
+    const Vector2f toMax = (box.max - origin) * inverse;
+    const Vector2f enter = glm::min(toMin, toMax);
+    const Vector2f leave = glm::max(toMin, toMax);
+    const Float32 first = std::max(std::max(enter.x, enter.y), 0.0f);
+    const Float32 last = std::min(std::min(leave.x, leave.y), maxDistance);
+
+    if (first > last) {
+      return false;
+    }
+
+    distance = first;
+    return true;
+  }
+
+}
@@ -0,0 +1,428 @@
+/** @file DG/Math/ShapeQueries2D.cpp */
+
+#include <DG/Math/ShapeQueries2D.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define DG_SHAPE_QUERIES_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+
+    // The number of shapes tested at once.
+    static constexpr Count LANES = 4;
+
+    // Loads four consecutive values from the given array.
+    static inline __m128 load (const Float32* values, Index index)
+    {
+      return _mm_loadu_ps(values + index);
+    }
+
+    // Clears the sign bit of each of the given values.
+    static inline __m128 absolute (__m128 values)
+    {
+      return _mm_andnot_ps(_mm_set1_ps(-0.0f), values);
+    }
+
+    // Writes the indices of the lanes which passed a test, given the test's result mask. Most
+    // groups of shapes miss entirely, so this is only called once one has passed.
+    static void collect (Int32 mask, Index index, Collection<Index>& hits)
+    {
+      for (Index lane = 0; lane < LANES; ++lane) {
+        if ((mask & (1 << lane)) != 0) {
+          hits.push_back(index + lane);
+        }
+      }
+    }
+
+    // Works out where a ray enters and leaves each of four boxes, for @a `castRay` and
+    // @a `castRayNearest`. Returns the mask of the boxes which it hits.
+    static inline __m128 castFour (const AABB2DArray& boxes, Index index, __m128 originX,
+      __m128 originY, __m128 inverseX, __m128 inverseY, __m128 maxDistance, __m128& first)
+    {
+      const __m128 toMinX = _mm_mul_ps(_mm_sub_ps(load(boxes.minX.data(), index), originX),
+        inverseX);
+      const __m128 toMaxX = _mm_mul_ps(_mm_sub_ps(load(boxes.maxX.data(), index), originX),
+        inverseX);
+      const __m128 toMinY = _mm_mul_ps(_mm_sub_ps(load(boxes.minY.data(), index), originY),
+        inverseY);
+      const __m128 toMaxY = _mm_mul_ps(_mm_sub_ps(load(boxes.maxY.data(), index), originY),
+        inverseY);
+
+      first = _mm_max_ps(_mm_max_ps(_mm_min_ps(toMinX, toMaxX), _mm_min_ps(toMinY, toMaxY)),
+        _mm_setzero_ps());
+      const __m128 last = _mm_min_ps(_mm_min_ps(_mm_max_ps(toMinX, toMaxX),
+        _mm_max_ps(toMinY, toMaxY)), maxDistance);
+
+      return _mm_cmple_ps(first, last);
+    }
+
+  #endif
+
+  }
+
+  Count ShapeQueries2D::overlapping (const AABB2D& query, const AABB2DArray& boxes,
+    Collection<Index>& hits)
+  {
+    const Count count = boxes.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* boxMinX = boxes.minX.data();
+    const Float32* boxMinY = boxes.minY.data();
+    const Float32* boxMaxX = boxes.maxX.data();
+    const Float32* boxMaxY = boxes.maxY.data();
+    const __m128 queryMinX = _mm_set1_ps(query.min.x);
+    const __m128 queryMinY = _mm_set1_ps(query.min.y);
+    const __m128 queryMaxX = _mm_set1_ps(query.max.x);
+    const __m128 queryMaxY = _mm_set1_ps(query.max.y);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 overlapX = _mm_and_ps(
+        _mm_cmple_ps(Private::load(boxMinX, i), queryMaxX),
+        _mm_cmpge_ps(Private::load(boxMaxX, i), queryMinX));
+      const __m128 overlapY = _mm_and_ps(
+        _mm_cmple_ps(Private::load(boxMinY, i), queryMaxY),
+        _mm_cmpge_ps(Private::load(boxMaxY, i), queryMinY));
+      const Int32 mask = _mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (query.overlaps(boxes.get(i)) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::overlapping (const OBB2D& query, const AABB2DArray& boxes,
+    Collection<Index>& hits)
+  {
+    const Count count = boxes.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* boxMinX = boxes.minX.data();
+    const Float32* boxMinY = boxes.minY.data();
+    const Float32* boxMaxX = boxes.maxX.data();
+    const Float32* boxMaxY = boxes.maxY.data();
+    // The world axes are tested against the query's bounds; then the query's own two axes are
+    // tested, projecting each box's center and half-size onto them.
+    const AABB2D bounds = query.getBounds();
+    const Vector2f axisY = query.getAxisY();
+    const __m128 boundsMinX = _mm_set1_ps(bounds.min.x);
+    const __m128 boundsMinY = _mm_set1_ps(bounds.min.y);
+    const __m128 boundsMaxX = _mm_set1_ps(bounds.max.x);
+    const __m128 boundsMaxY = _mm_set1_ps(bounds.max.y);
+    const __m128 centerX = _mm_set1_ps(query.center.x);
+    const __m128 centerY = _mm_set1_ps(query.center.y);
+    const __m128 extentX = _mm_set1_ps(query.halfExtents.x);
+    const __m128 extentY = _mm_set1_ps(query.halfExtents.y);
+    const __m128 axisXX = _mm_set1_ps(query.axis.x);
+    const __m128 axisXY = _mm_set1_ps(query.axis.y);
+    const __m128 axisYX = _mm_set1_ps(axisY.x);
+    const __m128 axisYY = _mm_set1_ps(axisY.y);
+    const __m128 absAxisXX = _mm_set1_ps(std::abs(query.axis.x));
+    const __m128 absAxisXY = _mm_set1_ps(std::abs(query.axis.y));
+    const __m128 absAxisYX = _mm_set1_ps(std::abs(axisY.x));
+    const __m128 absAxisYY = _mm_set1_ps(std::abs(axisY.y));
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 minX = Private::load(boxMinX, i);
+      const __m128 minY = Private::load(boxMinY, i);
+      const __m128 maxX = Private::load(boxMaxX, i);
+      const __m128 maxY = Private::load(boxMaxY, i);
+      const __m128 inBounds = _mm_and_ps(
+        _mm_and_ps(_mm_cmple_ps(minX, boundsMaxX), _mm_cmpge_ps(maxX, boundsMinX)),
+        _mm_and_ps(_mm_cmple_ps(minY, boundsMaxY), _mm_cmpge_ps(maxY, boundsMinY)));
+
+      const __m128 offsetX = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(minX, maxX), half), centerX);
+      const __m128 offsetY = _mm_sub_ps(_mm_mul_ps(_mm_add_ps(minY, maxY), half), centerY);
+      const __m128 halfX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+      const __m128 halfY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+
+      const __m128 alongX = Private::absolute(_mm_add_ps(_mm_mul_ps(offsetX, axisXX),
+        _mm_mul_ps(offsetY, axisXY)));
+      const __m128 reachX = _mm_add_ps(extentX, _mm_add_ps(_mm_mul_ps(halfX, absAxisXX),
+        _mm_mul_ps(halfY, absAxisXY)));
+      const __m128 alongY = Private::absolute(_mm_add_ps(_mm_mul_ps(offsetX, axisYX),
+        _mm_mul_ps(offsetY, axisYY)));
+      const __m128 reachY = _mm_add_ps(extentY, _mm_add_ps(_mm_mul_ps(halfX, absAxisYX),
+        _mm_mul_ps(halfY, absAxisYY)));
+
+      const __m128 onAxes = _mm_and_ps(_mm_cmple_ps(alongX, reachX),
+        _mm_cmple_ps(alongY, reachY));
+      const Int32 mask = _mm_movemask_ps(_mm_and_ps(inBounds, onAxes));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (query.overlaps(boxes.get(i)) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::overlapping (const Circle2D& query, const AABB2DArray& boxes,
+    Collection<Index>& hits)
+  {
+    const Count count = boxes.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* boxMinX = boxes.minX.data();
+    const Float32* boxMinY = boxes.minY.data();
+    const Float32* boxMaxX = boxes.maxX.data();
+    const Float32* boxMaxY = boxes.maxY.data();
+    // Find the point in each box nearest to the circle's center, then see if it lies within.
+    const __m128 centerX = _mm_set1_ps(query.center.x);
+    const __m128 centerY = _mm_set1_ps(query.center.y);
+    const __m128 radiusSquared = _mm_set1_ps(query.radius * query.radius);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 offsetX = _mm_sub_ps(_mm_min_ps(_mm_max_ps(centerX,
+        Private::load(boxMinX, i)), Private::load(boxMaxX, i)), centerX);
+      const __m128 offsetY = _mm_sub_ps(_mm_min_ps(_mm_max_ps(centerY,
+        Private::load(boxMinY, i)), Private::load(boxMaxY, i)), centerY);
+      const __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(offsetX, offsetX),
+        _mm_mul_ps(offsetY, offsetY));
+      const Int32 mask = _mm_movemask_ps(_mm_cmple_ps(distanceSquared, radiusSquared));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (query.overlaps(boxes.get(i)) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::overlapping (const Circle2D& query, const Circle2DArray& circles,
+    Collection<Index>& hits)
+  {
+    const Count count = circles.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* circleX = circles.x.data();
+    const Float32* circleY = circles.y.data();
+    const Float32* circleRadius = circles.radius.data();
+    const __m128 centerX = _mm_set1_ps(query.center.x);
+    const __m128 centerY = _mm_set1_ps(query.center.y);
+    const __m128 radius = _mm_set1_ps(query.radius);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 offsetX = _mm_sub_ps(Private::load(circleX, i), centerX);
+      const __m128 offsetY = _mm_sub_ps(Private::load(circleY, i), centerY);
+      const __m128 reach = _mm_add_ps(radius, Private::load(circleRadius, i));
+      const __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(offsetX, offsetX),
+        _mm_mul_ps(offsetY, offsetY));
+      const Int32 mask = _mm_movemask_ps(_mm_cmple_ps(distanceSquared, _mm_mul_ps(reach, reach)));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (query.overlaps(circles.get(i)) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::containing (const Vector2f& point, const AABB2DArray& boxes,
+    Collection<Index>& hits)
+  {
+    const Count count = boxes.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* boxMinX = boxes.minX.data();
+    const Float32* boxMinY = boxes.minY.data();
+    const Float32* boxMaxX = boxes.maxX.data();
+    const Float32* boxMaxY = boxes.maxY.data();
+    const __m128 pointX = _mm_set1_ps(point.x);
+    const __m128 pointY = _mm_set1_ps(point.y);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 insideX = _mm_and_ps(
+        _mm_cmple_ps(Private::load(boxMinX, i), pointX),
+        _mm_cmpge_ps(Private::load(boxMaxX, i), pointX));
+      const __m128 insideY = _mm_and_ps(
+        _mm_cmple_ps(Private::load(boxMinY, i), pointY),
+        _mm_cmpge_ps(Private::load(boxMaxY, i), pointY));
+      const Int32 mask = _mm_movemask_ps(_mm_and_ps(insideX, insideY));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (boxes.get(i).contains(point) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::containedBy (const AABB2D& rect, const Point2DArray& points,
+    Collection<Index>& hits)
+  {
+    const Count count = points.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Float32* pointX = points.x.data();
+    const Float32* pointY = points.y.data();
+    const __m128 rectMinX = _mm_set1_ps(rect.min.x);
+    const __m128 rectMinY = _mm_set1_ps(rect.min.y);
+    const __m128 rectMaxX = _mm_set1_ps(rect.max.x);
+    const __m128 rectMaxY = _mm_set1_ps(rect.max.y);
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      const __m128 x = Private::load(pointX, i);
+      const __m128 y = Private::load(pointY, i);
+      const __m128 insideX = _mm_and_ps(_mm_cmpge_ps(x, rectMinX), _mm_cmple_ps(x, rectMaxX));
+      const __m128 insideY = _mm_and_ps(_mm_cmpge_ps(y, rectMinY), _mm_cmple_ps(y, rectMaxY));
+      const Int32 mask = _mm_movemask_ps(_mm_and_ps(insideX, insideY));
+      if (mask != 0) {
+        Private::collect(mask, i, hits);
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      if (rect.contains(points.get(i)) == true) {
+        hits.push_back(i);
+      }
+    }
+
+    return hits.size();
+  }
+
+  Count ShapeQueries2D::castRay (const Ray2D& ray, Float32 maxDistance, const AABB2DArray& boxes,
+    Collection<RayHit2D>& hits)
+  {
+    const Count count = boxes.getSize();
+    hits.clear();
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    const Vector2f inverse = ray.getInverseDirection();
+    const __m128 originX = _mm_set1_ps(ray.origin.x);
+    const __m128 originY = _mm_set1_ps(ray.origin.y);
+    const __m128 inverseX = _mm_set1_ps(inverse.x);
+    const __m128 inverseY = _mm_set1_ps(inverse.y);
+    const __m128 distanceLimit = _mm_set1_ps(maxDistance);
+    alignas(16) Float32 distances[Private::LANES];
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      __m128 first;
+      const Int32 mask = _mm_movemask_ps(Private::castFour(boxes, i, originX, originY, inverseX,
+        inverseY, distanceLimit, first));
+      if (mask == 0) {
+        continue;
+      }
+
+      _mm_store_ps(distances, first);
+      for (Index lane = 0; lane < Private::LANES; ++lane) {
+        if ((mask & (1 << lane)) != 0) {
+          hits.push_back({ i + lane, distances[lane] });
+        }
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      Float32 distance = 0.0f;
+      if (ray.cast(boxes.get(i), maxDistance, distance) == true) {
+        hits.push_back({ i, distance });
+      }
+    }
+
+    return hits.size();
+  }
+
+  Bool ShapeQueries2D::castRayNearest (const Ray2D& ray, Float32 maxDistance,
+    const AABB2DArray& boxes, RayHit2D& nearest)
+  {
+    const Count count = boxes.getSize();
+    Bool found = false;
+    Index i = 0;
+
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    // Each hit shortens the ray, so that boxes further away than the nearest so far are missed.
+    const Vector2f inverse = ray.getInverseDirection();
+    const __m128 originX = _mm_set1_ps(ray.origin.x);
+    const __m128 originY = _mm_set1_ps(ray.origin.y);
+    const __m128 inverseX = _mm_set1_ps(inverse.x);
+    const __m128 inverseY = _mm_set1_ps(inverse.y);
+    alignas(16) Float32 distances[Private::LANES];
+    for (; i + Private::LANES <= count; i += Private::LANES) {
+      __m128 first;
+      const Int32 mask = _mm_movemask_ps(Private::castFour(boxes, i, originX, originY, inverseX,
+        inverseY, _mm_set1_ps(maxDistance), first));
+      if (mask == 0) {
+        continue;
+      }
+
+      _mm_store_ps(distances, first);
+      for (Index lane = 0; lane < Private::LANES; ++lane) {
+        if ((mask & (1 << lane)) != 0 && (found == false || distances[lane] < maxDistance)) {
+          nearest = { i + lane, distances[lane] };
+          maxDistance = distances[lane];
+          found = true;
+        }
+      }
+    }
+  #endif
+
+    for (; i < count; ++i) {
+      Float32 distance = 0.0f;
+      if (ray.cast(boxes.get(i), maxDistance, distance) == true &&
+        (found == false || distance < maxDistance)) {
+        nearest = { i, distance };
+        maxDistance = distance;
+        found = true;
+      }
+    }
+
+    return found;
+  }
+
+  Bool ShapeQueries2D::isVectorized ()
+  {
+  #if defined(DG_SHAPE_QUERIES_SSE2)
+    return true;
+  #else
+    return false;
+  #endif
+  }
+
+}
@@ -0,0 +1,55 @@
+/** @file DG/Math/Transform2D.cpp */
+
+#include <DG/Math/Transform2D.hpp>
+
+namespace dg
+{
+
+  Transform2D Transform2D::operator* (const Transform2D& other) const
+  {
+    return {
+      transformVector(other.axisX),
+      transformVector(other.axisY),
+      transformPoint(other.origin)
+    };
+  }
+
+  Transform2D Transform2D::inverse () const
+  {
+    const Float32 determinant = axisX.x * axisY.y - axisY.x * axisX.y;
+    if (determinant == 0.0f) {
+      return {};
+    }
+
+    const Float32 reciprocal = 1.0f / determinant;
+    Transform2D result;
+    result.axisX = Vector2f {  axisY.y, -axisX.y } * reciprocal;
+    result.axisY = Vector2f { -axisY.x,  axisX.x } * reciprocal;
+    result.origin = -result.transformVector(origin);
+    return result;
+  }
+
+  Matrix4f Transform2D::toMatrix (Float32 depth) const
+  {
+    Matrix4f matrix { 1.0f };
+    matrix[0] = { axisX.x, axisX.y, 0.0f, 0.0f };
+    matrix[1] = { axisY.x, axisY.y, 0.0f, 0.0f };
+    matrix[3] = { origin.x, origin.y, depth, 1.0f };
+    return matrix;
+  }
+
+  Transform2D Transform2D::fromPositionRotationScale (const Vector2f& position, Float32 rotation,
+    const Vector2f& scale)
+  {
+    const Float32 radians = glm::radians(rotation);
+    const Float32 sine = std::sin(radians);
+    const Float32 cosine = std::cos(radians);
+
+    return {
+      {  cosine * scale.x, sine * scale.x },
+      { -sine * scale.y, cosine * scale.y },
+      position
+    };
+  }
+
+}
@@ -0,0 +1,25 @@
+/** @file DG/Scene/Entity.cpp */
+
+#include <DG/Scene/Entity.hpp>
+
+namespace dg
+{
+
+  Entity::Entity (entt::entity handle, Scene* scene) :
+    m_handle  { handle },
+    m_scene   { scene }
+  {
+
+  }
+
+  Int32 Entity::getId () const
+  {
+    return (m_handle == entt::null) ? -1 : static_cast<Int32>(entt::to_entity(m_handle));
+  }
+
+  Entity::operator Bool () const
+  {
+    return m_scene != nullptr && m_scene->getRegistry().valid(m_handle);
+  }
+
+}
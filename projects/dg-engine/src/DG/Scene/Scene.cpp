@@ -0,0 +1,125 @@
+/** @file DG/Scene/Scene.cpp */
+
+#include <DG/Scene/Entity.hpp>
+#include <DG/Scene/Scene.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // The number of components in each page of a component pool. Components are only laid out
+    // one after another within a page.
+    template <typename T>
+    static constexpr Count PAGE_SIZE = entt::component_traits<T>::page_size;
+
+    static_assert(PAGE_SIZE<TransformComponent> == PAGE_SIZE<SpriteRendererComponent>,
+      "Sprite components must share a page size, so that their pages line up.");
+
+  }
+
+  Scene::Scene ()
+  {
+    // Make the sprite group straight away, so that its components are packed as they are added.
+    m_registry.group<TransformComponent, SpriteRendererComponent>();
+  }
+
+  Scene::~Scene ()
+  {
+    m_registry.clear();
+  }
+
+  /** Entities ************************************************************************************/
+
+  Entity Scene::createEntity ()
+  {
+    return Entity { m_registry.create(), this };
+  }
+
+  void Scene::destroyEntity (Entity entity)
+  {
+    if (entity.getScene() != this || m_registry.valid(entity.getHandle()) == false) {
+      DG_ENGINE_CRIT("Entity {} does not belong to this scene.", entity.getId());
+      throw std::invalid_argument { "Attempt to destroy an entity which is not in the scene!" };
+    }
+
+    m_registry.destroy(entity.getHandle());
+  }
+
+  Entity Scene::getEntity (Int32 id)
+  {
+    if (id < 0) {
+      return {};
+    }
+
+    // The ID leaves out the entity's version, so the current one is looked up.
+    using Traits = entt::entt_traits<entt::entity>;
+    const entt::entity index = static_cast<entt::entity>(id);
+    const entt::entity handle = Traits::construct(static_cast<Traits::entity_type>(id),
+      m_registry.current(index));
+    if (m_registry.valid(handle) == false) {
+      return {};
+    }
+
+    return Entity { handle, this };
+  }
+
+  Entity Scene::getPrimaryCamera ()
+  {
+    for (auto [handle, camera] : m_registry.view<CameraComponent>().each()) {
+      if (camera.primary == true) {
+        return Entity { handle, this };
+      }
+    }
+
+    return {};
+  }
+
+  Count Scene::getEntityCount () const
+  {
+    return m_registry.storage<entt::entity>()->in_use();
+  }
+
+  /** Rendering ***********************************************************************************/
+
+  void Scene::render (Renderer& renderer)
+  {
+    Entity cameraEntity = getPrimaryCamera();
+    if (cameraEntity == false) {
+      return;
+    }
+
+    // Have the camera follow its entity.
+    OrthographicCamera2D& camera = cameraEntity.getComponent<CameraComponent>().camera;
+    if (cameraEntity.hasComponent<TransformComponent>() == true) {
+      const Transform2D& transform =
+        cameraEntity.getComponent<TransformComponent>().transform;
+      camera.setPosition(transform.origin);
+      camera.setRotation(glm::degrees(std::atan2(transform.axisX.y, transform.axisX.x)));
+    }
+
+    // The group's components sit at the front of each pool, in the same order. Hand them over a
+    // page at a time, since each page is laid out in one piece.
+    auto group = m_registry.group<TransformComponent, SpriteRendererComponent>();
+    const Count count = group.size();
+    const entt::entity* entities = group.handle().data();
+    const auto* transformPages = group.storage<TransformComponent>()->raw();
+    const auto* spritePages = group.storage<SpriteRendererComponent>()->raw();
+    constexpr Count pageSize = Private::PAGE_SIZE<TransformComponent>;
+
+    renderer.beginScene2D(camera);
+    for (Index first = 0; first < count; first += pageSize) {
+      const Index page = first / pageSize;
+      renderer.submitSprites2D(transformPages[page], spritePages[page], entities + first,
+        std::min(pageSize, count - first));
+    }
+    renderer.endScene2D();
+  }
+
+  Ref<Scene> Scene::make ()
+  {
+    return makeRef<Scene>();
+  }
+
+}
@@ -0,0 +1,625 @@
+/** @file DG/Scene/SceneSerializer.cpp */
+
+#include <DG/Core/FileIo.hpp>
+#include <DG/Core/MappedFile.hpp>
+#include <DG/Graphics/TextureCooker.hpp>
+#include <DG/Scene/SceneSerializer.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // The boundary on which each array in a chunk starts.
+    static constexpr Size CHUNK_ALIGNMENT = 16;
+
+    // The version of each chunk's records. Change a chunk's version whenever its record changes.
+    static constexpr Uint16 ENTITIES_VERSION = 1;
+    static constexpr Uint16 TEXTURE_NAMES_VERSION = 1;
+    static constexpr Uint16 SUB_TEXTURES_VERSION = 1;
+    static constexpr Uint16 TRANSFORMS_VERSION = 1;
+    static constexpr Uint16 SPRITES_VERSION = 1;
+    static constexpr Uint16 CAMERAS_VERSION = 1;
+
+    // Points to no texture or sub-texture in a record.
+    static constexpr Int32 NO_INDEX = -1;
+
+    struct SpriteRecord
+    {
+      Color color;
+      Int32 texture = NO_INDEX;
+      Int32 subTexture = NO_INDEX;
+    };
+
+    struct SubTextureRecord
+    {
+      Int32 texture = NO_INDEX;
+      Uint32 reserved = 0;
+      Vector2f minimum = { 0.0f, 0.0f };
+      Vector2f maximum = { 0.0f, 0.0f };
+    };
+
+    struct CameraRecord
+    {
+      Vector2f position = { 0.0f, 0.0f };
+      Vector2f viewportSize = { 0.0f, 0.0f };
+      Float32 rotation = 0.0f;
+      Float32 zoom = 1.0f;
+      Float32 nearPlane = -1.0f;
+      Float32 farPlane = 1.0f;
+      Uint32 primary = 0;
+      Uint32 reserved = 0;
+    };
+
+    static_assert(sizeof(entt::entity) == sizeof(Uint32), "Entities must be 32-bit!");
+    static_assert(sizeof(SpriteRecord) == 24, "Sprite record must be 24 bytes!");
+    static_assert(sizeof(SubTextureRecord) == 24, "Sub-texture record must be 24 bytes!");
+    static_assert(sizeof(CameraRecord) == 40, "Camera record must be 40 bytes!");
+    static_assert(std::is_trivially_copyable_v<TransformComponent>,
+      "Transform components are stored as they are, so must be trivially copyable!");
+
+    // A piece of a chunk's contents, at the given offset from the start of the chunk.
+    struct ChunkPiece
+    {
+      const void* data = nullptr;
+      Size size = 0;
+      Size offset = 0;
+    };
+
+    // A chunk waiting to be written, along with its contents. The pieces point into the scene, or
+    // into the records built for it, which outlive the write.
+    struct PendingChunk
+    {
+      SceneChunkEntry entry;
+      Collection<ChunkPiece> pieces;
+    };
+
+    static Size align (Size offset)
+    {
+      return (offset + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1);
+    }
+
+    // Retrieves the offset from the start of a component chunk at which its records start.
+    static Size getRecordOffset (Count count)
+    {
+      return align(count * sizeof(entt::entity));
+    }
+
+    // Makes a component chunk out of the given pool's entities. Its records are added after.
+    template <typename T>
+    static PendingChunk makeComponentChunk (SceneChunkType type, Uint16 version,
+      const entt::sparse_set& pool)
+    {
+      PendingChunk chunk;
+      chunk.entry.type = type;
+      chunk.entry.version = version;
+      chunk.entry.stride = sizeof(T);
+      chunk.entry.count = static_cast<Uint32>(pool.size());
+      chunk.entry.size = getRecordOffset(pool.size()) + pool.size() * sizeof(T);
+      chunk.pieces.push_back({ pool.data(), pool.size() * sizeof(entt::entity), 0 });
+      return chunk;
+    }
+
+    // Finds the given chunk in the table of contents, if the file has one, and checks that it
+    // fits within the file and holds the records which this build expects. Component chunks
+    // start with their entities.
+    static Bool findChunk (const Collection<SceneChunkEntry>& chunks, SceneChunkType type,
+      Uint16 version, Size stride, Bool component, Size fileSize, const Path& path,
+      const SceneChunkEntry*& found)
+    {
+      found = nullptr;
+      for (const auto& chunk : chunks) {
+        if (chunk.type != type) {
+          continue;
+        }
+
+        const Size recordOffset = (component == true) ? getRecordOffset(chunk.count) : 0;
+        if (chunk.version != version || chunk.stride != stride) {
+          DG_ENGINE_ERROR("Scene file '{}' has chunk {} with unsupported version {}.",
+            path.string(), static_cast<Uint32>(type), chunk.version);
+          return false;
+        } else if (
+          chunk.offset % CHUNK_ALIGNMENT != 0 ||
+          chunk.offset > fileSize ||
+          chunk.size > fileSize - chunk.offset ||
+          chunk.size < recordOffset + static_cast<Size>(chunk.count) * stride
+        ) {
+          DG_ENGINE_ERROR("Scene file '{}' has chunk {} out of bounds.", path.string(),
+            static_cast<Uint32>(type));
+          return false;
+        }
+
+        found = &chunk;
+        return true;
+      }
+
+      return true;
+    }
+
+    // Checks that a value read from a file is a number greater than zero. NaNs and infinities,
+    // which comparisons alone would let through, are not.
+    static Bool isPositive (Float32 value)
+    {
+      return std::isfinite(value) == true && value > 0.0f;
+    }
+
+    // Checks that every entity in a component chunk is alive in the registry, and appears only
+    // once, so that a damaged file cannot hand components to entities which do not exist, or hand
+    // an entity the same component twice.
+    static Bool areValid (const entt::registry& registry, const entt::entity* entities,
+      Count count)
+    {
+      Collection<Bool> seen;
+      for (Index i = 0; i < count; ++i) {
+        if (registry.valid(entities[i]) == false) {
+          return false;
+        }
+
+        Index index = entt::to_entity(entities[i]);
+        if (index >= seen.size()) {
+          seen.resize(index + 1, false);
+        } else if (seen[index] == true) {
+          return false;
+        }
+        seen[index] = true;
+      }
+
+      return true;
+    }
+
+  }
+
+  Bool SceneSerializer::save (const Scene& scene, const Path& path)
+  {
+    const entt::registry& registry = scene.getRegistry();
+    Collection<Private::PendingChunk> chunks;
+
+    // The entities, in the order they are packed, so that loading rebuilds the same pool.
+    const auto* entities = registry.storage<entt::entity>();
+    SceneFileHeader header;
+    header.entityCount = static_cast<Uint32>(entities->size());
+    header.inUseCount = static_cast<Uint32>(entities->in_use());
+    {
+      Private::PendingChunk chunk;
+      chunk.entry.type = SceneChunkType::Entities;
+      chunk.entry.version = Private::ENTITIES_VERSION;
+      chunk.entry.stride = sizeof(entt::entity);
+      chunk.entry.count = header.entityCount;
+      chunk.entry.size = entities->size() * sizeof(entt::entity);
+      chunk.pieces.push_back({ entities->data(), chunk.entry.size, 0 });
+      chunks.push_back(std::move(chunk));
+    }
+
+    // Transforms are stored as they are laid out in their pool, a page at a time.
+    const auto* transforms = registry.storage<TransformComponent>();
+    if (transforms != nullptr && transforms->empty() == false) {
+      constexpr Count pageSize = entt::component_traits<TransformComponent>::page_size;
+      const Count count = transforms->size();
+      const Size recordOffset = Private::getRecordOffset(count);
+      auto chunk = Private::makeComponentChunk<TransformComponent>(SceneChunkType::Transforms,
+        Private::TRANSFORMS_VERSION, *transforms);
+      for (Index first = 0; first < count; first += pageSize) {
+        chunk.pieces.push_back({ transforms->raw()[first / pageSize],
+          std::min(pageSize, count - first) * sizeof(TransformComponent),
+          recordOffset + first * sizeof(TransformComponent) });
+      }
+      chunks.push_back(std::move(chunk));
+    }
+
+    // Sprites and cameras point to assets and matrices, so they are copied into records first.
+    // Textures and sub-textures are shared by many sprites, so each is only stored once. Textures
+    // are named by their image files - not by any cooked texture files loaded in their place -
+    // relative to the working directory, as the texture manager names them.
+    Map<const Texture*, Int32> textureIndices;
+    Collection<String> textureNames;
+    Count droppedCount = 0;
+    auto getTextureIndex = [&] (const Ref<Texture>& texture) -> Int32
+    {
+      if (texture == nullptr) {
+        return Private::NO_INDEX;
+      } else if (texture->getFilepath().empty() == true) {
+        droppedCount++;
+        return Private::NO_INDEX;
+      }
+
+      auto [iter, added] = textureIndices.try_emplace(texture.get(),
+        static_cast<Int32>(textureNames.size()));
+      if (added == true) {
+        const Path source = TextureCooker::getSourcePath(texture->getFilepath());
+        textureNames.push_back(FileIo::getRelative(source).generic_string());
+      }
+
+      return iter->second;
+    };
+
+    Map<const SubTexture*, Int32> subTextureIndices;
+    Collection<Private::SubTextureRecord> subTextureRecords;
+    auto getSubTextureIndex = [&] (const Ref<SubTexture>& subTexture) -> Int32
+    {
+      if (subTexture == nullptr) {
+        return Private::NO_INDEX;
+      }
+
+      auto iter = subTextureIndices.find(subTexture.get());
+      if (iter != subTextureIndices.end()) {
+        return iter->second;
+      }
+
+      Private::SubTextureRecord record;
+      record.texture = getTextureIndex(subTexture->getTexture());
+      if (record.texture == Private::NO_INDEX) {
+        return Private::NO_INDEX;
+      }
+
+      const Vector2f* coordinates = subTexture->getTextureCoordinates();
+      record.minimum = coordinates[0];
+      record.maximum = coordinates[2];
+      subTextureRecords.push_back(record);
+      iter = subTextureIndices.emplace(subTexture.get(),
+        static_cast<Int32>(subTextureRecords.size() - 1)).first;
+      return iter->second;
+    };
+
+    Collection<Private::SpriteRecord> spriteRecords;
+    const auto* sprites = registry.storage<SpriteRendererComponent>();
+    if (sprites != nullptr && sprites->empty() == false) {
+      constexpr Count pageSize = entt::component_traits<SpriteRendererComponent>::page_size;
+      spriteRecords.resize(sprites->size());
+      for (Index i = 0; i < sprites->size(); ++i) {
+        const auto& sprite = sprites->raw()[i / pageSize][i % pageSize];
+        spriteRecords[i].color = sprite.color;
+        spriteRecords[i].texture = getTextureIndex(sprite.texture);
+        spriteRecords[i].subTexture = getSubTextureIndex(sprite.subTexture);
+      }
+      auto chunk = Private::makeComponentChunk<Private::SpriteRecord>(SceneChunkType::Sprites,
+        Private::SPRITES_VERSION, *sprites);
+      chunk.pieces.push_back({ spriteRecords.data(), spriteRecords.size() *
+        sizeof(Private::SpriteRecord), Private::getRecordOffset(sprites->size()) });
+      chunks.push_back(std::move(chunk));
+    }
+
+    Collection<Private::CameraRecord> cameraRecords;
+    const auto* cameras = registry.storage<CameraComponent>();
+    if (cameras != nullptr && cameras->empty() == false) {
+      cameraRecords.resize(cameras->size());
+      for (Index i = 0; i < cameras->size(); ++i) {
+        const auto& component = cameras->get(cameras->data()[i]);
+        const OrthographicCamera2D& camera = component.camera;
+        auto& record = cameraRecords[i];
+        record.position = camera.getPosition();
+        record.viewportSize = camera.getViewportSize();
+        record.rotation = camera.getRotation();
+        record.zoom = camera.getZoom();
+        record.nearPlane = camera.getNearPlane();
+        record.farPlane = camera.getFarPlane();
+        record.primary = (component.primary == true) ? 1 : 0;
+      }
+      auto chunk = Private::makeComponentChunk<Private::CameraRecord>(SceneChunkType::Cameras,
+        Private::CAMERAS_VERSION, *cameras);
+      chunk.pieces.push_back({ cameraRecords.data(), cameraRecords.size() *
+        sizeof(Private::CameraRecord), Private::getRecordOffset(cameras->size()) });
+      chunks.push_back(std::move(chunk));
+    }
+
+    if (droppedCount > 0) {
+      DG_ENGINE_WARN("{} sprites in scene file '{}' use textures which were not loaded from a "
+        "file; writing them without.", droppedCount, path.string());
+    }
+
+    // The texture names are stored as a table of offsets into the text which follows it, with
+    // one more offset marking the end of the last name.
+    Collection<Uint32> nameOffsets { 0 };
+    String nameText;
+    for (const auto& name : textureNames) {
+      nameText += name;
+      nameOffsets.push_back(static_cast<Uint32>(nameText.size()));
+    }
+
+    if (textureNames.empty() == false) {
+      Private::PendingChunk chunk;
+      chunk.entry.type = SceneChunkType::TextureNames;
+      chunk.entry.version = Private::TEXTURE_NAMES_VERSION;
+      chunk.entry.stride = sizeof(Uint32);
+      chunk.entry.count = static_cast<Uint32>(textureNames.size());
+      chunk.entry.size = nameOffsets.size() * sizeof(Uint32) + nameText.size();
+      chunk.pieces.push_back({ nameOffsets.data(), nameOffsets.size() * sizeof(Uint32), 0 });
+      chunk.pieces.push_back({ nameText.data(), nameText.size(),
+        nameOffsets.size() * sizeof(Uint32) });
+      chunks.push_back(std::move(chunk));
+    }
+
+    if (subTextureRecords.empty() == false) {
+      Private::PendingChunk chunk;
+      chunk.entry.type = SceneChunkType::SubTextures;
+      chunk.entry.version = Private::SUB_TEXTURES_VERSION;
+      chunk.entry.stride = sizeof(Private::SubTextureRecord);
+      chunk.entry.count = static_cast<Uint32>(subTextureRecords.size());
+      chunk.entry.size = subTextureRecords.size() * sizeof(Private::SubTextureRecord);
+      chunk.pieces.push_back({ subTextureRecords.data(), chunk.entry.size, 0 });
+      chunks.push_back(std::move(chunk));
+    }
+
+    // Lay the chunks out after the table of contents.
+    Size offset = Private::align(sizeof(header) + chunks.size() * sizeof(SceneChunkEntry));
+    for (auto& chunk : chunks) {
+      chunk.entry.offset = offset;
+      offset = Private::align(offset + chunk.entry.size);
+    }
+    header.chunkCount = static_cast<Uint16>(chunks.size());
+    header.fileSize = offset;
+
+    // Write to a temporary file first, so that a scene file is never seen half-written.
+    Path temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    {
+      std::fstream file { temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc };
+      if (file.is_open() == false) {
+        DG_ENGINE_ERROR("Could not open scene file '{}' for writing.", temporaryPath.string());
+        return false;
+      }
+
+      static const char padding[Private::CHUNK_ALIGNMENT] = {};
+      Size position = 0;
+      auto writeAt = [&] (const void* data, Size size, Size at)
+      {
+        file.write(padding, at - position);
+        file.write(static_cast<const char*>(data), size);
+        position = at + size;
+      };
+
+      writeAt(&header, sizeof(header), 0);
+      for (const auto& chunk : chunks) {
+        writeAt(&chunk.entry, sizeof(chunk.entry), position);
+      }
+      for (const auto& chunk : chunks) {
+        for (const auto& piece : chunk.pieces) {
+          writeAt(piece.data, piece.size, chunk.entry.offset + piece.offset);
+        }
+      }
+      file.write(padding, header.fileSize - position);
+
+      if (file.good() == false) {
+        DG_ENGINE_ERROR("Could not write scene file '{}'.", temporaryPath.string());
+        file.close();
+        fs::remove(temporaryPath);
+        return false;
+      }
+    }
+
+    std::error_code error;
+    fs::rename(temporaryPath, path, error);
+    if (error) {
+      DG_ENGINE_ERROR("Could not move scene file into place at '{}' - {}", path.string(),
+        error.message());
+      fs::remove(temporaryPath, error);
+      return false;
+    }
+
+    return true;
+  }
+
+  Ref<Scene> SceneSerializer::load (const Path& path)
+  {
+    auto file = MappedFile::make(path);
+    if (file == nullptr) {
+      return nullptr;
+    }
+
+    SceneFileHeader header;
+    if (file->getSize() < sizeof(header)) {
+      DG_ENGINE_ERROR("Scene file '{}' is too small.", path.string());
+      return nullptr;
+    }
+
+    std::memcpy(&header, file->getData(), sizeof(header));
+    if (header.magic != SCENE_FILE_MAGIC) {
+      DG_ENGINE_ERROR("File '{}' is not a scene file.", path.string());
+      return nullptr;
+    } else if (header.version != SCENE_FILE_VERSION) {
+      DG_ENGINE_ERROR("Scene file '{}' has unsupported version {}.", path.string(),
+        header.version);
+      return nullptr;
+    } else if (
+      header.fileSize != file->getSize() ||
+      sizeof(header) + header.chunkCount * sizeof(SceneChunkEntry) > file->getSize() ||
+      header.inUseCount > header.entityCount
+    ) {
+      DG_ENGINE_ERROR("Scene file '{}' is truncated or damaged.", path.string());
+      return nullptr;
+    }
+
+    Collection<SceneChunkEntry> chunks(header.chunkCount);
+    std::memcpy(chunks.data(), file->getData() + sizeof(header),
+      chunks.size() * sizeof(SceneChunkEntry));
+
+    // Chunks of types which this build does not know about are skipped.
+    const Size fileSize = file->getSize();
+    const SceneChunkEntry* entityChunk = nullptr;
+    const SceneChunkEntry* nameChunk = nullptr;
+    const SceneChunkEntry* subTextureChunk = nullptr;
+    const SceneChunkEntry* transformChunk = nullptr;
+    const SceneChunkEntry* spriteChunk = nullptr;
+    const SceneChunkEntry* cameraChunk = nullptr;
+    if (
+      Private::findChunk(chunks, SceneChunkType::Entities, Private::ENTITIES_VERSION,
+        sizeof(entt::entity), false, fileSize, path, entityChunk) == false ||
+      Private::findChunk(chunks, SceneChunkType::TextureNames, Private::TEXTURE_NAMES_VERSION,
+        sizeof(Uint32), false, fileSize, path, nameChunk) == false ||
+      Private::findChunk(chunks, SceneChunkType::SubTextures, Private::SUB_TEXTURES_VERSION,
+        sizeof(Private::SubTextureRecord), false, fileSize, path, subTextureChunk) == false ||
+      Private::findChunk(chunks, SceneChunkType::Transforms, Private::TRANSFORMS_VERSION,
+        sizeof(TransformComponent), true, fileSize, path, transformChunk) == false ||
+      Private::findChunk(chunks, SceneChunkType::Sprites, Private::SPRITES_VERSION,
+        sizeof(Private::SpriteRecord), true, fileSize, path, spriteChunk) == false ||
+      Private::findChunk(chunks, SceneChunkType::Cameras, Private::CAMERAS_VERSION,
+        sizeof(Private::CameraRecord), true, fileSize, path, cameraChunk) == false
+    ) {
+      return nullptr;
+    }
+
+    if (
+      (entityChunk == nullptr && header.entityCount > 0) ||
+      (entityChunk != nullptr && entityChunk->count != header.entityCount)
+    ) {
+      DG_ENGINE_ERROR("Scene file '{}' is missing its entities.", path.string());
+      return nullptr;
+    }
+
+    // Find the textures first, since loading one may fail.
+    const Uint8* data = file->getData();
+    Collection<Ref<Texture>> textures;
+    if (nameChunk != nullptr) {
+      const Uint8* chunkData = data + nameChunk->offset;
+      const Size textOffset = (nameChunk->count + 1) * sizeof(Uint32);
+      Collection<Uint32> nameOffsets(nameChunk->count + 1);
+      if (nameChunk->size < textOffset) {
+        DG_ENGINE_ERROR("Scene file '{}' has damaged texture names.", path.string());
+        return nullptr;
+      }
+
+      std::memcpy(nameOffsets.data(), chunkData, textOffset);
+      for (Index i = 0; i < nameChunk->count; ++i) {
+        if (
+          nameOffsets[i] >= nameOffsets[i + 1] ||
+          nameOffsets[i + 1] > nameChunk->size - textOffset
+        ) {
+          DG_ENGINE_ERROR("Scene file '{}' has damaged texture names.", path.string());
+          return nullptr;
+        }
+
+        const String name {
+          reinterpret_cast<const char*>(chunkData + textOffset + nameOffsets[i]),
+          nameOffsets[i + 1] - nameOffsets[i]
+        };
+
+        try {
+          textures.push_back(TextureManager::getOrEmplace(name));
+        } catch (const std::runtime_error&) {
+          DG_ENGINE_ERROR("Could not load texture '{}' used by scene file '{}'.", name,
+            path.string());
+          return nullptr;
+        }
+      }
+    }
+
+    Collection<Ref<SubTexture>> subTextures;
+    if (subTextureChunk != nullptr) {
+      const auto* records = reinterpret_cast<const Private::SubTextureRecord*>(
+        data + subTextureChunk->offset);
+      for (Index i = 0; i < subTextureChunk->count; ++i) {
+        if (records[i].texture < 0 || static_cast<Size>(records[i].texture) >= textures.size()) {
+          DG_ENGINE_ERROR("Scene file '{}' has a sub-texture with no texture.", path.string());
+          return nullptr;
+        }
+
+        subTextures.push_back(SubTexture::make(textures[records[i].texture], records[i].minimum,
+          records[i].maximum));
+      }
+    }
+
+    // Rebuild the entity pool as it was, including the entities waiting to be recycled, so that
+    // every entity keeps its ID and version.
+    auto scene = Scene::make();
+    entt::registry& registry = scene->getRegistry();
+    if (entityChunk != nullptr) {
+      const auto* entities = reinterpret_cast<const entt::entity*>(data + entityChunk->offset);
+      auto& pool = registry.storage<entt::entity>();
+      pool.reserve(entityChunk->count);
+      for (Index i = 0; i < entityChunk->count; ++i) {
+        if (pool.emplace(entities[i]) != entities[i]) {
+          DG_ENGINE_ERROR("Scene file '{}' has damaged entities.", path.string());
+          return nullptr;
+        }
+      }
+      pool.in_use(header.inUseCount);
+    }
+
+    // Transforms are copied straight out of the file, in one go.
+    if (transformChunk != nullptr) {
+      const auto* entities = reinterpret_cast<const entt::entity*>(data + transformChunk->offset);
+      const auto* records = reinterpret_cast<const TransformComponent*>(
+        data + transformChunk->offset + Private::getRecordOffset(transformChunk->count));
+      if (Private::areValid(registry, entities, transformChunk->count) == false) {
+        DG_ENGINE_ERROR("Scene file '{}' has transforms for missing or repeated entities.",
+          path.string());
+        return nullptr;
+      }
+
+      auto& pool = registry.storage<TransformComponent>();
+      pool.reserve(transformChunk->count);
+      pool.insert(entities, entities + transformChunk->count, records);
+    }
+
+    if (spriteChunk != nullptr) {
+      const auto* entities = reinterpret_cast<const entt::entity*>(data + spriteChunk->offset);
+      const auto* records = reinterpret_cast<const Private::SpriteRecord*>(
+        data + spriteChunk->offset + Private::getRecordOffset(spriteChunk->count));
+      if (Private::areValid(registry, entities, spriteChunk->count) == false) {
+        DG_ENGINE_ERROR("Scene file '{}' has sprites for missing or repeated entities.",
+          path.string());
+        return nullptr;
+      }
+
+      auto& pool = registry.storage<SpriteRendererComponent>();
+      pool.reserve(spriteChunk->count);
+      for (Index i = 0; i < spriteChunk->count; ++i) {
+        const auto& record = records[i];
+        if (
+          record.texture < Private::NO_INDEX ||
+          record.texture >= static_cast<Int32>(textures.size()) ||
+          record.subTexture < Private::NO_INDEX ||
+          record.subTexture >= static_cast<Int32>(subTextures.size())
+        ) {
+          DG_ENGINE_ERROR("Scene file '{}' has a sprite with a damaged texture.", path.string());
+          return nullptr;
+        }
+
+        pool.emplace(entities[i], SpriteRendererComponent {
+          record.color,
+          (record.texture != Private::NO_INDEX) ? textures[record.texture] : nullptr,
+          (record.subTexture != Private::NO_INDEX) ? subTextures[record.subTexture] : nullptr
+        });
+      }
+    }
+
+    if (cameraChunk != nullptr) {
+      const auto* entities = reinterpret_cast<const entt::entity*>(data + cameraChunk->offset);
+      const auto* records = reinterpret_cast<const Private::CameraRecord*>(
+        data + cameraChunk->offset + Private::getRecordOffset(cameraChunk->count));
+      if (Private::areValid(registry, entities, cameraChunk->count) == false) {
+        DG_ENGINE_ERROR("Scene file '{}' has cameras for missing or repeated entities.",
+          path.string());
+        return nullptr;
+      }
+
+      auto& pool = registry.storage<CameraComponent>();
+      for (Index i = 0; i < cameraChunk->count; ++i) {
+        const auto& record = records[i];
+        if (
+          Private::isPositive(record.zoom) == false ||
+          Private::isPositive(record.viewportSize.x) == false ||
+          Private::isPositive(record.viewportSize.y) == false ||
+          std::isfinite(record.position.x) == false || std::isfinite(record.position.y) == false ||
+          std::isfinite(record.rotation) == false || std::isfinite(record.nearPlane) == false ||
+          std::isfinite(record.farPlane) == false
+        ) {
+          DG_ENGINE_ERROR("Scene file '{}' has a damaged camera.", path.string());
+          return nullptr;
+        }
+
+        CameraComponent component { OrthographicCamera2D { record.viewportSize },
+          record.primary != 0 };
+        component.camera.setPosition(record.position);
+        component.camera.setRotation(record.rotation);
+        component.camera.setZoom(record.zoom);
+        component.camera.setDepthRange(record.nearPlane, record.farPlane);
+        pool.emplace(entities[i], component);
+      }
+    }
+
+    return scene;
+  }
+
+}
@@ -0,0 +1,329 @@
+/** @file DG/Scene/SystemScheduler.cpp */
+
+#include <DG/Scene/SystemScheduler.hpp>
+
+namespace dg
+{
+
+  namespace Private
+  {
+
+    // The number of chunks which each thread is given, on average, when a view is split. A few
+    // more chunks than threads lets threads which finish early take on the rest.
+    static constexpr Count CHUNKS_PER_THREAD = 4;
+
+    // Checks whether the two lists of component IDs share any component.
+    static Bool intersects (const Collection<entt::id_type>& left,
+      const Collection<entt::id_type>& right)
+    {
+      for (const auto id : left) {
+        if (std::find(right.begin(), right.end(), id) != right.end()) {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // Writes the given text as a quoted JSON string.
+    static void writeJsonString (std::ostream& stream, const String& text)
+    {
+      stream << '"';
+      for (const char character : text) {
+        if (character == '"' || character == '\\') {
+          stream << '\\';
+        }
+        stream << character;
+      }
+      stream << '"';
+    }
+
+  }
+
+  /** System Access *******************************************************************************/
+
+  Bool SystemAccess::conflictsWith (const SystemAccess& other) const
+  {
+    return
+      Private::intersects(writes, other.reads) ||
+      Private::intersects(writes, other.writes) ||
+      Private::intersects(reads, other.writes);
+  }
+
+  /** System Context ******************************************************************************/
+
+  SystemContext::SystemContext (SystemScheduler& scheduler, Index system) :
+    m_scheduler { scheduler },
+    m_system    { system }
+  {
+
+  }
+
+  void SystemContext::parallelFor (Count count, const LFunction<void, Index, Index>& function)
+  {
+    if (count == 0) {
+      return;
+    }
+
+    const Count threadCount = m_scheduler.m_pool.getWorkerCount() + 1;
+    const Count chunkSize = std::max<Count>({ m_scheduler.m_spec.minChunkSize, 1,
+      (count + threadCount * Private::CHUNKS_PER_THREAD - 1) /
+        (threadCount * Private::CHUNKS_PER_THREAD) });
+    const Count chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount == 1) {
+      function(0, count);
+      return;
+    }
+
+    // Every thread taking part claims chunks until none are left. The calling thread takes part
+    // too, so the chunks are finished even if every worker is busy with another system. Helpers
+    // which only start once every chunk is claimed leave without touching anything else.
+    struct Work
+    {
+      std::atomic<Index> next = 0;
+      std::atomic<Count> finished = 0;
+      std::mutex mutex;
+      std::exception_ptr error = nullptr;
+    };
+
+    auto work = makeRef<Work>();
+    SystemScheduler* scheduler = &m_scheduler;
+    const LFunction<void, Index, Index>* body = &function;
+    const Index system = m_system;
+    auto runChunks = [work, scheduler, body, system, count, chunkSize, chunkCount] ()
+    {
+      for (Index chunk = work->next++; chunk < chunkCount; chunk = work->next++) {
+        const Float32 start = scheduler->now();
+        try {
+          (*body)(chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+        } catch (...) {
+          std::lock_guard lock { work->mutex };
+          if (work->error == nullptr) {
+            work->error = std::current_exception();
+          }
+        }
+
+        scheduler->record({ system, 0, true, start, start, scheduler->now() });
+        work->finished++;
+      }
+    };
+
+    const Count helperCount = std::min(chunkCount - 1, m_scheduler.m_pool.getWorkerCount());
+    for (Index i = 0; i < helperCount; ++i) {
+      m_scheduler.m_pool.submit(runChunks);
+    }
+
+    runChunks();
+    while (work->finished.load() < chunkCount) {
+      std::this_thread::yield();
+    }
+
+    if (work->error != nullptr) {
+      std::rethrow_exception(work->error);
+    }
+  }
+
+  /** System Scheduler ****************************************************************************/
+
+  SystemScheduler::SystemScheduler (const SystemSchedulerSpecification& spec) :
+    m_spec  { spec },
+    m_pool  { spec.workerCount }
+  {
+
+  }
+
+  Index SystemScheduler::addSystem (const SystemSpecification& spec)
+  {
+    if (spec.function == nullptr) {
+      DG_ENGINE_CRIT("System '{}' has no function.", spec.name);
+      throw std::invalid_argument { "Attempt to add a system with no function!" };
+    }
+
+    // The new system waits for every earlier system which it conflicts with.
+    const Index index = m_systems.size();
+    m_systems.push_back(spec);
+    m_dependents.emplace_back();
+    m_dependencyCounts.push_back(0);
+    for (Index earlier = 0; earlier < index; ++earlier) {
+      if (m_systems[earlier].access.conflictsWith(spec.access) == true) {
+        m_dependents[earlier].push_back(index);
+        m_dependencyCounts[index]++;
+      }
+    }
+
+    return index;
+  }
+
+  void SystemScheduler::clear ()
+  {
+    m_systems.clear();
+    m_dependents.clear();
+    m_dependencyCounts.clear();
+    m_trace = {};
+  }
+
+  void SystemScheduler::run (Scene& scene, Float32 deltaTime)
+  {
+    // Make every declared pool now, since adding one while systems run would race.
+    for (const auto& system : m_systems) {
+      for (const auto& assurePool : system.access.assurePools) {
+        assurePool(scene.getRegistry());
+      }
+    }
+
+    m_scene = &scene;
+    m_deltaTime = deltaTime;
+    m_remaining = m_dependencyCounts;
+    m_readyTimes.assign(m_systems.size(), 0.0f);
+    m_mainQueue.clear();
+    m_finishedCount = 0;
+    m_error = nullptr;
+    m_trace = {};
+    m_threads = { std::this_thread::get_id() };
+    m_frameClock.restart();
+
+    // The systems with no dependencies are found from the graph, not from the remaining counts,
+    // which the first systems to finish are already lowering.
+    for (Index i = 0; i < m_systems.size(); ++i) {
+      if (m_dependencyCounts[i] == 0) {
+        dispatch(i);
+      }
+    }
+
+    // Run the systems which must stay on this thread as they become ready, until every system
+    // has finished.
+    while (true) {
+      Index system = 0;
+      {
+        std::unique_lock lock { m_mutex };
+        m_condition.wait(lock, [this] ()
+        {
+          return m_mainQueue.empty() == false || m_finishedCount == m_systems.size();
+        });
+        if (m_mainQueue.empty() == true) {
+          break;
+        }
+
+        system = m_mainQueue.front();
+        m_mainQueue.pop_front();
+      }
+
+      execute(system);
+    }
+
+    m_trace.frameTime = now();
+    m_trace.threadCount = m_threads.size();
+    m_scene = nullptr;
+
+    if (m_error != nullptr) {
+      std::exception_ptr error = m_error;
+      m_error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  Boolean SystemScheduler::writeTrace (const Path& path) const
+  {
+    std::fstream file { path, std::ios::out | std::ios::trunc };
+    if (file.is_open() == false) {
+      DG_ENGINE_ERROR("Could not open '{}' for writing the system trace.", path.string());
+      return false;
+    }
+
+    // Each entry becomes a complete event, in microseconds, on its thread's row.
+    file << std::fixed << std::setprecision(3);
+    file << "{\"traceEvents\":[\n";
+    for (Index i = 0; i < m_trace.entries.size(); ++i) {
+      const auto& entry = m_trace.entries[i];
+      file << "  {\"name\":";
+      Private::writeJsonString(file, m_systems.at(entry.system).name);
+      file << ",\"cat\":\"" << ((entry.chunk == true) ? "chunk" : "system") << "\"";
+      file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << entry.thread;
+      file << ",\"ts\":" << entry.startTime * 1.0e6f;
+      file << ",\"dur\":" << (entry.endTime - entry.startTime) * 1.0e6f;
+      file << ",\"args\":{\"wait_us\":" << entry.getWaitTime() * 1.0e6f << "}}";
+      file << ((i + 1 < m_trace.entries.size()) ? ",\n" : "\n");
+    }
+    file << "]}\n";
+
+    if (file.good() == false) {
+      DG_ENGINE_ERROR("Could not write the system trace to '{}'.", path.string());
+      return false;
+    }
+
+    return true;
+  }
+
+  /** Private Functions ***************************************************************************/
+
+  void SystemScheduler::execute (Index system)
+  {
+    const Float32 start = now();
+    try {
+      SystemContext context { *this, system };
+      m_systems[system].function(context);
+    } catch (...) {
+      std::lock_guard lock { m_mutex };
+      if (m_error == nullptr) {
+        m_error = std::current_exception();
+      }
+    }
+
+    record({ system, 0, false, m_readyTimes[system], start, now() });
+
+    // Hand over the dependents which were only waiting on this system.
+    Collection<Index> ready;
+    {
+      std::lock_guard lock { m_mutex };
+      for (const Index dependent : m_dependents[system]) {
+        if (--m_remaining[dependent] == 0) {
+          ready.push_back(dependent);
+        }
+      }
+    }
+
+    for (const Index dependent : ready) {
+      dispatch(dependent);
+    }
+
+    // Notify while still holding the lock, so that the scheduler is not left before this thread
+    // is done with it.
+    std::lock_guard lock { m_mutex };
+    m_finishedCount++;
+    m_condition.notify_all();
+  }
+
+  void SystemScheduler::dispatch (Index system)
+  {
+    m_readyTimes[system] = now();
+    if (m_systems[system].mainThread == true) {
+      std::lock_guard lock { m_mutex };
+      m_mainQueue.push_back(system);
+      m_condition.notify_all();
+    } else {
+      m_pool.submit([this, system] () { execute(system); });
+    }
+  }
+
+  Float32 SystemScheduler::now () const
+  {
+    return m_frameClock.getElapsed();
+  }
+
+  void SystemScheduler::record (const SystemTraceEntry& entry)
+  {
+    if (m_spec.tracing == false) {
+      return;
+    }
+
+    std::lock_guard lock { m_traceMutex };
+    SystemTraceEntry& recorded = m_trace.entries.emplace_back(entry);
+    const auto id = std::this_thread::get_id();
+    const auto found = std::find(m_threads.begin(), m_threads.end(), id);
+    recorded.thread = found - m_threads.begin();
+    if (found == m_threads.end()) {
+      m_threads.push_back(id);
+    }
+  }
+
+}
@@ -20,6 +20,11 @@ namespace dgstudio
     void update () override;
     void guiUpdate () override;
 
+  private:
+    void drawTextureResidencyPanel ();
+    void drawRenderTargetPoolPanel ();
+    void drawDynamicResolutionPanel ();
+
   };
 
 }
@@ -50,6 +50,65 @@ namespace dgstudio
   {
     // ImGui::DockSpaceOverViewport(ImGui::GetMainViewport());
     ImGui::ShowDemoWindow();
+    drawTextureResidencyPanel();
+    drawRenderTargetPoolPanel();
+    drawDynamicResolutionPanel();
+  }
+
+  void StudioLayer::drawTextureResidencyPanel ()
+  {
+    const auto& stats = dg::TextureResidency::getStats();
+    const dg::Float64 mebibyte = 1024.0 * 1024.0;
+
+    ImGui::Begin("Texture Residency");
+    ImGui::Text("Frame: %zu", stats.frame);
+    ImGui::Text("Tracked: %zu", stats.trackedCount);
+    ImGui::Text("Resident: %zu (%.2f MiB)", stats.residentCount,
+      stats.residentByteCount / mebibyte);
+    if (stats.budget == 0) {
+      ImGui::Text("Budget: none");
+    } else {
+      ImGui::Text("Budget: %.2f MiB", stats.budget / mebibyte);
+      ImGui::ProgressBar(static_cast<dg::Float32>(stats.residentByteCount) / stats.budget);
+    }
+    ImGui::Text("Evicted: %zu", stats.evictedCount);
+    ImGui::Separator();
+    ImGui::Text("Evictions: %zu", stats.evictionCount);
+    ImGui::Text("Reloads: %zu", stats.reloadCount);
+    ImGui::End();
+  }
+
+  void StudioLayer::drawRenderTargetPoolPanel ()
+  {
+    const auto& stats = dg::RenderTargetPool::getStats();
+    const dg::Float64 mebibyte = 1024.0 * 1024.0;
+    const dg::Count requests = stats.hitCount + stats.missCount;
+
+    ImGui::Begin("Render Target Pool");
+    ImGui::Text("Pooled: %zu (%.2f MiB)", stats.pooledCount, stats.byteCount / mebibyte);
+    ImGui::Text("Acquired: %zu", stats.acquiredCount);
+    ImGui::Separator();
+    ImGui::Text("Hits: %zu", stats.hitCount);
+    ImGui::Text("Misses: %zu", stats.missCount);
+    if (requests != 0) {
+      ImGui::ProgressBar(static_cast<dg::Float32>(stats.hitCount) / requests);
+    }
+    ImGui::Text("Evictions: %zu", stats.evictionCount);
+    ImGui::End();
+  }
+
+  void StudioLayer::drawDynamicResolutionPanel ()
+  {
+    const auto& stats = dg::DynamicResolution::getStats();
+
+    ImGui::Begin("Dynamic Resolution");
+    ImGui::Text("Scale: %.0f%%", stats.scale * 100.0f);
+    ImGui::ProgressBar(stats.scale);
+    ImGui::Separator();
+    ImGui::Text("GPU time: %.2f ms", stats.gpuTime * 1000.0f);
+    ImGui::Text("Frame time: %.2f ms", stats.frameTime * 1000.0f);
+    ImGui::Text("Changes: %zu", stats.changeCount);
+    ImGui::End();
   }
   
 }